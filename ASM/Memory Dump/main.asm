@@ -2,28 +2,33 @@
 ; Title:	Memory Dump - Main
 ; Author:	Dean Belfield
 ; Created:	15/11/2022
-; Last Updated:	23/03/2023
+; Last Updated:	17/10/2026
 ;
 ; Modinfo:
 ; 23/12/2022:	Added parameter parsing code, help text
 ; 23/03/2023:	Fixed to work with MOS 1.03
+; 17/10/2026:	Lines are built in Buffer and sent to the VDP a block at a time; ESC is only checked every few lines
+; 17/10/2026:	Added -p to wait for a key between screens; the length can be more than 64K
 
-			.ASSUME	ADL = 0				
+			.ASSUME	ADL = 0
 
 			INCLUDE	"equs.inc"
 			INCLUDE "mos_api.inc"	; In MOS/src
 
 			SEGMENT CODE
-			
+
 			XDEF	_main
 
 			XREF	ASC_TO_NUMBER
-			
+			XREF	UPPRC
+
 			XREF	Print_String
-			XREF	Print_Hex24
-			XREF	Print_Hex16
-			XREF	Print_Hex8
-			
+			XREF	Print_Block
+
+Dump_Lines:		EQU		4			; Lines built in Buffer before it is sent to the VDP
+Dump_Check:		EQU		16			; Lines between checks for ESC
+Dump_Page:		EQU		24			; Lines in a screen, if MOS doesn't know
+
 ; Error: Invalid parameter
 ;
 _err_invalid_param:	LD		HL, 19			; The return code: Invalid parameters
@@ -35,10 +40,10 @@ _help:			LD		HL, _help_text
 			CALL		Print_String
 			LD		HL, 0			; The return code: OK
 			RET
-			
+
 _help_text:		DB 		"AGON Memory Dump by Dean Belfield\n\r"
 			DB 		"Usage:\n\r";
-			DB 		"memdump address <length>\n\r", 0;
+			DB 		"memdump [-p] address <length>\n\r", 0;
 
 ; The main routine
 ; IXU: argv - pointer to array of parameters
@@ -46,92 +51,261 @@ _help_text:		DB 		"AGON Memory Dump by Dean Belfield\n\r"
 ; Returns:
 ;  HL: Error code, or 0 if OK
 ;
-_main:			LD		DE, 100h		; Default number of bytes to fetch
+_main:			XOR		A
+			LD		(Page_Mode), A		; Don't wait between screens by default
 			LD		A, C			; Fetch number of parameters
 			CP		2			; Is it less than 2?
 			JR		C, _help		; Then goto help
-			JR		Z, $F			; If it is equal to 2, then proceed with default number of bytes to fetch
+			LD.LIL		HL,(IX+3)		; HLU: Pointer to the first parameter string
+			LD.LIL		A, (HL)
+			CP		'-'			; Is it an option?
+			JR		NZ, _main_1
+			INC.LIL		HL
+			LD.LIL		A, (HL)
+			CALL		UPPRC
+			CP		'P'			; The only option is -p, for page mode
+			JP		NZ, _err_invalid_param
+			LD		(Page_Mode), A
+			INC.LIL		IX			; Skip past it
+			INC.LIL		IX
+			INC.LIL		IX
+			DEC		C
+;
+_main_1:		LD.LIL		DE, 100h		; Default number of bytes to fetch
+			LD		A, C			; Fetch number of parameters
+			CP		2			; Is there still an address?
+			JP		C, _help
+			JR		Z, $F			; If there are 2 parameters, then proceed with default number of bytes to fetch
 			CP		4			; Is it greater than or equal to 4?
-			JR		NC, _help		; Yes, so goto help
+			JP		NC, _help		; Yes, so goto help
 ;
 			LD.LIL		HL,(IX+6)		; HLU: Pointer to the length parameter string
 			CALL		ASC_TO_NUMBER		; DEU: length
-;			
+;
 $$:			PUSH.LIL	DE			; Stack the length
 			LD.LIL		HL,(IX+3)		; HLU: Pointer to the start address parameter string
 			CALL		ASC_TO_NUMBER		; DEU: Start address
 			DB		5Bh			; Prefix for EX.L DE, HL (bodge- cannot get Zilog tools to compile this!)
 			EX		DE, HL
-;			
+;
 			POP.LIL		DE			; Restore the length
-			CALL		Memory_Dump			
+			CALL		Memory_Dump
 ;
 			LD		HL, 0			; Return with OK
 			RET
-			
+
 ; Memory Dump
+; Lines are built in Buffer and sent to the VDP Dump_Lines at a time, rather than a character
+; at a time; the keyboard is only checked for ESC every Dump_Check lines
 ; HLU: Start of memory to dump
-; DE:  Number of bytes to dump out
+; DEU: Number of bytes to dump out
+;
+Memory_Dump:		LD		A, Dump_Check
+			LD		(Check_Count), A
+			CALL		Page_Start
+			CALL		Buffer_Start
+;
+Memory_Dump_1:		PUSH.LIL	HL			; Stack the address
+			LD.LIL		HL, 0
+			OR		A
+			SBC.LIL		HL, DE			; Any bytes left to dump?
+			JP		Z, Memory_Dump_5	; No, so finish
+			LD.LIL		HL, 16
+			OR		A
+			SBC.LIL		HL, DE			; Are there more than 16 bytes left?
+			JR		C, Memory_Dump_2	; Yes, so dump a full line
+			LD		B, E			; B: Number of bytes in the last line
+			LD.LIL		DE, 0			; DEU: No bytes left after it
+			JR		Memory_Dump_3
 ;
-Memory_Dump:		CALL		Print_Hex24
+Memory_Dump_2:		LD.LIL		HL, 0FFFFF0h		; DEU: Bytes left after this line (-16)
+			ADD.LIL		HL, DE
+			PUSH.LIL	HL
+			POP.LIL		DE
+			LD		B, 16			; B: Number of bytes in this line
+;
+Memory_Dump_3:		POP.LIL		HL			; HLU: The address
+			PUSH.LIL	DE			; Stack the number of bytes left
+			LD		DE, (Buffer_Ptr)	; DE: Where to build the line
+			CALL		Dump_Line
+			LD		(Buffer_Ptr), DE
+			POP.LIL		DE
+;
+			LD		A, (Line_Count)		; Send the buffer once it holds Dump_Lines lines
+			DEC		A
+			LD		(Line_Count), A
+			CALL		Z, Buffer_Flush
+;
+			LD		A, (Check_Count)	; Check for ESC every Dump_Check lines
+			DEC		A
+			LD		(Check_Count), A
+			JR		NZ, Memory_Dump_4
+			LD		A, Dump_Check
+			LD		(Check_Count), A
+			PUSH		IX
+			MOSCALL		mos_sysvars		; IX: Address of system variables
+			LD.LIL		A, (IX + sysvar_keyascii)
+			POP		IX
+			CP		1Bh
+			JP		Z, Buffer_Flush		; ESC pressed, so finish
+;
+Memory_Dump_4:		LD		A, (Page_Mode)		; In page mode, wait for a key at the end of each screen
+			OR		A
+			JP		Z, Memory_Dump_1
+			LD		A, (Page_Count)
+			DEC		A
+			LD		(Page_Count), A
+			JP		NZ, Memory_Dump_1
+			CALL		Buffer_Flush
+			PUSH.LIL	DE
+			PUSH.LIL	HL
+			MOSCALL		mos_getkey		; A: The key pressed
+			POP.LIL		HL
+			POP.LIL		DE
+			CP		1Bh
+			RET		Z			; ESC pressed, so finish
+			CALL		Page_Start
+			JP		Memory_Dump_1
+;
+Memory_Dump_5:		POP.LIL		HL
+			JP		Buffer_Flush		; Send what is left in the buffer
+
+; Format one line of the dump into the buffer: the address, the bytes in hex, then the bytes
+; as characters with the non-printable ones replaced with dots
+; HLU: Address of the first byte
+;   B: Number of bytes (1 to 16)
+;  DE: Where to write the line
+; Returns:
+; HLU: Address of the byte after the line
+;  DE: Address after the line in the buffer
+;
+Dump_Line:		PUSH		BC			; Stack the number of bytes
+			PUSH.LIL	HL			; Fetch HLU
+			LD.LIL		HL, 2
+			ADD.LIL		HL, SP
+			LD.LIL		A, (HL)
+			POP.LIL		HL
+			CALL		Buffer_Hex8
+			LD		A, H
+			CALL		Buffer_Hex8
+			LD		A, L
+			CALL		Buffer_Hex8
 			LD		A, ':'
-			RST		10h
+			LD		(DE), A
+			INC		DE
 			LD		A, ' '
-			RST		10h
-			LD		B, 16
-			LD		IX, Buffer
-			LD		(IX+0), ' '
-;			
-Memory_Dump_1:		LD.LIL		A, (HL)
-			PUSH		AF
+			LD		(DE), A
+			INC		DE
+			LD		IX, 33			; IX: Where the characters go, after the hex and a space
+			ADD		IX, DE
+;
+Dump_Line_1:		LD.LIL		A, (HL)
+			INC.LIL		HL
+			LD		C, A
 			CP      	07Fh                	; DEL is non-printable
-			JR      	Z, Memory_Dump_1a
+			JR      	Z, Dump_Line_2
 			CP		' '                 	; As are all control chars.
-			JR		NC, Memory_Dump_2
-Memory_Dump_1a:  	LD		A, '.'			; replace nonprintable chars with dot.			
-Memory_Dump_2:		LD		(IX+1), A
+			JR		NC, Dump_Line_3
+Dump_Line_2:		LD		A, '.'			; replace nonprintable chars with dot.
+Dump_Line_3:		LD		(IX+0), A
 			INC		IX
-			POP		AF
-			CALL		Print_Hex8
-			INC.LIL		HL
-			DEC		DE
-			LD		A, D
-			OR		E
-			JR		Z, Memory_Dump_3
-			DJNZ		Memory_Dump_1
-			CALL		Memory_Dump_5			
-			PUSH		IX 			; Check for ESC
-			MOSCALL		mos_sysvars		; IX: Address of system variables
-			LD.LIL		A, (IX + sysvar_keyascii)
-			POP		IX 
-			CP		1Bh
-			JR 		NZ, Memory_Dump
+			LD		A, C
+			CALL		Buffer_Hex8
+			DJNZ		Dump_Line_1
+;
+			POP		BC			; B: Number of bytes
+			LD		A, 16
+			SUB		B			; A: Number of bytes missing from a short line
+			JR		Z, Dump_Line_5
+			LD		B, A
+			LD		A, ' '			; Pad the hex out so the characters line up
+Dump_Line_4:		LD		(DE), A
+			INC		DE
+			LD		(DE), A
+			INC		DE
+			DJNZ		Dump_Line_4
+;
+Dump_Line_5:		LD		A, ' '
+			LD		(DE), A
+			LD		(IX+0), CR
+			LD		(IX+1), LF
+			LD		DE, 2
+			ADD		IX, DE
+			PUSH		IX			; DE: After the line
+			POP		DE
 			RET
-			
-Memory_Dump_3:		LD		A, B
-			OR		A
-			JR		Z, Memory_Dump_5
-			DEC		B
-			JR		Z, Memory_Dump_5
-			LD		A, ' '
+
+; Write an 8-bit HEX number into the buffer
+; A: Number to write
+; DE: Where to write it
+; Returns:
+; DE: Address after the number
 ;
-Memory_Dump_4:		RST		10h
-			RST 		10h
-			DJNZ		Memory_Dump_4
+Buffer_Hex8:		PUSH	AF
+			RRA
+			RRA
+			RRA
+			RRA
+			CALL	$F
+			POP	AF
+$$:			AND	0Fh
+			ADD	A,90h
+			DAA
+			ADC	A,40h
+			DAA
+			LD	(DE),A
+			INC	DE
+			RET
+
+; Empty the buffer
 ;
-Memory_Dump_5:		LD		(IX+1),0Dh
-			LD		(IX+2),0Ah
-			LD		(IX+3),00h
-			PUSH.LIL	HL
+Buffer_Start:		PUSH.LIL	HL
 			LD		HL, Buffer
-			CALL		Print_String
+			LD		(Buffer_Ptr), HL
 			POP.LIL		HL
+			LD		A, Dump_Lines
+			LD		(Line_Count), A
+			RET
+
+; Send the lines in the buffer to the VDP in one block, then empty it
+;
+Buffer_Flush:		PUSH.LIL	DE
+			PUSH.LIL	HL
+			LD		HL, (Buffer_Ptr)
+			LD		DE, Buffer
+			OR		A
+			SBC		HL, DE			; HL: Number of characters in the buffer
+			JR		Z, $F
+			LD		B, H
+			LD		C, L
+			EX		DE, HL			; HL: The buffer
+			CALL		Print_Block
+$$:			POP.LIL		HL
+			POP.LIL		DE
+			JR		Buffer_Start
+
+; Start a screen in page mode; the screen is a line short, so that the first line stays on it
+; while waiting for a key
+;
+Page_Start:		PUSH		IX
+			MOSCALL		mos_sysvars		; IX: Address of system variables
+			LD.LIL		A, (IX + sysvar_scrRows)
+			POP		IX
+			OR		A			; If the VDP didn't say, assume a 24 line screen
+			JR		NZ, $F
+			LD		A, Dump_Page
+$$:			DEC		A
+			LD		(Page_Count), A
 			RET
-		
+
 ; RAM
-; 
+;
 			DEFINE	LORAM, SPACE = ROM
 			SEGMENT LORAM
-			
-Buffer:			DS	256
-			
\ No newline at end of file
+
+Buffer:			DS	256			; Dump_Lines lines of up to 60 characters
+Buffer_Ptr:		DS	2			; Where the next line goes in Buffer
+Line_Count:		DS	1			; Lines left before Buffer is sent
+Check_Count:		DS	1			; Lines left before ESC is checked
+Page_Mode:		DS	1			; Non-zero to wait for a key between screens
+Page_Count:		DS	1			; Lines left before waiting for a key
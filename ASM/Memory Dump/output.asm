@@ -2,9 +2,10 @@
 ; Title:	Memory Dump - Output functions
 ; Author:	Dean Belfield
 ; Created:	15/11/2022
-; Last Updated:	15/11/2022
+; Last Updated:	17/10/2026
 ;
 ; Modinfo:
+; 17/10/2026:	Added Print_Block
 
 			INCLUDE	"equs.inc"
 
@@ -13,6 +14,7 @@
 			SEGMENT CODE
 			
 			XDEF	Print_String
+			XDEF	Print_Block
 			XDEF	Print_Hex24
 			XDEF	Print_Hex16
 			XDEF	Print_Hex8
@@ -26,6 +28,27 @@ Print_String:		LD	A,(HL)
 			INC	HL
 			JR	Print_String
 			
+; Print a block of characters, sent to the VDP in one go rather than a character at a time
+; HL: Address of the block
+; BC: Number of characters (not 0)
+;
+Print_Block:		PUSH.LIL	HL			; Make HL and BC 24-bit for MOS
+			PUSH.LIL	BC
+			LD.LIL		HL, 2
+			ADD.LIL		HL, SP			; HL: Address of BCU on the stack
+			XOR		A
+			LD.LIL		(HL), A			; BCU: 0
+			INC.LIL		HL
+			INC.LIL		HL
+			INC.LIL		HL			; HL: Address of HLU on the stack
+			LD		A, MB
+			LD.LIL		(HL), A			; HLU: This segment
+			POP.LIL		BC
+			POP.LIL		HL
+			XOR		A			; A: Delimiter (not used as BC is not 0)
+			RST.LIL		18h			; Send them to the VDP as one stream
+			RET
+
 ; Print a 24-bit HEX number
 ; HLU: Number to print
 ;
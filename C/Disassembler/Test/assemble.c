@@ -0,0 +1,626 @@
+/*
+ * Title:			Disassembler - Test Assembler (host build)
+ * Author:			Dean Belfield
+ * Created:			17/10/2026
+ * Last Updated:	17/10/2026
+ *
+ * A small assembler for the source the disassembler writes in its ZDS II and ez80asm syntaxes,
+ * so that a round trip can be checked without either toolchain. Instructions are looked up in
+ * the decode tables: the first entry in table order whose mnemonic and operands match is used
+ *
+ * Modinfo:
+ * 17/10/2026:		Added strings in a DB, and DL
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+
+#include "decode.h"
+
+#define TEXT_MAX		256			// Maximum length of a source line
+#define IMAGE_SIZE		0x1000000	// The eZ80's 24-bit address space
+#define HASH_SIZE		65536		// Number of buckets in the label table; a power of 2
+#define NAME_MAX		32			// Maximum length of a label
+
+// A label or EQU
+//
+struct s_label {
+	char	name[NAME_MAX + 1];		// The name
+	long	value;					// The value
+	int		next;					// Index of the next label in the same bucket, or -1
+};
+
+// An operand as written in the source
+//
+struct s_arg {
+	char *	text;					// The text, trimmed; NULL if there isn't one
+	long	value;					// Its value, once matched against a fetched operand
+};
+
+static const unsigned char	t_suffix[] = { 0x00, 0x40, 0x49, 0x52, 0x5B };	// Suffix byte, indexed by AM_*
+static const unsigned char	t_prefix[T_COUNT][2] = {						// Bytes before the opcode, indexed by T_*
+	{ 0x00, 0x00 }, { 0xCB, 0x00 }, { 0xED, 0x00 }, { 0xDD, 0x00 }, { 0xFD, 0x00 }, { 0xDD, 0xCB }, { 0xFD, 0xCB }
+};
+
+long				adl = 1;		// ADL mode
+
+static struct s_label *	label;		// The labels
+static int				labels;		// Number of labels
+static int				labelsMax;	// Space allocated for labels
+static int				bucket[HASH_SIZE];	// First label in each bucket, or -1
+static unsigned char *	image;		// The assembled bytes
+static long				address;	// The address being assembled at
+static long				lo, hi;		// Range of addresses written
+static int				pass;		// 1 to collect the labels, 2 to assemble
+static int				line;		// Line number, for errors
+static int				errors;		// Number of errors
+static int				undefined;	// Set if the statement uses a label that hasn't been defined
+
+void			help(void);
+int				assemble(FILE * file);
+void			statement(char * s);
+void			data(char * s, int width);
+void			instruction(char * s);
+const struct s_decode *	lookup(int m, struct s_arg * arg);
+int				match(unsigned char operand, struct s_arg * arg);
+int				matchDisplacement(const char * reg, int bracket, struct s_arg * arg);
+int				expression(char * s, long * value);
+int				reserved(const char * s);
+void			define(char * name, long value);
+unsigned int	hash(const char * s);
+void			emit(unsigned char b);
+void			error(const char * message);
+char *			trim(char * s);
+
+// Parameters:
+// - argc: Argument count
+// - argv: Array of arguments
+//
+int main(int argc, char * argv[]) {
+	FILE *	file;
+
+	if(argc != 3) {
+		help();
+		return 1;
+	}
+	image = calloc(IMAGE_SIZE, 1);
+	if(image == NULL) {
+		fprintf(stderr, "Out of memory\n");
+		return 1;
+	}
+	memset(bucket, 0xFF, sizeof(bucket));
+	file = fopen(argv[1], "r");
+	if(file == NULL) {
+		fprintf(stderr, "Cannot open %s\n", argv[1]);
+		return 1;
+	}
+	for(pass = 1; pass <= 2 && errors == 0; pass++) {
+		rewind(file);
+		adl = 1;
+		address = 0;
+		lo = IMAGE_SIZE;
+		hi = 0;
+		assemble(file);
+	}
+	fclose(file);
+	if(errors > 0) {
+		return 1;
+	}
+	file = fopen(argv[2], "wb");
+	if(file == NULL) {
+		fprintf(stderr, "Cannot create %s\n", argv[2]);
+		return 1;
+	}
+	if(hi > lo) {
+		fwrite(&image[lo], 1, hi - lo, file);
+	}
+	fclose(file);
+	return 0;
+}
+
+// Help text
+//
+void help() {
+	printf("AGON eZ80 Disassembler test assembler\n");
+	printf("Usage:\n");
+	printf("assemble source output\n");
+}
+
+// One pass over the source
+// Parameters:
+// - file: The source
+// Returns:
+// - int: Number of errors so far
+//
+int assemble(FILE * file) {
+	char	text[TEXT_MAX];
+	char *	s;
+	char *	e;
+	int		quoted;
+
+	for(line = 1; fgets(text, sizeof(text), file); line++) {
+		for(s = text, quoted = 0; *s && (quoted || *s != ';'); s++) {
+			if(*s == '"') {
+				quoted = !quoted;		// A comment can't start in a string
+			}
+		}
+		*s = '\0';
+		s = text;
+		if(*s && !isspace((unsigned char)*s)) {
+			e = strchr(s, ':');
+			if(e == NULL) {
+				error("Label without a colon");
+				continue;
+			}
+			*e++ = '\0';
+			e = trim(e);
+			if(strncasecmp(e, "EQU", 3) == 0 && isspace((unsigned char)e[3])) {
+				long value;
+
+				if(!expression(trim(e + 3), &value)) {
+					error("Bad EQU");
+				}
+				define(s, value);
+				continue;
+			}
+			define(s, address);
+			s = e;
+		}
+		undefined = 0;
+		statement(trim(s));
+		if(undefined && pass == 2) {
+			error("Undefined label");
+		}
+	}
+	return errors;
+}
+
+// Assemble a directive or instruction
+// Parameters:
+// - s: The statement, trimmed
+//
+void statement(char * s) {
+	char *	e;
+	long	value;
+
+	if(*s == '\0') {
+		return;
+	}
+	if(strncasecmp(s, "ORG", 3) == 0 || strncasecmp(s, ".ORG", 4) == 0) {
+		if(!expression(trim(s + (*s == '.' ? 4 : 3)), &value)) {
+			error("Bad ORG");
+		}
+		address = value;
+		return;
+	}
+	if(strncasecmp(s, ".ASSUME", 7) == 0) {
+		e = strchr(s, '=');
+		if(e == NULL || !expression(trim(e + 1), &adl)) {
+			error("Bad .ASSUME");
+		}
+		return;
+	}
+	if(strncasecmp(s, "DB", 2) == 0 && isspace((unsigned char)s[2])) {
+		data(s + 3, 1);
+		return;
+	}
+	if(strncasecmp(s, "DL", 2) == 0 && isspace((unsigned char)s[2])) {
+		data(s + 3, 3);
+		return;
+	}
+	instruction(s);
+}
+
+// Assemble the values of a DB or DL; a DB can have strings in double quotes too
+// Parameters:
+// - s: The values, separated by commas
+// - width: Size of each value in bytes (1 or 3)
+//
+void data(char * s, int width) {
+	char *	e;
+	long	value;
+	int		i, last;
+
+	for(;;) {
+		s = trim(s);
+		if(*s == '"' && width == 1) {
+			for(e = s + 1; *e && *e != '"'; e++) {
+				emit(*e);
+			}
+			if(*e != '"') {
+				error("Bad string");
+				return;
+			}
+			e = trim(e + 1);
+			if(*e == '\0') {
+				return;
+			}
+			if(*e != ',') {
+				error("Bad string");
+				return;
+			}
+		}
+		else {
+			e = s + strcspn(s, ",");
+			last = *e == '\0';
+			*e = '\0';
+			if(!expression(trim(s), &value)) {
+				error(width == 1 ? "Bad DB" : "Bad DL");
+			}
+			for(i = 0; i < width; i++) {
+				emit(value >> (i * 8));
+			}
+			if(last) {
+				return;
+			}
+		}
+		s = e + 1;
+	}
+}
+
+// Assemble an instruction
+// Parameters:
+// - s: The instruction, trimmed
+//
+void instruction(char * s) {
+	const struct s_decode *	d;
+	struct s_arg			arg[2];
+	unsigned char			bytes[8];
+	unsigned char			operand[2];
+	char *					e;
+	char *					suffix;
+	int						m, am = AM_NONE;
+	int						t, b, i, n, size, rel, disp, wide;
+
+	//
+	// LD MB,A and LD A,MB are listed as mnemonics without operands
+	//
+	for(m = M_NOP; m < M_DB; m++) {
+		if(strchr(t_mnemonic[m], ' ') && strcasecmp(t_mnemonic[m], s) == 0) {
+			break;
+		}
+	}
+	arg[0].text = arg[1].text = NULL;
+	if(m == M_DB) {
+		for(e = s; *e && !isspace((unsigned char)*e); e++);
+		if(*e) {
+			*e++ = '\0';
+			arg[0].text = trim(e);
+			e = strchr(arg[0].text, ',');
+			if(e) {
+				*e++ = '\0';
+				arg[0].text = trim(arg[0].text);
+				arg[1].text = trim(e);
+			}
+		}
+		suffix = strchr(s, '.');
+		if(suffix) {
+			*suffix++ = '\0';
+			for(am = AM_SIS; am <= AM_LIL && strcasecmp(suffix, t_am[am] + 1) != 0; am++);
+			if(am > AM_LIL) {
+				error("Unknown suffix");
+				return;
+			}
+		}
+		for(m = M_NOP; m < M_DB && strcasecmp(t_mnemonic[m], s) != 0; m++);
+		if(m == M_DB) {
+			error("Unknown mnemonic");
+			return;
+		}
+	}
+
+	d = lookup(m, arg);
+	if(d == NULL) {
+		error("No encoding for the operands");
+		return;
+	}
+	t = (d - t_decode[0]) / 256;
+	b = (d - t_decode[0]) % 256;
+	operand[0] = d->operand1;
+	operand[1] = d->operand2;
+	wide = am == AM_NONE ? adl == 1 : am >= AM_SIL;
+	n = 0;
+	rel = -1;
+	if(am != AM_NONE) {
+		bytes[n++] = t_suffix[am];
+	}
+	if(t_prefix[t][0]) {
+		bytes[n++] = t_prefix[t][0];
+	}
+	if(t_prefix[t][1]) {
+		disp = operand[0] == OP_IXD || operand[0] == OP_IYD ? 0 : 1;
+		bytes[n++] = t_prefix[t][1];
+		bytes[n++] = arg[disp].value;		// DD CB d op: the displacement precedes the opcode
+	}
+	bytes[n++] = b;
+	for(i = 0; i < 2; i++) {
+		switch(operand[i]) {
+			case OP_N:
+			case OP_PORT: {
+				bytes[n++] = arg[i].value;
+			} break;
+			case OP_NN:
+			case OP_INN: {
+				bytes[n++] = arg[i].value;
+				bytes[n++] = arg[i].value >> 8;
+				if(wide) {
+					bytes[n++] = arg[i].value >> 16;
+				}
+			} break;
+			case OP_REL: {
+				rel = n++;
+			} break;
+			case OP_IXD:
+			case OP_IYD:
+			case OP_IXO:
+			case OP_IYO: {
+				if(!(d->flags & D_DISP)) {
+					bytes[n++] = arg[i].value;
+				}
+			} break;
+		}
+	}
+	size = n;
+	if(rel >= 0) {
+		long offset = arg[operand[0] == OP_REL ? 0 : 1].value - (address + size);
+
+		if(pass == 2 && (offset < -128 || offset > 127)) {
+			error("Relative jump out of range");
+		}
+		bytes[rel] = offset;
+	}
+	for(i = 0; i < size; i++) {
+		emit(bytes[i]);
+	}
+}
+
+// Find the first entry in the decode tables that matches an instruction
+// Parameters:
+// - m: The mnemonic (M_*)
+// - arg: The operands in the source
+// Returns:
+// - const struct s_decode *: The entry, or NULL if there isn't one
+//
+const struct s_decode * lookup(int m, struct s_arg * arg) {
+	const struct s_decode *	d = t_decode[0];
+	int						i;
+
+	for(i = 0; i < T_COUNT * 256; i++) {
+		if(d[i].mnemonic == m && !(d[i].flags & (D_PREFIX | D_SUFFIX)) && match(d[i].operand1, &arg[0]) && match(d[i].operand2, &arg[1])) {
+			return &d[i];
+		}
+	}
+	return NULL;
+}
+
+// Check whether an operand in the source matches an operand in the decode tables
+// Parameters:
+// - operand: The operand in the tables (OP_*)
+// - arg: The operand in the source; its value is set if it matches an operand fetched from the code
+// Returns:
+// - 1: It matches
+// - 0: It doesn't
+//
+int match(unsigned char operand, struct s_arg * arg) {
+	char	text[TEXT_MAX];
+	int		length;
+
+	if(operand == OP_NONE || arg->text == NULL) {
+		return operand == OP_NONE && arg->text == NULL;
+	}
+	if(operand < OP_RST00) {
+		return strcasecmp(t_operand[operand], arg->text) == 0;
+	}
+	switch(operand) {
+		case OP_N:
+		case OP_NN:
+		case OP_REL: {
+			return *arg->text != '(' && expression(arg->text, &arg->value);
+		} break;
+		case OP_PORT:
+		case OP_INN: {
+			length = strlen(arg->text);
+			if(arg->text[0] != '(' || arg->text[length - 1] != ')') {
+				return 0;
+			}
+			memcpy(text, arg->text + 1, length - 2);
+			text[length - 2] = '\0';
+			return expression(trim(text), &arg->value);
+		} break;
+		case OP_IXD: {
+			return matchDisplacement("IX", 1, arg);
+		} break;
+		case OP_IYD: {
+			return matchDisplacement("IY", 1, arg);
+		} break;
+		case OP_IXO: {
+			return matchDisplacement("IX", 0, arg);
+		} break;
+		case OP_IYO: {
+			return matchDisplacement("IY", 0, arg);
+		} break;
+	}
+	//
+	// Restart vectors
+	//
+	return expression(arg->text, &arg->value) && arg->value == (operand - OP_RST00) * 8;
+}
+
+// Match an indexed operand: (IX+d), (IY+d), IX+d or IY+d
+// Parameters:
+// - reg: The index register
+// - bracket: Set if the operand is in brackets
+// - arg: The operand in the source; its value is set to the displacement if it matches
+// Returns:
+// - 1: It matches
+// - 0: It doesn't
+//
+int matchDisplacement(const char * reg, int bracket, struct s_arg * arg) {
+	char *	s = arg->text;
+	char *	e;
+
+	if(bracket && *s++ != '(') {
+		return 0;
+	}
+	if(strncasecmp(s, reg, 2) != 0 || (s[2] != '+' && s[2] != '-')) {
+		return 0;
+	}
+	arg->value = strtol(s + 2, &e, 10);
+	if(bracket && *e++ != ')') {
+		return 0;
+	}
+	return *e == '\0' && arg->value >= -128 && arg->value <= 127;
+}
+
+// Evaluate an expression: a number (&FF, $FF, 0xFF, 0FFh or 255) or a label
+// Parameters:
+// - s: The expression, trimmed
+// - value: Pointer to the storage for the value
+// Returns:
+// - 1: OK; a label that hasn't been defined is 0, and sets undefined
+// - 0: Not an expression
+//
+int expression(char * s, long * value) {
+	char *	e;
+	int		length = strlen(s);
+	int		i;
+
+	if(length == 0 || reserved(s)) {
+		return 0;
+	}
+	if(*s == '&' || *s == '$') {
+		*value = strtol(s + 1, &e, 16);
+		return e != s + 1 && *e == '\0';
+	}
+	if(s[0] == '0' && (s[1] == 'x' || s[1] == 'X')) {
+		*value = strtol(s + 2, &e, 16);
+		return e != s + 2 && *e == '\0';
+	}
+	if(isdigit((unsigned char)*s)) {
+		if(s[length - 1] == 'h' || s[length - 1] == 'H') {
+			*value = strtol(s, &e, 16);
+			return e == s + length - 1;
+		}
+		*value = strtol(s, &e, 10);
+		return *e == '\0';
+	}
+	for(e = s; isalnum((unsigned char)*e) || *e == '_' || *e == '.' || *e == '@' || *e == '?'; e++);
+	if(*e != '\0' || isdigit((unsigned char)*s)) {
+		return 0;
+	}
+	for(i = bucket[hash(s)]; i >= 0; i = label[i].next) {
+		if(strcmp(label[i].name, s) == 0) {
+			*value = label[i].value;
+			return 1;
+		}
+	}
+	undefined = 1;
+	*value = 0;
+	return 1;
+}
+
+// Check whether an operand is a register, condition or other fixed operand that isn't a number
+// Parameters:
+// - s: The operand
+// Returns:
+// - 1: It is
+// - 0: It isn't
+//
+int reserved(const char * s) {
+	int	i;
+
+	for(i = OP_NONE + 1; i < OP_RST00; i++) {
+		if(!isdigit((unsigned char)*t_operand[i]) && strcasecmp(t_operand[i], s) == 0) {
+			return 1;
+		}
+	}
+	return 0;
+}
+
+// Define a label in the first pass
+// Parameters:
+// - name: The name
+// - value: The value
+//
+void define(char * name, long value) {
+	struct s_label *	l;
+	unsigned int		h;
+
+	name = trim(name);
+	if(pass != 1) {
+		return;
+	}
+	if(labels == labelsMax) {
+		labelsMax = labelsMax ? labelsMax * 2 : 4096;
+		label = realloc(label, labelsMax * sizeof(struct s_label));
+		if(label == NULL) {
+			fprintf(stderr, "Out of memory\n");
+			exit(1);
+		}
+	}
+	h = hash(name);
+	l = &label[labels];
+	strncpy(l->name, name, NAME_MAX);
+	l->name[NAME_MAX] = '\0';
+	l->value = value;
+	l->next = bucket[h];
+	bucket[h] = labels++;
+}
+
+// Hash a label
+// Parameters:
+// - s: The name
+// Returns:
+// - unsigned int: Index of its bucket
+//
+unsigned int hash(const char * s) {
+	unsigned int	h = 5381;
+
+	while(*s) {
+		h = h * 33 + (unsigned char)*s++;
+	}
+	return h & (HASH_SIZE - 1);
+}
+
+// Write a byte at the current address
+// Parameters:
+// - b: The byte
+//
+void emit(unsigned char b) {
+	long	a = address & (IMAGE_SIZE - 1);
+
+	image[a] = b;
+	if(a < lo) lo = a;
+	if(a + 1 > hi) hi = a + 1;
+	address++;
+}
+
+// Report an error
+// Parameters:
+// - message: The error
+//
+void error(const char * message) {
+	fprintf(stderr, "Line %d: %s\n", line, message);
+	errors++;
+}
+
+// Trim leading and trailing white space
+// Parameters:
+// - s: The string
+// Returns:
+// - char *: The trimmed string
+//
+char * trim(char * s) {
+	char *	e;
+
+	while(isspace((unsigned char)*s)) {
+		s++;
+	}
+	e = s + strlen(s);
+	while(e > s && isspace((unsigned char)e[-1])) {
+		*--e = '\0';
+	}
+	return s;
+}
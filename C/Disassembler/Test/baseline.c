@@ -0,0 +1,146 @@
+/*
+ * Title:			Disassembler - Baseline Decoder Listing (host build)
+ * Author:			Dean Belfield
+ * Created:			17/10/2026
+ * Last Updated:	17/10/2026
+ *
+ * Builds the switch-based decoder of the original main.c (extracted by Test/baseline.sh) and lists
+ * the same instructions as Test/conformance.c, in the same layout, so that the table-driven decoder
+ * can be compared with it. The original reads the code through its address counter, so the
+ * instructions are mapped at the address they are decoded at
+ *
+ * Modinfo:
+ */
+
+#define _DEFAULT_SOURCE
+
+#include <stdio.h>
+#include <string.h>
+#include <sys/mman.h>
+
+#define main			baselineMain	// The original's command line isn't used
+#define errno			baselineErrno	// Declared by the original, for the Agon's stdlib
+#define BASE			0x040000		// Address the instructions are decoded at
+#define DISPLACEMENT	0x81			// The displacement in DD CB d op and FD CB d op (-127)
+#define T_COUNT			7				// Number of prefix tables: none, CB, ED, DD, FD, DD CB and FD CB
+
+#include "main.c"
+
+#undef main
+
+int		errno;
+
+// As in Test/conformance.c
+//
+static const unsigned char	t_prefix[T_COUNT][2] = {
+	{ 0x00, 0x00 }, { 0xCB, 0x00 }, { 0xED, 0x00 }, { 0xDD, 0x00 }, { 0xFD, 0x00 }, { 0xDD, 0xCB }, { 0xFD, 0xCB }
+};
+static const unsigned char	t_suffix[] = { 0x00, 0x40, 0x49, 0x52, 0x5B };
+static const unsigned char	t_operands[] = { 0x81, 0x23, 0x45, 0x67 };
+static const unsigned char	t_chain[][4] = {
+	{ 2, 0xDD, 0xDD }, { 2, 0xDD, 0xED }, { 2, 0xDD, 0xFD }, { 2, 0xFD, 0xFD }, { 2, 0xFD, 0xED }, { 2, 0xFD, 0xDD },
+	{ 2, 0x40, 0x49 }, { 2, 0x52, 0x5B }, { 2, 0x5B, 0x5B }, { 3, 0x5B, 0x49, 0xDD },
+	{ 3, 0xDD, 0xCB, 0x00 }, { 3, 0xDD, 0xCB, 0x7F }, { 3, 0xDD, 0xCB, 0x80 },
+	{ 3, 0xFD, 0xCB, 0x00 }, { 3, 0xFD, 0xCB, 0x7F }, { 3, 0xFD, 0xCB, 0x80 }, { 3, 0xFD, 0xCB, 0xFF },
+};
+
+static unsigned char *	bytes;			// The instructions, mapped at BASE
+
+void	conform(long mode, const unsigned char * head, int count, int op);
+
+// The original writes its padding with the Agon's putch
+//
+int putch(int ch) {
+	return putchar(ch);
+}
+
+int getch(void) {
+	return 0;
+}
+
+// Returns:
+// - int: 0 if OK, otherwise 1 if the instructions can't be mapped at BASE
+//
+int main(void) {
+	unsigned char	head[4];
+	int				mode, am, table, op, i, n;
+
+	bytes = mmap((void *)BASE, 4096, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED_NOREPLACE, -1, 0);
+	if(bytes != (unsigned char *)BASE) {
+		fprintf(stderr, "Can't map the instructions at &%06X\n", BASE);
+		return 1;
+	}
+	for(mode = 1; mode >= 0; mode--) {
+		for(am = 0; am <= 4; am++) {
+			for(table = 0; table < T_COUNT; table++) {
+				n = 0;
+				if(am != 0) {
+					head[n++] = t_suffix[am];
+				}
+				if(t_prefix[table][0]) {
+					head[n++] = t_prefix[table][0];
+				}
+				if(t_prefix[table][1]) {
+					head[n++] = t_prefix[table][1];
+					head[n++] = DISPLACEMENT;
+				}
+				for(op = 0; op < 256; op++) {
+					conform(mode, head, n, op);
+				}
+			}
+		}
+	}
+	for(mode = 1; mode >= 0; mode--) {
+		for(i = 0; i < (int)(sizeof(t_chain) / sizeof(t_chain[0])); i++) {
+			for(op = 0; op < 256; op++) {
+				conform(mode, &t_chain[i][1], t_chain[i][0], op);
+			}
+		}
+	}
+	return 0;
+}
+
+// Decode the instructions up to and including an opcode as the original's main loop did, and list
+// them as Test/conformance.c does
+// Parameters:
+// - mode: ADL mode
+// - head: The bytes before the opcode: suffix, prefixes and displacement
+// - count: Number of bytes before the opcode
+// - op: The opcode
+//
+void conform(long mode, const unsigned char * head, int count, int op) {
+	struct s_opcode	opcode;
+	long			address = BASE;
+	int				i;
+
+	memset(bytes, 0, 16);
+	memcpy(bytes, head, count);
+	bytes[count] = op;
+	memcpy(&bytes[count + 1], t_operands, sizeof(t_operands));
+
+	adl = mode;
+	while(address <= BASE + count) {
+		opcode.shift = 0x00;
+		opcode.addressMode = 0x00;
+		opcode.text[0] = '\0';
+		opcode.address = address;
+		opcode.count = 0;
+		decodeOperand(&address, &opcode);
+		if(opcode.addressMode > 0) {
+			decodeOperand(&address, &opcode);
+		}
+		if(opcode.shift > 0) {
+			decodeOperand(&address, &opcode);
+		}
+		printf("%ld ", mode);
+		for(i = 0; i < 8; i++) {
+			if(i < opcode.count) {
+				printf("%02X ", opcode.byteData[i]);
+			}
+			else {
+				printf("   ");
+			}
+		}
+		printf("%s\n", opcode.text);
+	}
+}
@@ -0,0 +1,36 @@
+#!/bin/sh
+#
+# Title:		Disassembler - Baseline Decoder Comparison
+# Author:		Dean Belfield
+# Created:		17/10/2026
+# Last Updated:	17/10/2026
+#
+# Lists the instructions of the decoder conformance test with the switch-based decoder of the
+# original main.c, in the layout of Test/conformance.txt, and compares the two. Run by
+# "make baseline"; it needs the git history, so isn't part of "make test"
+#
+# Usage: sh Test/baseline.sh [revision [listing]]
+# - revision: The revision to take main.c from; by default the baseline the table-driven decoder
+#   replaced
+# - listing: The listing to compare with; by default Test/conformance.txt
+#
+# Modinfo:
+
+cd "$(dirname "$0")/.."
+
+REVISION=${1:-eecec54}
+LISTING=${2:-Test/conformance.txt}
+OUTDIR=Host
+TMP=$(mktemp -d)
+trap 'rm -rf "$TMP"' EXIT
+
+mkdir -p $OUTDIR
+git show "$REVISION:./main.c" | tr -d '\r' > "$TMP/main.c" || exit 1
+
+# The original is built as it was, so its warnings are of no interest
+#
+${CC:-cc} -w -I"$TMP" -o "$TMP/baseline" Test/baseline.c || exit 1
+"$TMP/baseline" > $OUTDIR/baseline.txt || exit 1
+
+diff -u $OUTDIR/baseline.txt "$LISTING" > $OUTDIR/baseline.diff
+echo "$(grep -c '^+[0-9]' $OUTDIR/baseline.diff) lines of $LISTING differ from the $REVISION decoder; see $OUTDIR/baseline.diff"
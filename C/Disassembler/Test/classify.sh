@@ -0,0 +1,132 @@
+#!/bin/sh
+#
+# Title:		Disassembler - Data Detection Test
+# Author:		Dean Belfield
+# Created:		17/10/2026
+# Last Updated:	17/10/2026
+#
+# Plants strings, pointer tables, fill and invalid opcodes in a random image, and checks that -d
+# lists them as data, that the source still reassembles to the same bytes, and that nothing
+# changes without it. Run by "make test"
+#
+# Modinfo:
+
+cd "$(dirname "$0")/.."
+
+DIS=Host/disassemble
+ASM=Host/assemble
+TMP=$(mktemp -d)
+trap 'rm -rf "$TMP"' EXIT
+
+failed=0
+
+# Report the result of a check
+# Parameters:
+# - $1: Description
+# - $2: 0 if it passed
+#
+result() {
+	if [ "$2" -eq 0 ]; then
+		echo "ok     $1"
+	else
+		echo "FAILED $1"
+		failed=1
+	fi
+}
+
+# Write bytes into the image
+# Parameters:
+# - $1: Offset in the image, in hex
+# - $2: The bytes, in hex and separated by commas
+#
+put() {
+	for b in $(echo "$2" | tr , ' '); do
+		printf "\\$(printf %o "0x$b")"
+	done | dd of="$TMP/image.bin" bs=1 seek=$((0x$1)) conv=notrunc 2>/dev/null
+}
+
+# Write text into the image
+# Parameters:
+# - $1: Offset in the image, in hex
+# - $2: The text
+#
+text() {
+	printf %s "$2" | dd of="$TMP/image.bin" bs=1 seek=$((0x$1)) conv=notrunc 2>/dev/null
+}
+
+LC_ALL=C awk 'BEGIN { srand(6); for(i = 0; i < 65536; i++) printf "%c", int(rand() * 256) }' > "$TMP/image.bin"
+
+text 1000 "Hello, world"; put 100C 00								# A string ending in a 0
+put 10FF 00; text 1100 "Line one"; put 1108 0D,0A; text 110A "Line two"; put 1112 0D,0A	# Lines ending in CR/LF
+put 1200 00,00,04,23,01,04,46,02,04,69,03,04,8C,04,04,AF,05,04		# A table of six addresses
+put 1300 FF,FF,FF,FF,FF,FF,FF,FF,FF,FF,FF,FF,FF,FF,FF,FF			# Fill
+put 1310 ED,FF														# An invalid opcode
+put 1312 5B,00														# A suffix on NOP
+put 1314 FF,FF,FF,FF,FF,FF,FF,FF									# Fill, to stop the decode
+
+$DIS -t raw -b '&040000' -a 1 -d "$TMP/image.bin" > "$TMP/detect.txt"
+
+# Check that the listing has a line
+# Parameters:
+# - $1: Description
+# - $2: The address, in hex
+# - $3: The instruction expected at it
+#
+check() {
+	grep "^$2 " "$TMP/detect.txt" | cut -c33- | sed 's/ *$//' | grep -qxF "$3"
+	result "$1" $?
+}
+
+check "string" 041000 'DB "Hello,"'
+check "string continued" 041006 'DB " world"'
+check "string terminator" 04100C 'DB &00'
+check "line" 041100 'DB "Line o"'
+check "line end" 041106 'DB "ne",&0D,&0A'
+check "next line" 04110A 'DB "Line t"'
+check "next line end" 041110 'DB "wo",&0D,&0A'
+check "pointer table" 041200 'DL &040000,&040123'
+check "pointer table continued" 04120C 'DL &04048C,&0405AF'
+check "fill" 041300 'DB &FF,&FF,&FF,&FF,&FF,&FF'
+check "invalid opcode" 041310 'DB &ED,&FF'
+check "unlikely suffix" 041312 'DB &5B,&00'
+
+# Without -d nothing changes, and the data isn't there
+#
+$DIS -t raw -b '&040000' -a 1 "$TMP/image.bin" > "$TMP/plain.txt"
+! grep -q -e 'DB "' -e 'DL ' "$TMP/plain.txt"
+result "listing unchanged without -d" $?
+
+# The listing is the same when it is decoded in parallel
+#
+$DIS -t raw -b '&040000' -a 1 -d -j 4 "$TMP/image.bin" | cmp -s - "$TMP/detect.txt"
+result "same listing [-j 4]" $?
+
+# Only code is decoded in flow mode: the code that jumps over the data is left alone
+#
+put 2000 C3,20,20,04												# JP &042020
+text 2004 "Skipped over"; put 2010 00
+put 2020 21,04,20,04,C9												# LD HL,&042004: RET
+$DIS -t raw -b '&040000' -a 1 -d -m flow -e '&042000' -s '&042000' -l 37 "$TMP/image.bin" > "$TMP/flow.txt"
+grep -q '^042004 .*DB "Skippe"$' "$TMP/flow.txt" &&
+	grep -q '^042020 .*LD HL,&042004$' "$TMP/flow.txt"
+result "flow" $?
+
+# The source reassembles to the same bytes
+#
+for syntax in zds ez80asm; do
+	for adl in 0 1; do
+		for mode in linear flow; do
+			$DIS -t raw -b '&040000' -a $adl -d -m $mode -c $syntax -o "$TMP/out.asm" "$TMP/image.bin" &&
+				$ASM "$TMP/out.asm" "$TMP/out.bin" &&
+				cmp -s "$TMP/image.bin" "$TMP/out.bin"
+			result "$syntax adl=$adl $mode round trip" $?
+		done
+	done
+done
+
+# Detection needs the whole image, so not a stream
+#
+! $DIS -t raw -b '&040000' -d - < "$TMP/image.bin" > /dev/null 2>&1
+result "stdin rejected" $?
+
+exit $failed
@@ -0,0 +1,164 @@
+/*
+ * Title:			Disassembler - Decoder Conformance Test (host build)
+ * Author:			Dean Belfield
+ * Created:			17/10/2026
+ * Last Updated:	17/10/2026
+ *
+ * Decodes every opcode in every prefix table, with and without each addressing mode suffix,
+ * in both ADL modes, and lists the results so that they can be compared with the golden listing
+ * in Test/conformance.txt. The length decoder is checked against the full decoder as it goes
+ *
+ * Modinfo:
+ * 17/10/2026:		Added the prefix chains that aren't in the tables, and other displacements in DD CB and FD CB
+ * 17/10/2026:		Clean with -Wextra
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "decode.h"
+#include "format.h"
+#include "source.h"
+#include "syntax.h"
+
+#define BASE			0x040000	// Address the instructions are decoded at
+#define DISPLACEMENT	0x81		// The displacement in DD CB d op and FD CB d op (-127)
+
+// The bytes that select each table, indexed by T_*; DD CB and FD CB are followed by the
+// displacement
+//
+static const unsigned char	t_prefix[T_COUNT][2] = {
+	{ 0x00, 0x00 }, { 0xCB, 0x00 }, { 0xED, 0x00 }, { 0xDD, 0x00 }, { 0xFD, 0x00 }, { 0xDD, 0xCB }, { 0xFD, 0xCB }
+};
+static const unsigned char	t_suffix[] = { 0x00, 0x40, 0x49, 0x52, 0x5B };	// Suffix byte, indexed by AM_*
+static const unsigned char	t_operands[] = { 0x81, 0x23, 0x45, 0x67 };		// The bytes after the opcode
+
+// Runs of prefixes and suffixes that no table decodes as they stand, each followed by every
+// opcode: a prefix after a prefix, a suffix after a suffix, and DD CB d and FD CB d with the
+// displacements at the ends of the range
+//
+static const unsigned char	t_chain[][4] = {		// Number of bytes, then the bytes
+	{ 2, 0xDD, 0xDD }, { 2, 0xDD, 0xED }, { 2, 0xDD, 0xFD }, { 2, 0xFD, 0xFD }, { 2, 0xFD, 0xED }, { 2, 0xFD, 0xDD },
+	{ 2, 0x40, 0x49 }, { 2, 0x52, 0x5B }, { 2, 0x5B, 0x5B }, { 3, 0x5B, 0x49, 0xDD },
+	{ 3, 0xDD, 0xCB, 0x00 }, { 3, 0xDD, 0xCB, 0x7F }, { 3, 0xDD, 0xCB, 0x80 },
+	{ 3, 0xFD, 0xCB, 0x00 }, { 3, 0xFD, 0xCB, 0x7F }, { 3, 0xFD, 0xCB, 0x80 }, { 3, 0xFD, 0xCB, 0xFF },
+};
+
+long	adl;					// ADL mode
+
+int		conform(long mode, const unsigned char * head, int count, int op);
+int		conformLine(long mode, long * address, unsigned char * bytes);
+
+// Returns:
+// - int: 0 if decodeLength and decodeOpcode agree on every instruction, otherwise 1
+//
+int main(void) {
+	unsigned char	head[4];
+	int				errors = 0;
+	int				mode, am, table, op, i, n;
+
+	syntaxSelect(SYNTAX_LISTING, HEX_DEFAULT);
+	for(mode = 1; mode >= 0; mode--) {
+		for(am = AM_NONE; am <= AM_LIL; am++) {
+			for(table = T_MAIN; table < T_COUNT; table++) {
+				n = 0;
+				if(am != AM_NONE) {
+					head[n++] = t_suffix[am];
+				}
+				if(t_prefix[table][0]) {
+					head[n++] = t_prefix[table][0];
+				}
+				if(t_prefix[table][1]) {
+					head[n++] = t_prefix[table][1];
+					head[n++] = DISPLACEMENT;
+				}
+				for(op = 0; op < 256; op++) {
+					errors += conform(mode, head, n, op);
+				}
+			}
+		}
+	}
+	for(mode = 1; mode >= 0; mode--) {
+		for(i = 0; i < (int)(sizeof(t_chain) / sizeof(t_chain[0])); i++) {
+			for(op = 0; op < 256; op++) {
+				errors += conform(mode, &t_chain[i][1], t_chain[i][0], op);
+			}
+		}
+	}
+	if(errors > 0) {
+		fprintf(stderr, "%d instructions where decodeLength and decodeOpcode disagree\n", errors);
+		return 1;
+	}
+	return 0;
+}
+
+// Decode the instructions up to and including an opcode and list them: the ADL mode, the bytes
+// decoded and the mnemonics. If the bytes before the opcode are an instruction, or aren't one,
+// the instructions after them are listed too
+// Parameters:
+// - mode: ADL mode
+// - head: The bytes before the opcode: suffix, prefixes and displacement
+// - count: Number of bytes before the opcode
+// - op: The opcode
+// Returns:
+// - int: The number of instructions where decodeLength disagrees with decodeOpcode
+//
+int conform(long mode, const unsigned char * head, int count, int op) {
+	unsigned char	bytes[16];
+	long			address = BASE;
+	int				errors = 0;
+
+	memset(bytes, 0, sizeof(bytes));
+	memcpy(bytes, head, count);
+	bytes[count] = op;
+	memcpy(&bytes[count + 1], t_operands, sizeof(t_operands));
+
+	source.window = bytes;
+	source.windowBase = BASE;
+	source.windowLength = sizeof(bytes);
+	adl = mode;
+	while(address <= BASE + count) {
+		errors += conformLine(mode, &address, &bytes[address - BASE]);
+	}
+	return errors;
+}
+
+// Decode one instruction and list it
+// Parameters:
+// - mode: ADL mode
+// - address: Pointer to the address counter
+// - bytes: The bytes at the address
+// Returns:
+// - int: 1 if decodeLength disagrees with decodeOpcode, otherwise 0
+//
+int conformLine(long mode, long * address, unsigned char * bytes) {
+	struct s_opcode	opcode;
+	char			line[FORMAT_LINE_MAX];
+	char *			t = line;
+	int				i, length;
+
+	decodeOpcode(address, &opcode);
+	length = decodeLength(bytes, mode, AM_NONE);
+
+	*t++ = '0' + mode;
+	*t++ = ' ';
+	for(i = 0; i < 8; i++) {
+		if(i < opcode.count) {
+			t = formatHex(t, opcode.byteData[i], 2);
+		}
+		else {
+			*t++ = ' ';
+			*t++ = ' ';
+		}
+		*t++ = ' ';
+	}
+	t = formatString(t, opcode.text);
+	if(length != opcode.count) {
+		t = formatString(t, " ; decodeLength ");
+		*t++ = '0' + length;
+	}
+	*t++ = '\n';
+	*t = '\0';
+	fputs(line, stdout);
+	return length != opcode.count;
+}
@@ -0,0 +1,127 @@
+#!/bin/sh
+#
+# Title:		Disassembler - Cycle Count Test
+# Author:		Dean Belfield
+# Created:		17/10/2026
+# Last Updated:	17/10/2026
+#
+# Checks the cycle counts listed with -z against counts worked out by hand, and that the block
+# totals add up to the instructions in them. Run by "make test"
+#
+# The expected counts are from the instruction tables in Zilog's eZ80 CPU User Manual (UM0077),
+# for no wait states; each comment breaks the count down into the cycles the manual lists, with
+# ADL/Z80 where a word is 3 bytes in one and 2 in the other
+#
+# Modinfo:
+# 17/10/2026:	A 16/24-bit ADD, ADC or SBC takes no internal cycle; the source of each count is given
+
+cd "$(dirname "$0")/.."
+
+DIS=Host/disassemble
+TMP=$(mktemp -d)
+trap 'rm -rf "$TMP"' EXIT
+
+LC_ALL=C awk 'BEGIN { srand(5); for(i = 0; i < 65536; i++) printf "%c", int(rand() * 256) }' > "$TMP/image.bin"
+
+failed=0
+
+# Report the result of a check
+# Parameters:
+# - $1: Description
+# - $2: 0 if it passed
+#
+result() {
+	if [ "$2" -eq 0 ]; then
+		echo "ok     $1"
+	else
+		echo "FAILED $1"
+		failed=1
+	fi
+}
+
+# Disassemble an instruction in ADL mode with its cycle counts, and compare them
+# Parameters:
+# - $1: The bytes, in hex and separated by commas
+# - $2: The cycle counts expected
+#
+check() {
+	for b in $(echo "$1" | tr , ' '); do
+		printf "\\$(printf %o "0x$b")"
+	done > "$TMP/op.bin"
+	line=$($DIS -t raw -b '&040000' -a 1 -z cycles "$TMP/op.bin" | head -1)
+	test "${line#*; }" = "$2"
+	result "$(echo "$line" | cut -c33- | sed 's/ *; ADL .*//')" $?
+}
+
+check 00 "ADL 1 Z80 1"									# NOP: fetch 1
+check 3E,01 "ADL 2 Z80 2"								# LD A,n: fetch 2
+check 21,00,10,04 "ADL 4 Z80 3"							# LD HL,nn: fetch 4/3
+check 7E "ADL 2 Z80 2"									# LD A,(HL): fetch 1, read 1
+check 36,55 "ADL 3 Z80 3"								# LD (HL),n: fetch 2, write 1
+check 34 "ADL 4 Z80 4"									# INC (HL): fetch 1, read 1, write 1, internal 1
+check 2A,00,20,04 "ADL 7 Z80 5"							# LD HL,(nn): fetch 4/3, read 3/2
+check ED,4B,00,20,04 "ADL 8 Z80 6"						# LD BC,(nn): fetch 5/4, read 3/2
+check DD,7E,05 "ADL 4 Z80 4"							# LD A,(IX+d): fetch 3, read 1
+check DD,CB,05,C6 "ADL 7 Z80 7"							# SET 0,(IX+d): fetch 4, read 1, write 1, internal 1
+check C5 "ADL 4 Z80 3"									# PUSH BC: fetch 1, write 3/2
+check E3 "ADL 7 Z80 5"									# EX (SP),HL: fetch 1, read 3/2, write 3/2
+check 09 "ADL 1 Z80 1"									# ADD HL,BC: fetch 1, no internal cycle
+check ED,4A "ADL 2 Z80 2"								# ADC HL,BC: fetch 2, no internal cycle
+check DD,09 "ADL 2 Z80 2"								# ADD IX,BC: fetch 2
+check ED,6C "ADL 6 Z80 6"								# MLT HL: fetch 2, internal 4
+check 10,FE "ADL 4/3 Z80 4/3"							# DJNZ: fetch 2, internal 1, refill 1 if taken
+check 18,FE "ADL 3 Z80 3"								# JR: fetch 2, refill 1
+check 28,FE "ADL 3/2 Z80 3/2"							# JR Z: fetch 2, refill 1 if taken
+check C3,00,00,04 "ADL 5 Z80 4"							# JP nn: fetch 4/3, refill 1
+check CA,00,00,04 "ADL 5/4 Z80 4/3"						# JP Z,nn: fetch 4/3, refill 1 if taken
+check E9 "ADL 2 Z80 2"									# JP (HL): fetch 1, refill 1
+check CD,00,00,04 "ADL 8 Z80 6"							# CALL nn: fetch 4/3, write 3/2, refill 1
+check CC,00,00,04 "ADL 8/4 Z80 6/3"						# CALL Z,nn: fetch 4/3, and if taken write 3/2, refill 1
+check 49,CD,00,10 "ADL 9 Z80 9"							# CALL.LIS: fetch 4, write 2 on SPS and 1 on SPL, mode 1, refill 1
+check C9 "ADL 5 Z80 4"									# RET: fetch 1, read 3/2, refill 1
+check C8 "ADL 5/1 Z80 4/1"								# RET Z: fetch 1, and if taken read 3/2, refill 1
+check FF "ADL 5 Z80 4"									# RST &38: fetch 1, write 3/2, refill 1
+check ED,B0 "ADL 5/4 Z80 5/4"							# LDIR: fetch 2, read 1, write 1, refill 1 to repeat
+check ED,B1 "ADL 5/4 Z80 5/4"							# CPIR: fetch 2, read 1, internal 1, refill 1 to repeat
+check DB,10 "ADL 3 Z80 3"								# IN A,(n): fetch 2, read 1
+
+# The cycle counts are a comment on the end of the line, and nothing else changes
+#
+$DIS -t raw -b '&040000' "$TMP/image.bin" > "$TMP/plain.txt"
+$DIS -t raw -b '&040000' -z cycles "$TMP/image.bin" | sed 's/ *; ADL .*//; s/ *$//' > "$TMP/cycles.txt"
+sed 's/ *$//' "$TMP/plain.txt" | cmp -s - "$TMP/cycles.txt"
+result "listing unchanged" $?
+
+# The blocks add up to the instructions in them, and end at every jump, call, return and label
+#
+for options in "" "-x labels" "-a 0"; do
+	$DIS -t raw -b '&040000' -z blocks $options "$TMP/image.bin" | awk '
+		/; Block at/ {
+			split($NF, z, "/"); split($(NF - 2), a, "/")
+			if(a[length(a)] != adl || z[length(z)] != z80) bad++
+			blocks++; adl = z80 = 0; last = 0; next
+		}
+		/:$/ { if(adl) bad++; next }
+		/; ADL/ {
+			if(last) bad++
+			split($NF, z, "/"); split($(NF - 2), a, "/")
+			adl += a[length(a)]; z80 += z[length(z)]
+			last = substr($0, 33) ~ /^(JP|JR|CALL|RET|RETI|RETN|RST|DJNZ|HALT|SLP)[ .]/
+		}
+		END { exit bad > 0 || blocks == 0 || adl > 0 }'
+	result "blocks add up [$options]" $?
+done
+
+# Binary records grow to RECORD_SIZE_CYCLES, and JSON has the counts for every instruction (but
+# not data or bytes that aren't one) and the block totals
+#
+lines=$($DIS -t raw -b '&040000' -f json "$TMP/image.bin" | wc -l)
+size=$($DIS -t raw -b '&040000' -f binary -z cycles "$TMP/image.bin" | wc -c)
+test "$size" -eq $(((lines + 1) * 36))
+result "binary record size" $?
+$DIS -t raw -b '&040000' -f json -z blocks "$TMP/image.bin" > "$TMP/blocks.json"
+test "$(grep -c '"cycles":{"adl":' "$TMP/blocks.json")" -eq "$(grep -vc -e '"mnemonic":"DB"' -e '"mnemonic":""' "$TMP/blocks.json")" &&
+	test "$(grep -c '^{"block":' "$TMP/blocks.json")" -eq "$($DIS -t raw -b '&040000' -z blocks "$TMP/image.bin" | grep -c '; Block at')"
+result "json" $?
+
+exit $failed
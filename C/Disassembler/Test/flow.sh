@@ -0,0 +1,89 @@
+#!/bin/sh
+#
+# Title:		Disassembler - Flow Mode Test
+# Author:		Dean Belfield
+# Created:		17/10/2026
+# Last Updated:	17/10/2026
+#
+# Checks that flow mode decodes the destination of a JP, CALL or RST with a suffix in the ADL
+# mode the IS/IL half of the suffix sets, and that the cross-reference index and the graph find
+# the same destinations. Run by "make test"
+#
+# Modinfo:
+
+cd "$(dirname "$0")/.."
+
+DIS=Host/disassemble
+TMP=$(mktemp -d)
+trap 'rm -rf "$TMP"' EXIT
+
+failed=0
+
+# Report the result of a check
+# Parameters:
+# - $1: Description
+# - $2: 0 if it passed
+#
+result() {
+	if [ "$2" -eq 0 ]; then
+		echo "ok     $1"
+	else
+		echo "FAILED $1"
+		failed=1
+	fi
+}
+
+# Write bytes into the image
+# Parameters:
+# - $1: Offset in the image, in hex
+# - $2: The bytes, in hex and separated by commas
+#
+put() {
+	for b in $(echo "$2" | tr , ' '); do
+		printf "\\$(printf %o "0x$b")"
+	done | dd of="$TMP/image.bin" bs=1 seek=$((0x$1)) conv=notrunc 2>/dev/null
+}
+
+# ADL code that calls, restarts and jumps into code in the other mode and its own. Each
+# destination starts with LD HL,nn, which is 3 bytes in Z80 mode and 4 in ADL mode
+#
+head -c 256 /dev/zero > "$TMP/image.bin"
+put 00 49,CD,10,00													# CALL.LIS &0010: Z80 mode
+put 04 49,FF														# RST.LIS &38: Z80 mode, in this segment
+put 06 52,C3,20,00,04												# JP.SIL &040020: ADL mode
+put 10 21,34,12,C9													# LD HL,&1234: RET
+put 20 21,56,34,12,C9												# LD HL,&123456: RET
+put 38 21,78,56,C9													# LD HL,&5678: RET
+put 40 40,C3,50,00													# From Z80 mode: JP.SIS &0050, stays in Z80 mode
+put 50 21,9A,78,C9													# LD HL,&789A: RET
+
+# Check the bytes listed at a destination
+# Parameters:
+# - $1: Description
+# - $2: The address, in hex
+# - $3: The bytes expected, in hex and separated by spaces
+#
+check() {
+	grep -q "^$2 $3  " "$TMP/flow.txt"
+	result "$1" $?
+}
+
+$DIS -t raw -b '&040000' -a 1 -m flow -x index "$TMP/image.bin" > "$TMP/flow.txt"
+check "CALL.LIS to Z80 mode" 040010 "21 34 12"
+check "RST.LIS to Z80 mode" 040038 "21 78 56"
+check "JP.SIL to ADL mode" 040020 "21 56 34 12"
+grep -q "^L040038 C:040004$" "$TMP/flow.txt"
+result "RST.LIS index" $?
+
+$DIS -t raw -b '&040000' -a 0 -m flow -e '&040040' "$TMP/image.bin" > "$TMP/flow.txt"
+check "JP.SIS from Z80 mode" 040050 "21 9A 78"
+
+# The graph has a block at each destination
+#
+$DIS -t raw -b '&040000' -a 1 -m flow -g cfg -f adjacency "$TMP/image.bin" > "$TMP/graph.txt"
+for address in 040010 040020 040038; do
+	grep -q "^$address " "$TMP/graph.txt"
+	result "graph block at $address" $?
+done
+
+exit $failed
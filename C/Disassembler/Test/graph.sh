@@ -0,0 +1,98 @@
+#!/bin/sh
+#
+# Title:		Disassembler - Graph Test
+# Author:		Dean Belfield
+# Created:		17/10/2026
+# Last Updated:	17/10/2026
+#
+# Checks the control flow and call graphs written with -g against a small image worked out by
+# hand, and that the graphs of a random image are consistent with its listing. Run by "make test"
+#
+# Modinfo:
+
+cd "$(dirname "$0")/.."
+
+DIS=Host/disassemble
+TMP=$(mktemp -d)
+trap 'rm -rf "$TMP"' EXIT
+
+LC_ALL=C awk 'BEGIN { srand(7); for(i = 0; i < 65536; i++) printf "%c", int(rand() * 256) }' > "$TMP/image.bin"
+
+# 040000 LD A,&01; CALL &040010; JR Z,&04000A; RET; NOP; JP &040000; NOP; NOP; XOR A,A; RET
+#
+printf '\076\001\315\020\000\004\050\002\311\000\303\000\000\004\000\000\257\311' > "$TMP/small.bin"
+
+failed=0
+
+# Report the result of a check
+# Parameters:
+# - $1: Description
+# - $2: 0 if it passed
+#
+result() {
+	if [ "$2" -eq 0 ]; then
+		echo "ok     $1"
+	else
+		echo "FAILED $1"
+		failed=1
+	fi
+}
+
+# Write the graph of the small image as an adjacency list, and compare it
+# Parameters:
+# - $1: Description
+# - $2: The options
+# - $3: The lines expected, separated by semicolons
+#
+check() {
+	$DIS -t raw -b '&040000' -f adjacency $2 "$TMP/small.bin" > "$TMP/out.txt"
+	echo "$3" | tr ';' '\n' | cmp -s - "$TMP/out.txt"
+	result "$1" $?
+}
+
+check "cfg" "-g cfg" "040000 3 j04000A f040008;040008 1;040009 1 f04000A;04000A 1 j040000;04000E 2 f040010;040010 2"
+check "cfg flow" "-g cfg -m flow" "040000 3 j04000A f040008;040008 1;04000A 1 j040000;040010 2"
+check "calls" "-g calls" "040000 3 040010;040009 1;04000E 1;040010 1"
+check "calls entry" "-g calls -e &04000E" "04000E 1"
+
+# The blocks hold every instruction in the listing once, in address order, and each edge goes to
+# the start of a block, or somewhere that isn't the start of an instruction
+#
+for mode in linear flow; do
+	$DIS -t raw -b '&040000' -m $mode -f json "$TMP/image.bin" | grep -v -e '"mnemonic":"DB"' -e '"mnemonic":""' |
+		sed -n 's/^{"address":\([0-9]*\),.*/\1/p' > "$TMP/code.txt"
+	$DIS -t raw -b '&040000' -m $mode -g cfg -f adjacency "$TMP/image.bin" > "$TMP/cfg.txt"
+	awk '
+		FNR == NR { code[sprintf("%06X", $1)] = 1; count++; next }
+		{ block[$1] = 1; sum += $2; if($1 "" <= last || !($1 in code)) bad++; last = $1; for(i = 3; i <= NF; i++) edge[++edges] = $i }
+		END {
+			for(i = 1; i <= edges; i++) {
+				a = substr(edge[i], 2)
+				if(!(a in block) && (substr(edge[i], 1, 1) == "f" || a in code)) bad++
+			}
+			exit bad > 0 || FNR == 0 || sum != count
+		}' "$TMP/code.txt" "$TMP/cfg.txt"
+	result "cfg covers the listing [$mode]" $?
+done
+
+# The call graph has every block in one function, and a callee only once per caller
+#
+$DIS -t raw -b '&040000' -g cfg -f adjacency "$TMP/image.bin" > "$TMP/cfg.txt"
+$DIS -t raw -b '&040000' -g calls -f adjacency "$TMP/image.bin" | awk -v nodes=$(wc -l < "$TMP/cfg.txt") '
+	{ sum += $2; delete seen; for(i = 3; i <= NF; i++) if(seen[$i]++) bad++ }
+	END { exit bad > 0 || sum != nodes }'
+result "calls covers the blocks" $?
+
+# The DOT has a node for each block and an edge for each successor
+#
+for type in cfg calls; do
+	$DIS -t raw -b '&040000' -g $type -f adjacency "$TMP/image.bin" > "$TMP/adj.txt"
+	$DIS -t raw -b '&040000' -g $type -f dot "$TMP/image.bin" > "$TMP/graph.dot"
+	head -1 "$TMP/graph.dot" | grep -q "^digraph $type {\$" &&
+		test "$(tail -1 "$TMP/graph.dot")" = "}" &&
+		test "$(grep -c '^	[bf][0-9A-F]* \[label=' "$TMP/graph.dot")" -eq "$(wc -l < "$TMP/adj.txt")" &&
+		test "$(grep -c ' -> ' "$TMP/graph.dot")" -eq "$(awk '{ n += NF - 2 } END { print n }' "$TMP/adj.txt")"
+	result "dot [$type]" $?
+done
+
+exit $failed
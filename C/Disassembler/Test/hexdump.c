@@ -0,0 +1,109 @@
+/*
+ * Title:			Disassembler - Hex Dump Test (host build)
+ * Author:			Dean Belfield
+ * Created:			17/10/2026
+ * Last Updated:	17/10/2026
+ *
+ * Checks the layout of the hex dump, and that every engine the CPU supports formats every byte
+ * value, in every position of a row, the same as the scalar engine. Run by "make test"
+ *
+ * Modinfo:
+ * 17/10/2026:		Clean with -Wextra
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "dump.h"
+
+#define ROWS		4096		// Random rows compared for each engine
+
+static const char *	t_engine[] = { "scalar", "sse2", "avx2" };	// Indexed by DUMP_*
+
+int		check(const char * name, const char * expected, long address, const unsigned char * bytes, int count);
+int		compare(int engine, const unsigned char * bytes, long length);
+
+// Returns:
+// - int: 0 if every check passed, otherwise 1
+//
+int main(void) {
+	static unsigned char	bytes[(256 + ROWS) * DUMP_ROW];
+	unsigned long			seed = 1;
+	int						i, engine, failed = 0;
+
+	for(i = 0; i < 16; i++) {
+		bytes[i] = i * 17;
+		bytes[i + 16] = 0x20 + i * 6;
+	}
+	dumpSelect(DUMP_SCALAR);
+	failed |= check("layout", "040000: 00112233445566778899AABBCCDDEEFF ..\"3DUfw........\n", 0x040000, bytes, 16);
+	failed |= check("printable", "ABCDEF: 20262C32383E444A50565C62686E747A  &,28>DJPV\\bhntz\n", 0xABCDEF, &bytes[16], 16);
+	failed |= check("short row", "000010: 001122                           ..\"\n", 0x10, bytes, 3);
+
+	//
+	// Every byte value in every column, then random rows
+	//
+	for(i = 0; i < 256 * DUMP_ROW; i++) {
+		bytes[i] = i / DUMP_ROW + i % DUMP_ROW;
+	}
+	for(; i < (int)sizeof(bytes); i++) {
+		seed = seed * 1103515245 + 12345;
+		bytes[i] = seed >> 16;
+	}
+	for(engine = DUMP_SSE2; engine < DUMP_COUNT; engine++) {
+		if(dumpSelect(engine) < 0) {
+			printf("skip   %s (not supported)\n", t_engine[engine]);
+			continue;
+		}
+		failed |= compare(engine, bytes, sizeof(bytes));
+	}
+	return failed;
+}
+
+// Check one line of the dump
+// Parameters:
+// - name: Description
+// - expected: The line expected
+// - address: Address of the first byte
+// - bytes: The bytes
+// - count: Number of bytes
+// Returns:
+// - int: 0 if OK, otherwise 1
+//
+int check(const char * name, const char * expected, long address, const unsigned char * bytes, int count) {
+	char	line[DUMP_LINE_MAX];
+
+	if(dumpLine(line, address, bytes, count) == (int)strlen(expected) && strcmp(line, expected) == 0) {
+		printf("ok     %s\n", name);
+		return 0;
+	}
+	printf("FAILED %s\n%s%s", name, expected, line);
+	return 1;
+}
+
+// Compare an engine with the scalar engine, a row at a time
+// Parameters:
+// - engine: The engine (DUMP_*)
+// - bytes: The bytes
+// - length: Number of bytes, a multiple of DUMP_ROW
+// Returns:
+// - int: 0 if OK, otherwise 1
+//
+int compare(int engine, const unsigned char * bytes, long length) {
+	char	expected[DUMP_LINE_MAX];
+	char	line[DUMP_LINE_MAX];
+	long	i;
+
+	for(i = 0; i < length; i += DUMP_ROW) {
+		dumpSelect(DUMP_SCALAR);
+		dumpLine(expected, i, &bytes[i], DUMP_ROW);
+		dumpSelect(engine);
+		dumpLine(line, i, &bytes[i], DUMP_ROW);
+		if(strcmp(line, expected) != 0) {
+			printf("FAILED %s\n%s%s", t_engine[engine], expected, line);
+			return 1;
+		}
+	}
+	printf("ok     %s\n", t_engine[engine]);
+	return 0;
+}
@@ -0,0 +1,68 @@
+#!/bin/sh
+#
+# Title:		Disassembler - Intel HEX Test
+# Author:		Dean Belfield
+# Created:		17/10/2026
+# Last Updated:	17/10/2026
+#
+# Checks that an Intel HEX file is listed the same as the raw image it holds, and that records
+# that are cut short, have a bad digit or checksum, or the wrong size are rejected. Run by
+# "make test"
+#
+# Modinfo:
+
+cd "$(dirname "$0")/.."
+
+DIS=Host/disassemble
+TMP=$(mktemp -d)
+trap 'rm -rf "$TMP"' EXIT
+
+failed=0
+
+# Report the result of a check
+# Parameters:
+# - $1: Description
+# - $2: 0 if it passed
+#
+result() {
+	if [ "$2" -eq 0 ]; then
+		echo "ok     $1"
+	else
+		echo "FAILED $1"
+		failed=1
+	fi
+}
+
+# Check that a file is rejected
+# Parameters:
+# - $1: Description
+# - $2: The file contents, as printf formats them
+#
+reject() {
+	printf "$2" > "$TMP/bad.hex"
+	! $DIS -t hex "$TMP/bad.hex" > /dev/null 2>&1
+	result "$1" $?
+}
+
+# The records of a file: an extended linear address of &04, and LD HL,&1234 with a byte after it
+#
+EXT=':020000040004F6'
+DATA=':040000002134120095'
+END=':00000001FF'
+
+printf '%s\r\n%s\r\n%s\r\n' $EXT $DATA $END > "$TMP/good.hex"
+printf '\041\064\022\000' > "$TMP/good.bin"
+$DIS -t hex "$TMP/good.hex" > "$TMP/hex.txt" &&
+	$DIS -t raw -b '&040000' "$TMP/good.bin" | cmp -s - "$TMP/hex.txt"
+result "same as the raw image" $?
+
+reject "record cut short in the data" "$EXT\n:04000000213412"
+reject "record cut short in the header" "$EXT\n:0400"
+reject "record with only a colon" "$EXT\n:"
+reject "byte count cut short" "$EXT\n:0"
+reject "bad digit in the address" "$EXT\n:04G0000021341200FF\n$END\n"
+reject "bad digit in the data" "$EXT\n:040000002134G20095\n$END\n"
+reject "bad checksum" "$EXT\n:040000002134120096\n$END\n"
+reject "extended address of the wrong size" ":0100000400FB\n$DATA\n$END\n"
+
+exit $failed
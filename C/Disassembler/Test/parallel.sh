@@ -0,0 +1,86 @@
+#!/bin/sh
+#
+# Title:		Disassembler - Parallel Test
+# Author:		Dean Belfield
+# Created:		17/10/2026
+# Last Updated:	17/10/2026
+#
+# Disassembles an image of more than two rounds of chunks with one thread and with four, and checks
+# the listings are the same. Runs of DD, FD and ED prefixes and .LIL suffixes are planted across
+# each chunk edge, so the threads start part way through an instruction and disassembleStitch has
+# to line them up. Run by "make test"
+#
+# Modinfo:
+
+cd "$(dirname "$0")/.."
+
+DIS=Host/disassemble
+TMP=$(mktemp -d)
+trap 'rm -rf "$TMP"' EXIT
+
+CHUNK_SIZE=$((0x40000))									# As in host.c
+CHUNKS=5												# Two rounds of four threads, the second short
+
+LC_ALL=C awk -v n=$((CHUNK_SIZE * CHUNKS + 0x1234)) 'BEGIN { srand(7); for(i = 0; i < n; i++) printf "%c", int(rand() * 256) }' > "$TMP/image.bin"
+
+failed=0
+
+# Report the result of a check
+# Parameters:
+# - $1: Description
+# - $2: 0 if it passed
+#
+result() {
+	if [ "$2" -eq 0 ]; then
+		echo "ok     $1"
+	else
+		echo "FAILED $1"
+		failed=1
+	fi
+}
+
+# Write bytes into the image
+# Parameters:
+# - $1: Offset in the image
+# - $2: The bytes, in hex and separated by commas
+#
+put() {
+	for b in $(echo "$2" | tr , ' '); do
+		printf "\\$(printf %o "0x$b")"
+	done | dd of="$TMP/image.bin" bs=1 seek=$1 conv=notrunc 2>/dev/null
+}
+
+# Prefixes and suffixes that run on for longer than an instruction: a thread that starts in them
+# decodes different instructions to one that reaches them from before the edge, until the two
+# line up again
+#
+RUN=DD,FD,DD,FD,DD,FD,DD,FD,DD,21,00,00,04,ED,ED,ED,4B,00,10,04,5B,49,52,40,5B,CD,00,00,04
+RUN=$RUN,FD,CB,05,C6,5B,DD,CB,FE,1E,ED,5B,ED,43,00,20,04,49,ED,ED,DD,FD,ED,B0,52,DD,36,05,AA
+
+# Plant the run across each edge, with the edge at a different byte of it each time
+#
+for i in $(seq 1 $CHUNKS); do
+	put $((CHUNK_SIZE * i - 3 - i * 7)) $RUN
+done
+
+# Disassemble with one thread and with four, and compare
+# Parameters:
+# - $1: Description
+# - The rest: Options for the disassembler
+#
+check() {
+	name=$1
+	shift
+	$DIS -t raw -b '&040000' -j 1 "$@" "$TMP/image.bin" > "$TMP/serial.txt" &&
+		$DIS -t raw -b '&040000' -j 4 "$@" "$TMP/image.bin" > "$TMP/parallel.txt" &&
+		cmp -s "$TMP/serial.txt" "$TMP/parallel.txt"
+	result "$name" $?
+}
+
+check "-j 4 [-a 1]" -a 1
+check "-j 4 [-a 0]" -a 0
+check "-j 4 [-s &040005]" -a 1 -s '&040005'
+check "-j 4 [-d]" -a 1 -d
+check "-j 4 [-f json]" -a 1 -f json
+
+exit $failed
@@ -0,0 +1,62 @@
+#!/bin/sh
+#
+# Title:		Disassembler - Incremental Re-disassembly Test
+# Author:		Dean Belfield
+# Created:		17/10/2026
+# Last Updated:	17/10/2026
+#
+# Patches an image on the command line (-p), so that the listing and cross-references are
+# updated incrementally, and checks the listing is the same as that of an image patched before
+# it was disassembled. Run by "make test"
+#
+# Modinfo:
+
+cd "$(dirname "$0")/.."
+
+DIS=Host/disassemble
+TMP=$(mktemp -d)
+trap 'rm -rf "$TMP"' EXIT
+
+LC_ALL=C awk 'BEGIN { srand(3); for(i = 0; i < 65536; i++) printf "%c", int(rand() * 256) }' > "$TMP/image.bin"
+
+failed=0
+
+# Patch the image both ways and compare the listings
+# Parameters:
+# - $1: Description
+# - $2: Options for the disassembler
+# - The rest: Patches, each an offset into the image then the bytes, in hex and separated by commas
+#
+check() {
+	name=$1
+	options=$2
+	shift 2
+	cp "$TMP/image.bin" "$TMP/patched.bin"
+	args=
+	for p in "$@"; do
+		offset=$(printf %d "0x${p%%,*}")
+		bytes=${p#*,}
+		args="$args -p &$(printf %X $((offset + 0x40000))),&$(echo "$bytes" | sed 's/,/,\&/g')"
+		for b in $(echo "$bytes" | tr , ' '); do
+			printf "\\$(printf %o "0x$b")"
+		done | dd of="$TMP/patched.bin" bs=1 seek="$offset" conv=notrunc 2>/dev/null
+	done
+	if $DIS -t raw -b '&040000' $options $args "$TMP/image.bin" > "$TMP/incremental.txt" &&
+		$DIS -t raw -b '&040000' $options "$TMP/patched.bin" > "$TMP/full.txt" &&
+		cmp -s "$TMP/incremental.txt" "$TMP/full.txt"; then
+		echo "ok     $name"
+	else
+		echo "FAILED $name"
+		failed=1
+	fi
+}
+
+for options in "" "-x index" "-c zds" "-s &040100 -l &F000 -x labels"; do
+	check "jump [$options]" "$options" 1000,C3,00,20,04
+	check "prefixes [$options]" "$options" 2000,DD,DD,FD,ED,CB,5B
+	check "label removed [$options]" "$options" 1000,C3,00,20,04 1000,00,00,00,00
+	check "several [$options]" "$options" 0,18,FE 3000,5B,CD,10,00,04 8000,CB 8002,40,49 FFFE,DD,CB
+	check "end [$options]" "$options" FFF0,5B,C3 FFFF,ED
+done
+
+exit $failed
@@ -0,0 +1,56 @@
+#!/bin/sh
+#
+# Title:		Disassembler - Round Trip Test
+# Author:		Dean Belfield
+# Created:		17/10/2026
+# Last Updated:	17/10/2026
+#
+# Disassembles images to source in each syntax and hex style, reassembles the source with the
+# test assembler, and checks that the bytes are the same. Run by "make test"
+#
+# Modinfo:
+
+cd "$(dirname "$0")/.."
+
+DIS=Host/disassemble
+ASM=Host/assemble
+TMP=$(mktemp -d)
+trap 'rm -rf "$TMP"' EXIT
+
+# Deterministic random images, so that every opcode and prefix chain turns up
+#
+LC_ALL=C awk 'BEGIN { srand(1); for(i = 0; i < 65536; i++) printf "%c", int(rand() * 256) }' > "$TMP/random1.bin"
+LC_ALL=C awk 'BEGIN { srand(2); for(i = 0; i < 65536; i++) printf "%c", int(rand() * 256) }' > "$TMP/random2.bin"
+
+failed=0
+
+# Disassemble an image to source, reassemble it and compare
+# Parameters:
+# - $1: Description
+# - $2: The image
+# - The rest: Options for the disassembler
+#
+check() {
+	name=$1
+	image=$2
+	shift 2
+	if $DIS -t raw -b '&040000' "$@" -o "$TMP/out.asm" "$image" &&
+		$ASM "$TMP/out.asm" "$TMP/out.bin" &&
+		cmp -s "$image" "$TMP/out.bin"; then
+		echo "ok     $name"
+	else
+		echo "FAILED $name"
+		failed=1
+	fi
+}
+
+for syntax in zds ez80asm; do
+	for adl in 0 1; do
+		for hex in '&' '$' 0x h; do
+			check "$syntax adl=$adl hex=$hex linear" "$TMP/random1.bin" -c $syntax -a $adl -r $hex
+		done
+		check "$syntax adl=$adl flow" "$TMP/random2.bin" -c $syntax -a $adl -m flow
+	done
+done
+
+exit $failed
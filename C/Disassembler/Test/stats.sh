@@ -0,0 +1,102 @@
+#!/bin/sh
+#
+# Title:		Disassembler - Instruction Mix Test
+# Author:		Dean Belfield
+# Created:		17/10/2026
+# Last Updated:	17/10/2026
+#
+# Checks the counts in the instruction mix (-m stats) against a small image worked out by hand,
+# and against the instructions in the listing of a random image. Run by "make test"
+#
+# Modinfo:
+
+cd "$(dirname "$0")/.."
+
+DIS=Host/disassemble
+TMP=$(mktemp -d)
+trap 'rm -rf "$TMP"' EXIT
+
+LC_ALL=C awk 'BEGIN { srand(9); for(i = 0; i < 65536; i++) printf "%c", int(rand() * 256) }' > "$TMP/image.bin"
+
+# 040000 LD.SIS HL,&1000; LD HL,&040000; MLT BC; LEA IX,IX+5; LD A,(IX+5); SET 0,(IY+5);
+# LD A,&01; JR &040014; then the first two bytes of a JP
+#
+printf '\100\041\000\020\041\000\000\004\355\114\355\062\005\335\176\005\375\313\005\306\076\001\030\376\303\000' > "$TMP/small.bin"
+
+failed=0
+
+# Report the result of a check
+# Parameters:
+# - $1: Description
+# - $2: 0 if it passed
+#
+result() {
+	if [ "$2" -eq 0 ]; then
+		echo "ok     $1"
+	else
+		echo "FAILED $1"
+		failed=1
+	fi
+}
+
+# Find a count in the report of the small image, and compare it
+# Parameters:
+# - $1: The section
+# - $2: The name
+# - $3: The count expected
+#
+check() {
+	count=$(awk -v section="$1" -v name="$2" '
+		/^[^ ]/ { inside = $0 == section || section == "" }
+		inside && substr($0, 3, 16) == sprintf("%-16s", name) { print substr($0, 19, 12) + 0 }' "$TMP/small.txt")
+	test "$count" = "$3"
+	result "$1 $2" $?
+}
+
+$DIS -t raw -b '&040000' -m stats "$TMP/small.bin" > "$TMP/small.txt"
+check "" "Bytes" 26
+check "" "Instructions" 8
+check "" "Data" 2
+check "Mnemonics" "LD" 4
+check "Mnemonics" "MLT" 1
+check "Prefixes" "CB" 1
+check "Prefixes" "ED" 2
+check "Prefixes" "DD" 1
+check "Prefixes" "FD" 1
+check "Suffixes" ".SIS" 1
+check "Suffixes" ".LIL" 0
+check "eZ80 only" "LEA" 1
+check "eZ80 only" "Total" 2
+check "Operands" "Byte" 1
+check "Operands" "Word (16-bit)" 1
+check "Operands" "Word (24-bit)" 1
+check "Operands" "Displacement" 3
+check "Operands" "Relative" 1
+
+# Every mnemonic and suffix is counted as often as it is in the listing, in either ADL mode, and
+# the same whether the image is mapped in small windows or read from stdin
+#
+for mode in 0 1; do
+	$DIS -t raw -b '&040000' -a $mode -f json "$TMP/image.bin" > "$TMP/image.json"
+	$DIS -t raw -b '&040000' -a $mode -m stats "$TMP/image.bin" > "$TMP/stats.txt"
+	sed -n 's/.*"suffix":"\([^"]*\)".*"mnemonic":"\([^"]*\)".*/\2\n\1/p' "$TMP/image.json" | awk '
+		FNR == NR {
+			if(/^[^ ]/) section = $0
+			else if(section == "Mnemonics" || section == "Suffixes") expected[section substr($0, 3, 16)] = substr($0, 19, 12) + 0
+			else if($1 == "Invalid") expected["Mnemonics" sprintf("%-16s", "")] = substr($0, 19, 12) + 0
+			next
+		}
+		FNR % 2 == 1 { if($0 != "DB") counted["Mnemonics" sprintf("%-16s", $0)]++; next }
+		$0 != "" { counted["Suffixes" sprintf("%-16s", "." $0)]++ }
+		END {
+			for(k in counted) if(counted[k] != expected[k] + 0) bad++
+			for(k in expected) if(counted[k] + 0 != expected[k]) bad++
+			exit bad > 0
+		}' "$TMP/stats.txt" -
+	result "matches the listing [-a $mode]" $?
+done
+$DIS -t raw -b '&040000' -m stats -w 4096 "$TMP/image.bin" | cmp -s - "$TMP/stats.txt" &&
+	$DIS -b '&040000' -m stats - < "$TMP/image.bin" | cmp -s - "$TMP/stats.txt"
+result "windows and stdin" $?
+
+exit $failed
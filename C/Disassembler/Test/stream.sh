@@ -0,0 +1,55 @@
+#!/bin/sh
+#
+# Title:		Disassembler - Stream Test
+# Author:		Dean Belfield
+# Created:		17/10/2026
+# Last Updated:	17/10/2026
+#
+# Disassembles images piped to stdin and checks the listing is the same as that of the file,
+# including images that end part way through an instruction. Run by "make test"
+#
+# Modinfo:
+# 17/10/2026:	Added a hex dump
+
+cd "$(dirname "$0")/.."
+
+DIS=Host/disassemble
+TMP=$(mktemp -d)
+trap 'rm -rf "$TMP"' EXIT
+
+LC_ALL=C awk 'BEGIN { srand(4); for(i = 0; i < 65536; i++) printf "%c", int(rand() * 256) }' > "$TMP/image.bin"
+
+failed=0
+
+# Disassemble an image from the file and from a pipe, and compare
+# Parameters:
+# - $1: Description
+# - $2: The image
+# - The rest: Options for the disassembler
+#
+check() {
+	name=$1
+	image=$2
+	shift 2
+	if $DIS -t raw "$@" "$image" > "$TMP/file.txt" &&
+		cat "$image" | $DIS "$@" - > "$TMP/stream.txt" &&
+		cmp -s "$TMP/file.txt" "$TMP/stream.txt"; then
+		echo "ok     $name"
+	else
+		echo "FAILED $name"
+		failed=1
+	fi
+}
+
+for format in text json binary; do
+	check "$format" "$TMP/image.bin" -f $format
+done
+check "adl=0 base" "$TMP/image.bin" -a 0 -b '&040000'
+check "start and length" "$TMP/image.bin" -b '&040000' -s '&040123' -l 1000
+check "dump" "$TMP/image.bin" -m dump -s 5 -l 1000
+for n in 1 2 3 4 5 6 7 8 9; do
+	head -c $((60000 + n)) "$TMP/image.bin" > "$TMP/short.bin"
+	check "ends at +$n" "$TMP/short.bin"
+done
+
+exit $failed
@@ -0,0 +1,102 @@
+#!/bin/sh
+#
+# Title:		Disassembler - Symbol Test
+# Author:		Dean Belfield
+# Created:		17/10/2026
+# Last Updated:	17/10/2026
+#
+# Loads symbols with -y, and checks that the addresses in jumps, calls and memory operands are
+# listed by name, that an immediate with the same value as a symbol isn't, that a port is named by an
+# equate below &100, that a name is escaped in JSON, and that the source still reassembles to the same bytes. Run by "make test"
+#
+# Modinfo:
+# 17/10/2026:	Ports are named by an equate below &100
+
+cd "$(dirname "$0")/.."
+
+DIS=Host/disassemble
+ASM=Host/assemble
+TMP=$(mktemp -d)
+trap 'rm -rf "$TMP"' EXIT
+
+failed=0
+
+# Report the result of a check
+# Parameters:
+# - $1: Description
+# - $2: 0 if it passed
+#
+result() {
+	if [ "$2" -eq 0 ]; then
+		echo "ok     $1"
+	else
+		echo "FAILED $1"
+		failed=1
+	fi
+}
+
+# Write bytes into the image
+# Parameters:
+# - $1: Offset in the image, in hex
+# - $2: The bytes, in hex and separated by commas
+#
+put() {
+	for b in $(echo "$2" | tr , ' '); do
+		printf "\\$(printf %o "0x$b")"
+	done | dd of="$TMP/image.bin" bs=1 seek=$((0x$1)) conv=notrunc 2>/dev/null
+}
+
+# ADL code that uses the value of each symbol; zero is the value of an immediate as well as a
+# symbol, as an API number in an include file might be, and PA_DR is a port
+#
+head -c 64 /dev/zero > "$TMP/image.bin"
+put 00 21,00,00,00													# LD HL,&000000
+put 04 CD,20,00,04													# CALL &040020
+put 08 3A,00,01,04													# LD A,(&040100)
+put 14 ED,38,96													# IN0 A,(&96)
+put 0E C3,20,00,04													# JP &040020
+put 20 C9,18,FD														# RET: JR &040020
+
+printf 'zero: EQU 00h\nPA_DR: EQU 96h\nprint = &040020\nbuffer = &040100\n' > "$TMP/symbols.inc"
+
+$DIS -t raw -b '&040000' -a 1 -y "$TMP/symbols.inc" "$TMP/image.bin" > "$TMP/list.txt"
+
+# Check that the listing has a line
+# Parameters:
+# - $1: Description
+# - $2: The address, in hex
+# - $3: The instruction expected at it
+#
+check() {
+	grep "^$2 " "$TMP/list.txt" | cut -c33- | sed 's/ *$//' | grep -qxF "$3"
+	result "$1" $?
+}
+
+check "call target" 040004 'CALL print'
+check "memory operand" 040008 'LD A,(buffer)'
+check "jump target" 04000E 'JP print'
+check "relative jump target" 040021 'JR print'
+check "immediate" 040000 'LD HL,&000000'
+! grep -q zero "$TMP/list.txt"
+result "immediate not named" $?
+check "port" 040014 'IN0 A,(PA_DR)'
+
+# A control character in a name is escaped in JSON, in the symbol and in the text
+#
+printf 'call\001\033name = &040020\n' > "$TMP/control.inc"
+$DIS -t raw -b '&040000' -a 1 -y "$TMP/control.inc" -f json "$TMP/image.bin" > "$TMP/list.json"
+grep '"address":262148,' "$TMP/list.json" | grep -qF '"symbol":"call\u0001\u001Bname","text":"CALL call\u0001\u001Bname"}'
+result "JSON control characters escaped" $?
+! grep -q "$(printf '[\001\033]')" "$TMP/list.json"
+result "JSON has no control characters" $?
+
+# The source reassembles to the same bytes
+#
+for syntax in zds ez80asm; do
+	$DIS -t raw -b '&040000' -a 1 -y "$TMP/symbols.inc" -c $syntax -o "$TMP/out.asm" "$TMP/image.bin" &&
+		$ASM "$TMP/out.asm" "$TMP/out.bin" &&
+		cmp -s "$TMP/image.bin" "$TMP/out.bin"
+	result "$syntax round trip" $?
+done
+
+exit $failed
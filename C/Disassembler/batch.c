@@ -0,0 +1,271 @@
+/*
+ * Title:			Disassembler - Decoded Instruction Batches (host build)
+ * Author:			Dean Belfield
+ * Created:			17/10/2026
+ * Last Updated:	17/10/2026
+ *
+ * Keeps the instructions in a range decoded, so that a pass that needs all of them before the
+ * listing can start (the labels, for one) doesn't leave them to be decoded again. Only what
+ * can't be read straight back from the image is kept: the bytes are fetched again and the text
+ * is formatted when an instruction is taken out of the batch
+ *
+ * Modinfo:
+ * 17/10/2026:		The strings and pointer tables found by the classifier are kept, and instructions stop short of them
+ * 17/10/2026:		Added batchSplice, to replace the instructions a patch changes
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "batch.h"
+#include "classify.h"
+#include "decode.h"
+#include "source.h"
+
+#define BATCH_RECORD	(sizeof(int) * 3 + sizeof(short) + 2)	// Bytes per instruction
+#define BATCH_SPECIALS	5											// Number of entries in t_special
+
+struct s_batch	batch;
+
+static const unsigned char	t_shift[T_COUNT] = { 0x00, 0xCB, 0xED, 0xDD, 0xFD, 0xDD, 0xFD };	// Prefix byte of each table
+
+static const struct s_decode *	t_special[BATCH_SPECIALS] = { &d_none, &d_data, &d_string, &d_pointer[0], &d_pointer[1] };	// Entry 0xFFFF on down
+
+static int		batchGrow(long size);
+static void *	batchMove(unsigned char ** p, void * array, long size, int width);
+static void		batchLine(long * address, long limit, struct s_opcode * opcode);
+static void		batchPut(long i, struct s_opcode * opcode);
+static long		batchFind(long address);
+static void		batchShift(void * array, int width, long from, long to);
+
+// Start a batch
+// Parameters:
+// - size: Number of instructions to make room for
+// Returns:
+// - 1: OK
+// - 0: Out of memory
+//
+int batchOpen(long size) {
+	batchClose();
+	return batchGrow(size > 0 ? size : BATCH_SIZE);
+}
+
+// Free the batch
+//
+void batchClose(void) {
+	free(batch.arena);
+	memset(&batch, 0, sizeof(batch));
+}
+
+// Decode an instruction and add it to the batch, in the current ADL mode
+// Parameters:
+// - address: Pointer to the address counter
+// - limit: Address after the last byte that can be decoded
+// Returns:
+// - 1: OK
+// - 0: Out of memory
+//
+int batchDecode(long * address, long limit) {
+	struct s_opcode	opcode;
+
+	if(batch.count == batch.size && !batchGrow(batch.size * 2)) {
+		return 0;
+	}
+	batchLine(address, limit, &opcode);
+	batchPut(batch.count++, &opcode);
+	return 1;
+}
+
+// Replace the instructions in a range with the ones decoded there now, as after a patch; the
+// range starts and ends on an instruction boundary both before and after the change. Only the
+// instructions in the range are decoded; the ones after it are moved up or down
+// Parameters:
+// - first: Address of the first instruction to replace
+// - last: Address after the last instruction to replace
+// - limit: Address after the last byte that can be decoded
+// Returns:
+// - 1: OK
+// - 0: Out of memory
+//
+int batchSplice(long first, long last, long limit) {
+	struct s_opcode	opcode;
+	long			i = batchFind(first);
+	long			j = batchFind(last);
+	long			count = 0;
+	long			a;
+
+	for(a = first; a < last; count++) {
+		batchLine(&a, limit, &opcode);
+	}
+	while(batch.count - (j - i) + count > batch.size) {
+		if(!batchGrow(batch.size * 2)) {
+			return 0;
+		}
+	}
+	batchShift(batch.address, sizeof(int), j, i + count);
+	batchShift(batch.value[0], sizeof(int), j, i + count);
+	batchShift(batch.value[1], sizeof(int), j, i + count);
+	batchShift(batch.entry, sizeof(short), j, i + count);
+	batchShift(batch.length, 1, j, i + count);
+	batchShift(batch.mode, 1, j, i + count);
+	batch.count += count - (j - i);
+	for(a = first; a < last; i++) {
+		batchLine(&a, limit, &opcode);
+		batchPut(i, &opcode);
+	}
+	return 1;
+}
+
+// Take an instruction out of the batch; the text is left for formatOpcode
+// Parameters:
+// - index: Index of the instruction in the batch
+// - opcode: Pointer to the opcode structure to fill
+// Returns:
+// - int: The ADL mode it was decoded in
+//
+int batchOpcode(long index, struct s_opcode * opcode) {
+	unsigned short	entry = batch.entry[index];
+	long			i;
+
+	opcode->address = batch.address[index];
+	opcode->count = batch.length[index];
+	opcode->addressMode = batch.mode[index] & ~BATCH_ADL;
+	opcode->value[0] = batch.value[0][index];
+	opcode->value[1] = batch.value[1][index];
+	if(entry >= BATCH_SPECIAL) {
+		opcode->decode = t_special[0xFFFF - entry];
+		opcode->shift = 0x00;
+	}
+	else {
+		opcode->decode = &t_decode[0][entry];
+		opcode->shift = t_shift[entry >> 8];
+	}
+	i = opcode->address - source.windowBase;
+	if(i >= 0 && i + opcode->count <= source.windowLength) {
+		memcpy(opcode->byteData, &source.window[i], opcode->count);
+	}
+	else {
+		for(i = 0; i < opcode->count; i++) {
+			opcode->byteData[i] = sourceFetch(opcode->address + i);
+		}
+	}
+	opcode->text[0] = '\0';
+	return (batch.mode[index] & BATCH_ADL) != 0;
+}
+
+// Make room for more instructions, moving the arrays into a larger arena
+// Parameters:
+// - size: Number of instructions to make room for
+// Returns:
+// - 1: OK
+// - 0: Out of memory
+//
+static int batchGrow(long size) {
+	unsigned char *	arena = malloc(size * BATCH_RECORD);
+	unsigned char *	p = arena;
+
+	if(arena == NULL) {
+		return 0;
+	}
+	batch.address = batchMove(&p, batch.address, size, sizeof(int));
+	batch.value[0] = batchMove(&p, batch.value[0], size, sizeof(int));
+	batch.value[1] = batchMove(&p, batch.value[1], size, sizeof(int));
+	batch.entry = batchMove(&p, batch.entry, size, sizeof(short));
+	batch.length = batchMove(&p, batch.length, size, 1);
+	batch.mode = batchMove(&p, batch.mode, size, 1);
+	free(batch.arena);
+	batch.arena = arena;
+	batch.size = size;
+	return 1;
+}
+
+// Move an array into a new arena
+// Parameters:
+// - p: Pointer to where the array goes in the new arena; moved on past it
+// - array: The array, or NULL if there isn't one yet
+// - size: Number of elements there is room for in the new arena
+// - width: Size of an element
+// Returns:
+// - void *: The array in the new arena
+//
+static void * batchMove(unsigned char ** p, void * array, long size, int width) {
+	void *	moved = *p;
+
+	if(array != NULL) {
+		memcpy(moved, array, batch.count * width);
+	}
+	*p += size * width;
+	return moved;
+}
+
+// Decode a line in the current ADL mode. An instruction that runs past the limit or into a
+// region found by the classifier, or that the classifier finds unlikely, is decoded as data; a
+// line of a region is decoded as it is
+// Parameters:
+// - address: Pointer to the address counter
+// - limit: Address after the last byte that can be decoded
+// - opcode: Pointer to the opcode structure to fill
+//
+static void batchLine(long * address, long limit, struct s_opcode * opcode) {
+	long	start = *address;
+	long	end;
+
+	if(!classifyLine(address, limit, opcode)) {
+		decodeInstruction(address, opcode);
+		end = classifyLimit(start, limit);
+		if(*address > end || classifyInvalid(opcode)) {
+			end = *address < end ? *address : end;
+			*address = start;
+			decodeData(address, opcode, end - start < DATA_MAX ? end - start : DATA_MAX);
+		}
+	}
+}
+
+// Store a decoded line in the batch
+// Parameters:
+// - i: Index to store it at
+// - opcode: Pointer to the opcode structure
+//
+static void batchPut(long i, struct s_opcode * opcode) {
+	int	k;
+
+	batch.address[i] = opcode->address;
+	batch.value[0][i] = opcode->value[0];
+	batch.value[1][i] = opcode->value[1];
+	batch.length[i] = opcode->count;
+	batch.mode[i] = opcode->addressMode | (adl ? BATCH_ADL : 0);
+	for(k = 0; k < BATCH_SPECIALS && opcode->decode != t_special[k]; k++);
+	batch.entry[i] = k < BATCH_SPECIALS ? 0xFFFF - k : opcode->decode - t_decode[0];
+}
+
+// Find the first instruction at or after an address; the instructions must be in address order
+// Parameters:
+// - address: The address
+// Returns:
+// - long: Index of the instruction, or the number of instructions if there isn't one
+//
+static long batchFind(long address) {
+	long	lo = 0;
+	long	hi = batch.count;
+	long	mid;
+
+	while(lo < hi) {
+		mid = (lo + hi) / 2;
+		if(batch.address[mid] < address) lo = mid + 1;
+		else hi = mid;
+	}
+	return lo;
+}
+
+// Move the instructions from an index to the end of the batch to another index
+// Parameters:
+// - array: One of the arrays
+// - width: Size of an element
+// - from: Index of the first instruction to move
+// - to: Index to move it to
+//
+static void batchShift(void * array, int width, long from, long to) {
+	unsigned char *	p = array;
+
+	memmove(p + to * width, p + from * width, (batch.count - from) * width);
+}
@@ -0,0 +1,46 @@
+/*
+ * Title:			Disassembler - Decoded Instruction Batches (host build)
+ * Author:			Dean Belfield
+ * Created:			17/10/2026
+ * Last Updated:	17/10/2026
+ *
+ * Modinfo:
+ * 17/10/2026:		Entries for the strings and pointer tables found by the classifier
+ * 17/10/2026:		Added batchSplice
+ */
+
+#ifndef BATCH_H
+#define BATCH_H
+
+#include "decode.h"
+
+#define BATCH_SIZE		0x10000		// Number of instructions there is room for at first; the room doubles as it fills
+
+#define BATCH_SPECIAL	0xFFF0		// Entries from here on are decodes that aren't in t_decode, counting down from 0xFFFF
+
+#define BATCH_ADL		0x08		// Mode flag: decoded in ADL mode; the low bits are the addressing mode (AM_*)
+
+// A run of decoded instructions, without their text. Each field is an array, indexed by the
+// order the instructions were decoded in, and all of them are carved out of one allocation;
+// an instruction takes 16 bytes, where a struct s_opcode takes over 100
+//
+struct s_batch {
+	long				count;		// Number of instructions
+	long				size;		// Number there is room for
+	unsigned char *		arena;		// The allocation the arrays are in
+	int *				address;	// Address of each instruction
+	int *				value[2];	// Values of the operands fetched from the code
+	unsigned short *	entry;		// Index of the decode table entry in t_decode, or from BATCH_SPECIAL on
+	unsigned char *		length;		// Size in bytes
+	unsigned char *		mode;		// Addressing mode, and BATCH_ADL
+};
+
+extern struct s_batch	batch;
+
+int		batchOpen(long size);
+void	batchClose(void);
+int		batchDecode(long * address, long limit);
+int		batchSplice(long first, long last, long limit);
+int		batchOpcode(long index, struct s_opcode * opcode);
+
+#endif
@@ -0,0 +1,479 @@
+/*
+ * Title:			Disassembler - Benchmark (host build)
+ * Author:			Dean Belfield
+ * Created:			17/10/2026
+ * Last Updated:	17/10/2026
+ *
+ * Measures the throughput of the host disassembler
+ *
+ * Modinfo:
+ * 17/10/2026:		Lines are formatted in the listing syntax
+ * 17/10/2026:		Added the decode benchmark, with its corpora
+ * 17/10/2026:		Added the stream method
+ * 17/10/2026:		Added the dump benchmark
+ * 17/10/2026:		Added the stats path
+ * 17/10/2026:		Added the classify path
+ * 17/10/2026:		The corpora are 16MB, as the length decoder was to be measured on; the length path has a loop of its own
+ * 17/10/2026:		Clean with -Wextra
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/resource.h>
+#include <sys/time.h>
+#include <sys/wait.h>
+#include <libgen.h>
+
+#include "classify.h"
+#include "decode.h"
+#include "dump.h"
+#include "format.h"
+#include "source.h"
+#include "stats.h"
+#include "syntax.h"
+
+// A way of getting the image into memory
+//
+struct s_method {
+	const char *	name;			// Name shown in the results
+	long			window;			// Window size passed to sourceLoad, or -1 to stream the file
+};
+
+static const struct s_method	methods[] = {
+	{ "read",		0 },			// Read the whole file into a buffer
+	{ "mmap",		0x40000000 },	// Map the whole file
+	{ "mmap-1M",	0x100000 },		// Map the file through a 1MB window
+	{ "stream",		-1 },			// Read the file through the stream ring buffer
+};
+
+#define CORPUS_SIZE		0x1000000	// Size of the generated corpora (16MB)
+#define CORPUS_PAD		8			// Zero bytes after a corpus, so the length decoder can read past the end
+#define CORPUS_TIME		0.5			// Each path is run over its corpus until at least this many seconds have passed
+
+#define PATH_LENGTH		0			// decodeLength only
+#define PATH_DECODE		1			// decodeOpcode, which also builds the opcode text
+#define PATH_FORMAT		2			// decodeOpcode and formatLine
+#define PATH_STATS		3			// statsInstruction, counting the instruction mix
+#define PATH_CLASSIFY	4			// classifyOpen over the corpus, then decodeOpcode for the lines that aren't data
+#define PATH_COUNT		5
+
+// A corpus of code to decode
+//
+struct s_corpus {
+	const char *	name;			// Name shown in the results
+	unsigned char *	data;			// The bytes, followed by CORPUS_PAD zeroes
+	long			length;			// Number of bytes
+	int				mode;			// ADL mode, or -1 to switch mode every 4KB
+};
+
+static const char *	t_path[] = { "length", "decode", "format", "stats", "classify" };	// Indexed by PATH_*
+static const char *	t_engine[] = { "scalar", "sse2", "avx2" };				// Indexed by DUMP_*
+
+void	help(void);
+int		benchIO(char * filename);
+int		benchRun(char * filename, const struct s_method * method);
+int		benchDecode(int count, char * filenames[]);
+int		benchCorpus(struct s_corpus * corpus, int path);
+int		benchDump(int count, char * filenames[]);
+int		benchDumpCorpus(struct s_corpus * corpus, int engine);
+int		corpusLoad(struct s_corpus * corpus, char * filename);
+void	corpusRandom(struct s_corpus * corpus);
+void	corpusCode(struct s_corpus * corpus, int prefixed, int suffixed);
+unsigned long	random32(void);
+double	now(void);
+
+long	adl = 1;					// ADL mode
+
+static unsigned long	seed = 1;	// State of random32
+
+// Parameters:
+// - argc: Argument count
+// - argv: Array of arguments
+//
+int main(int argc, char * argv[]) {
+	syntaxSelect(SYNTAX_LISTING, HEX_DEFAULT);
+	if(argc == 3 && strcmp(argv[1], "io") == 0) {
+		return benchIO(argv[2]);
+	}
+	if(argc >= 2 && strcmp(argv[1], "decode") == 0) {
+		return benchDecode(argc - 2, &argv[2]);
+	}
+	if(argc >= 2 && strcmp(argv[1], "dump") == 0) {
+		return benchDump(argc - 2, &argv[2]);
+	}
+	help();
+	return 1;
+}
+
+// Help text
+//
+void help() {
+	printf("AGON eZ80 Disassembler benchmark\n");
+	printf("Usage:\n");
+	printf("bench io file\n");
+	printf("bench decode [file ...]\n");
+	printf("bench dump [file ...]\n");
+}
+
+// Compare the ways of loading an image; each is run in its own process so that the peak
+// resident memory can be measured separately
+// Parameters:
+// - filename: A raw image to disassemble
+// Returns:
+// - int: 0 if every run succeeded, otherwise 1
+//
+int benchIO(char * filename) {
+	int		i, status, result = 0;
+	pid_t	pid;
+
+	printf("method,seconds,mb_per_sec,instructions_per_sec,peak_rss_kb\n");
+	fflush(stdout);
+	for(i = 0; i < (int)(sizeof(methods) / sizeof(methods[0])); i++) {
+		pid = fork();
+		if(pid == 0) {
+			exit(benchRun(filename, &methods[i]));
+		}
+		if(pid < 0 || waitpid(pid, &status, 0) < 0 || !WIFEXITED(status) || WEXITSTATUS(status) != 0) {
+			fprintf(stderr, "%s: failed\n", methods[i].name);
+			result = 1;
+		}
+	}
+	return result;
+}
+
+// Load and disassemble a whole image, formatting every line but discarding the output
+// Parameters:
+// - filename: The image
+// - method: How to load it
+// Returns:
+// - int: 0 if OK, otherwise 1
+//
+int benchRun(char * filename, const struct s_method * method) {
+	struct s_opcode	opcode;
+	struct rusage	usage;
+	char			line[FORMAT_LINE_MAX];
+	long			address, end, size, lines = 0;
+	unsigned long	check = 0;
+	double			t;
+	int				fd;
+
+	t = now();
+	if(method->window < 0) {
+		fd = open(filename, O_RDONLY);
+		if(fd < 0) {
+			return 1;
+		}
+		sourceStream(fd, 0, NULL);
+		for(address = 0; sourceFill(address); lines++) {
+			decodeOpcode(&address, &opcode);
+			check += formatLine(line, &opcode);
+		}
+		size = source.length;
+		close(fd);
+	}
+	else {
+		if(!sourceLoad(filename, SOURCE_RAW, 0, method->window)) {
+			return 1;
+		}
+		address = source.base;
+		end = source.base + source.length;
+		size = source.length;
+		while(address < end) {
+			decodeOpcode(&address, &opcode);
+			check += formatLine(line, &opcode);
+			lines++;
+		}
+	}
+	sourceClose();
+	t = now() - t;
+
+	getrusage(RUSAGE_SELF, &usage);
+	printf("%s,%.3f,%.1f,%.0f,%ld\n", method->name, t, size / t / 1048576.0, lines / t, usage.ru_maxrss);
+	return check == 0;
+}
+
+// Measure the decoder and formatter on the generated corpora and on any images given, such
+// as a MOS ROM; the results are written as CSV, one line per corpus and path
+// Parameters:
+// - count: Number of images
+// - filenames: The images
+// Returns:
+// - int: 0 if OK, otherwise 1
+//
+int benchDecode(int count, char * filenames[]) {
+	struct s_corpus	corpora[3];
+	struct s_corpus	image;
+	int				i, path, result = 0;
+
+	corpora[0].name = "random";
+	corpora[0].mode = 1;
+	corpusRandom(&corpora[0]);
+	corpora[1].name = "prefixed";
+	corpora[1].mode = 1;
+	corpusCode(&corpora[1], 1, 0);
+	corpora[2].name = "mixed-adl";
+	corpora[2].mode = -1;
+	corpusCode(&corpora[2], 0, 1);
+
+	printf("corpus,path,bytes,instructions,seconds,instructions_per_sec,bytes_per_sec,ns_per_instruction\n");
+	for(i = 0; i < 3; i++) {
+		for(path = 0; path < PATH_COUNT; path++) {
+			result |= benchCorpus(&corpora[i], path);
+		}
+		free(corpora[i].data);
+	}
+	for(i = 0; i < count; i++) {
+		if(!corpusLoad(&image, filenames[i])) {
+			fprintf(stderr, "%s: can't load\n", filenames[i]);
+			result = 1;
+			continue;
+		}
+		for(path = 0; path < PATH_COUNT; path++) {
+			result |= benchCorpus(&image, path);
+		}
+		free(image.data);
+	}
+	return result;
+}
+
+// Run one path over a corpus until CORPUS_TIME has passed, and write the result
+// Parameters:
+// - corpus: The corpus
+// - path: PATH_*
+// Returns:
+// - int: 0 if OK, otherwise 1
+//
+int benchCorpus(struct s_corpus * corpus, int path) {
+	struct s_opcode	opcode;
+	char			line[FORMAT_LINE_MAX];
+	long			address, bytes = 0, lines = 0;
+	unsigned long	check = 0;
+	double			t, start;
+
+	source.base = 0;
+	source.length = corpus->length;
+	source.window = corpus->data;
+	source.windowBase = 0;
+	source.windowLength = corpus->length;
+	source.windowSize = 0;
+
+	start = now();
+	do {
+		address = 0;
+		while(path == PATH_LENGTH && address < corpus->length) {
+			//
+			// A loop of its own, as the lengths take little more time than the loop around them
+			//
+			address += decodeLength(&corpus->data[address], corpus->mode < 0 ? (address >> 12) & 1 : corpus->mode, AM_NONE);
+			check++;
+			lines++;
+		}
+		while(address < corpus->length) {
+			adl = corpus->mode < 0 ? (address >> 12) & 1 : corpus->mode;
+			switch(path) {
+				case PATH_STATS: {
+					address += statsInstruction(&corpus->data[address], adl);
+					check++;
+				} break;
+				case PATH_DECODE: {
+					decodeOpcode(&address, &opcode);
+					check += opcode.text[0];
+				} break;
+				case PATH_CLASSIFY: {
+					if(address == 0 && !classifyOpen(0, corpus->length, adl)) {
+						return 1;
+					}
+					if(!classifyLine(&address, corpus->length, &opcode)) {
+						decodeOpcode(&address, &opcode);
+					}
+					check += opcode.text[0];
+				} break;
+				default: {
+					decodeOpcode(&address, &opcode);
+					check += formatLine(line, &opcode);
+				} break;
+			}
+			lines++;
+		}
+		bytes += corpus->length;
+		t = now() - start;
+	} while(t < CORPUS_TIME);
+	classifyClose();
+
+	printf("%s,%s,%ld,%ld,%.3f,%.0f,%.0f,%.2f\n", corpus->name, t_path[path], bytes, lines, t, lines / t, bytes / t, t * 1e9 / lines);
+	fflush(stdout);
+	return check == 0;
+}
+
+// Measure the hex dump engines on the random corpus and on any images given; the results are
+// written as CSV, one line per corpus and engine that the CPU supports
+// Parameters:
+// - count: Number of images
+// - filenames: The images
+// Returns:
+// - int: 0 if OK, otherwise 1
+//
+int benchDump(int count, char * filenames[]) {
+	struct s_corpus	corpus;
+	int				i, engine, result = 0;
+
+	printf("corpus,engine,bytes,lines,seconds,gb_per_sec,ns_per_line\n");
+	for(i = -1; i < count; i++) {
+		if(i < 0) {
+			corpus.name = "random";
+			corpusRandom(&corpus);
+		}
+		else if(!corpusLoad(&corpus, filenames[i])) {
+			fprintf(stderr, "%s: can't load\n", filenames[i]);
+			result = 1;
+			continue;
+		}
+		for(engine = DUMP_SCALAR; engine < DUMP_COUNT; engine++) {
+			if(dumpSelect(engine) == engine) {
+				result |= benchDumpCorpus(&corpus, engine);
+			}
+		}
+		free(corpus.data);
+	}
+	return result;
+}
+
+// Dump a corpus with one engine until CORPUS_TIME has passed, and write the result
+// Parameters:
+// - corpus: The corpus
+// - engine: DUMP_*, already selected
+// Returns:
+// - int: 0 if OK, otherwise 1
+//
+int benchDumpCorpus(struct s_corpus * corpus, int engine) {
+	char			line[DUMP_LINE_MAX];
+	long			address, bytes = 0, lines = 0;
+	unsigned long	check = 0;
+	double			t, start;
+	int				count;
+
+	start = now();
+	do {
+		for(address = 0; address < corpus->length; address += count) {
+			count = corpus->length - address < DUMP_ROW ? corpus->length - address : DUMP_ROW;
+			check += dumpLine(line, address, &corpus->data[address], count) + line[40];
+			lines++;
+		}
+		bytes += corpus->length;
+		t = now() - start;
+	} while(t < CORPUS_TIME);
+
+	printf("%s,%s,%ld,%ld,%.3f,%.3f,%.2f\n", corpus->name, t_engine[engine], bytes, lines, t, bytes / t / 1e9, t * 1e9 / lines);
+	fflush(stdout);
+	return check == 0;
+}
+
+// Load an image as a corpus, decoded in the ADL mode from its MOS header if it has one
+// Parameters:
+// - corpus: The corpus
+// - filename: The image
+// Returns:
+// - 1: Loaded OK
+// - 0: Couldn't load the image
+//
+int corpusLoad(struct s_corpus * corpus, char * filename) {
+	if(!sourceLoad(filename, SOURCE_AUTO, 0, 0)) {
+		return 0;
+	}
+	corpus->name = basename(filename);
+	corpus->length = source.length;
+	corpus->mode = source.mode < 0 ? 1 : source.mode;
+	corpus->data = calloc(corpus->length + CORPUS_PAD, 1);
+	if(corpus->data != NULL) {
+		memcpy(corpus->data, source.window, corpus->length);
+	}
+	sourceClose();
+	return corpus->data != NULL;
+}
+
+// Fill a corpus with random bytes
+// Parameters:
+// - corpus: The corpus
+//
+void corpusRandom(struct s_corpus * corpus) {
+	long	i;
+
+	corpus->length = CORPUS_SIZE;
+	corpus->data = calloc(CORPUS_SIZE + CORPUS_PAD, 1);
+	for(i = 0; i < CORPUS_SIZE; i++) {
+		corpus->data[i] = random32() >> 24;
+	}
+}
+
+// Fill a corpus with valid instructions chosen at random from the decode tables, with random
+// operands
+// Parameters:
+// - corpus: The corpus
+// - prefixed: Set to choose only from the ED, DD, FD, DD CB and FD CB tables
+// - suffixed: Set to give half of the instructions an addressing mode suffix
+//
+void corpusCode(struct s_corpus * corpus, int prefixed, int suffixed) {
+	static const unsigned char	t_prefix[T_COUNT][2] = {
+		{ 0x00, 0x00 }, { 0xCB, 0x00 }, { 0xED, 0x00 }, { 0xDD, 0x00 }, { 0xFD, 0x00 }, { 0xDD, 0xCB }, { 0xFD, 0xCB }
+	};
+	static const unsigned char	t_suffix[] = { 0x40, 0x49, 0x52, 0x5B };
+	const struct s_decode *		d;
+	unsigned char				buffer[16];
+	long						i = 0;
+	int							n, k, table, op;
+
+	corpus->length = CORPUS_SIZE;
+	corpus->data = calloc(CORPUS_SIZE + CORPUS_PAD, 1);
+	while(i < CORPUS_SIZE) {
+		do {
+			table = prefixed ? T_ED + random32() % (T_COUNT - T_ED) : random32() % 8 < 5 ? T_MAIN : random32() % T_COUNT;
+			op = random32() >> 24;
+			d = &t_decode[table][op];
+		} while(d->mnemonic == M_NONE || (d->flags & (D_PREFIX | D_SUFFIX)));
+
+		n = 0;
+		if(suffixed && (random32() & 1)) {
+			buffer[n++] = t_suffix[random32() & 3];
+		}
+		if(t_prefix[table][0]) {
+			buffer[n++] = t_prefix[table][0];
+		}
+		if(t_prefix[table][1]) {
+			buffer[n++] = t_prefix[table][1];
+			buffer[n++] = random32() >> 24;
+		}
+		buffer[n++] = op;
+		while(n < (int)sizeof(buffer)) {
+			buffer[n++] = random32() >> 24;
+		}
+		n = decodeLength(buffer, ((i >> 12) & 1) | !suffixed, AM_NONE);
+		for(k = 0; k < n && i < CORPUS_SIZE; k++) {
+			corpus->data[i++] = buffer[k];
+		}
+	}
+}
+
+// A pseudo-random number (xorshift), so that the corpora are the same on every host
+// Returns:
+// - unsigned long: The number, 32 bits
+//
+unsigned long random32(void) {
+	seed ^= (seed << 13) & 0xFFFFFFFF;
+	seed ^= seed >> 17;
+	seed ^= (seed << 5) & 0xFFFFFFFF;
+	return seed;
+}
+
+// The current time
+// Returns:
+// - double: Time in seconds
+//
+double now(void) {
+	struct timeval	tv;
+
+	gettimeofday(&tv, NULL);
+	return tv.tv_sec + tv.tv_usec / 1e6;
+}
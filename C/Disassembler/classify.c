@@ -0,0 +1,623 @@
+/*
+ * Title:			Disassembler - Data Regions (host build)
+ * Author:			Dean Belfield
+ * Created:			17/10/2026
+ * Last Updated:	17/10/2026
+ *
+ * Finds the data in a range of the image, so that only the code is decoded as instructions:
+ * - Strings: at least CLASSIFY_STRING printable characters, three quarters of them letters,
+ *   digits or spaces, ending in a 0 or a CR/LF (which aren't counted)
+ * - Pointer tables: in ADL mode, at least CLASSIFY_POINTERS 24-bit addresses in a row, each
+ *   one in the image, and not all the same
+ * - Fill: one byte repeated at least CLASSIFY_FILL times
+ * The range is classified in a single pass, 16 bytes at a time. Each block is first reduced to
+ * bit masks (with SSE2 on an x86 host, a byte at a time from a table everywhere else); the runs
+ * are then followed from one set bit to the next, so the bytes aren't looked at one at a time.
+ * In flow mode the bytes traced as code are never part of a region
+ *
+ * Modinfo:
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "classify.h"
+#include "decode.h"
+#include "flow.h"
+#include "format.h"
+#include "source.h"
+
+#if defined(__GNUC__) && defined(__x86_64__)
+#define CLASSIFY_X86					// SSE2 is always there
+#include <emmintrin.h>
+#endif
+
+#define CLASSIFY_BLOCK		16			// Bytes classified at once
+#define CLASSIFY_REGIONS	1024		// Regions there is room for at first; the room doubles as it fills
+
+// Character classes, for the masks built a byte at a time
+//
+#define K_TEXT		0x01				// Can be part of a string
+#define K_WORD		0x02				// A letter, digit or space
+#define K_EOL		0x04				// CR or LF
+#define K_ZERO		0x08				// A terminator
+
+// The masks of a block, one bit per byte
+//
+struct s_mask {
+	unsigned int	text;				// K_TEXT
+	unsigned int	word;				// K_WORD
+	unsigned int	eol;				// K_EOL
+	unsigned int	zero;				// K_ZERO
+	unsigned int	high;				// Could be the top byte of an address in the image
+	unsigned int	same;				// The same as the byte before
+	unsigned int	code;				// Traced as code, in flow mode
+};
+
+// The runs being followed through the range
+//
+struct s_scan {
+	long			text;				// Address of the first character of a string, or -1
+	long			length;				// Number of characters, not counting CR and LF
+	long			words;				// Number of them that are K_WORD
+	long			line;				// Address after the last CR or LF in it, or -1
+	long			lineLength;			// The length up to there
+	long			lineWords;			// And the words
+	long			fill;				// Address of the first byte of a fill, or -1
+	long			fillEnd;			// Address after the last byte
+	long			pointers[3];		// Addresses in a row, for the three places a table can start
+	long			last[3];			// Address after the last of them
+	long			first[3];			// Value of the first of them
+	int				distinct[3];		// Set if they aren't all the same
+	int				pointer;			// Set to look for pointer tables
+	long			lo;					// Lowest address a pointer can hold
+	long			hi;					// Address after the highest
+	unsigned int	code;				// Code mask of the block before
+	int				failed;				// Set if there was no room for a region
+};
+
+struct s_classify	classify;
+
+const struct s_decode	d_string = { M_DB, OP_NONE, OP_NONE, D_TEXT };	// Part of a string
+const struct s_decode	d_pointer[2] = {								// One or two addresses from a pointer table
+	{ M_DL, OP_NN, OP_NONE, 0 },
+	{ M_DL, OP_NN, OP_NN, 0 },
+};
+
+static struct s_scan	scan;
+static unsigned char	t_class[256];	// K_* for each byte
+
+static void	classifyMasks(const unsigned char * h, const unsigned char * map, struct s_mask * m);
+static void	classifyBlock(const unsigned char * b, long address, int count, struct s_mask * m);
+static void	classifyString(long end);
+static void	classifyPointers(int phase);
+static void	classifyFill(void);
+static void	classifyAdd(long address, long length, int type);
+static long	classifyFind(long address);
+static void	classifyData(long * address, struct s_opcode * opcode, const struct s_decode * d, int count);
+static int	classifyCount(unsigned int bits);
+static int	classifyFirst(unsigned int bits);
+static int	classifyLast(unsigned int bits);
+
+// Classify a range of the image
+// Parameters:
+// - address: Address of the first byte
+// - end: Address after the last byte
+// - mode: ADL mode; pointer tables are only looked for in ADL mode
+// Returns:
+// - 1: OK
+// - 0: Out of memory
+//
+int classifyOpen(long address, long end, long mode) {
+	unsigned char	h[CLASSIFY_BLOCK + 2];	// The block, after the last two bytes of the one before
+	unsigned char	row[CLASSIFY_BLOCK];
+	const unsigned char *	map = NULL;
+	struct s_mask	m;
+	long			offset;
+	int				i, count;
+
+	classifyClose();
+	for(i = 0; i < 256; i++) {
+		t_class[i] = (i >= 0x20 && i < 0x7F && i != '"' && i != '\\') || i == 0x09 || i == 0x0A || i == 0x0D ? K_TEXT : 0;
+		if((i | 0x20) >= 'a' && (i | 0x20) <= 'z' && i < 0x80) t_class[i] |= K_WORD;
+		if((i >= '0' && i <= '9') || i == ' ') t_class[i] |= K_WORD;
+		if(i == 0x0A || i == 0x0D) t_class[i] |= K_EOL;
+	}
+	t_class[0] = K_ZERO;
+
+	memset(&scan, 0, sizeof(scan));
+	scan.text = -1;
+	scan.fill = scan.fillEnd = -1;
+	scan.pointer = mode == 1 && source.length > 0;
+	scan.lo = source.base;
+	scan.hi = source.base + source.length;
+	scan.code = 0xFFFF;					// Nothing before the range is part of a region
+	classify.enabled = 1;
+	h[0] = h[1] = 0;
+
+	for(; address < end; address += count) {
+		count = end - address < CLASSIFY_BLOCK ? end - address : CLASSIFY_BLOCK;
+		sourceFetch(address);			// Moves the window on if the block isn't in it
+		offset = address - source.windowBase;
+		if(offset >= 0 && offset + count <= source.windowLength) {
+			memcpy(&h[2], &source.window[offset], count);
+		}
+		else {
+			for(i = 0; i < count; i++) {
+				h[2 + i] = sourceFetch(address + i);
+			}
+		}
+		memset(&h[2 + count], 0, CLASSIFY_BLOCK - count);
+		if(flow.map != NULL) {
+			memset(row, 0, CLASSIFY_BLOCK);
+			memcpy(row, &flowMap(address), count);
+			map = row;
+		}
+		classifyMasks(h, map, &m);
+		classifyBlock(&h[2], address, count, &m);
+		h[0] = h[CLASSIFY_BLOCK];
+		h[1] = h[CLASSIFY_BLOCK + 1];
+	}
+	if(scan.text >= 0) {
+		classifyString(-1);
+	}
+	classifyFill();
+	for(i = 0; i < 3; i++) {
+		classifyPointers(i);
+	}
+	if(scan.failed) {
+		classifyClose();
+		return 0;
+	}
+	return 1;
+}
+
+// Free the regions
+//
+void classifyClose(void) {
+	free(classify.region);
+	memset(&classify, 0, sizeof(classify));
+}
+
+// Decode a line of data if an address is in a region: part of a string, one or two addresses
+// from a pointer table, or part of a fill
+// Parameters:
+// - address: Pointer to the address counter
+// - limit: Address the line must end by
+// - opcode: Pointer to the opcode structure to fill
+// Returns:
+// - 1: The address is in a region, and a line was decoded
+// - 0: It isn't
+//
+int classifyLine(long * address, long limit, struct s_opcode * opcode) {
+	struct s_region *	r;
+	long				i = classifyFind(*address);
+	long				end, offset;
+	int					count;
+
+	if(i == classify.count || classify.region[i].address > *address) {
+		return 0;
+	}
+	r = &classify.region[i];
+	end = r->address + r->length < limit ? r->address + r->length : limit;
+	count = end - *address < DATA_MAX ? end - *address : DATA_MAX;
+	switch(r->type) {
+		case REGION_STRING: {
+			//
+			// A line ends after a line feed, unless the terminator follows it
+			//
+			for(i = 0; i < count - 1 && (sourceFetch(*address + i) != 0x0A || sourceFetch(*address + i + 1) == 0x00); i++);
+			classifyData(address, opcode, &d_string, i + 1);
+		} break;
+		case REGION_POINTER: {
+			offset = (*address - r->address) % 3;
+			if(offset > 0 || count < 3) {
+				//
+				// A label part of the way through an address splits it into bytes
+				//
+				classifyData(address, opcode, &d_data, offset > 0 && 3 - offset < count ? 3 - offset : count);
+			}
+			else {
+				classifyData(address, opcode, &d_pointer[count / 3 - 1], count / 3 * 3);
+			}
+		} break;
+		default: {
+			classifyData(address, opcode, &d_data, count);
+		}
+	}
+	return 1;
+}
+
+// Find where the next region starts, so that an instruction can be stopped short of it
+// Parameters:
+// - address: An address that isn't in a region
+// - limit: Address to stop looking at
+// Returns:
+// - long: Address of the first region after the address, or the limit if that comes first
+//
+long classifyLimit(long address, long limit) {
+	long	i = classifyFind(address);
+
+	if(i < classify.count && classify.region[i].address < limit) {
+		return classify.region[i].address;
+	}
+	return limit;
+}
+
+// Check whether a decoded instruction is unlikely to be code, once a range has been classified:
+// the bytes don't form an instruction, or there is a suffix on an instruction it doesn't apply to
+// Parameters:
+// - opcode: Pointer to the opcode structure
+// Returns:
+// - 1: It should be listed as data
+// - 0: It is an instruction, or nothing has been classified
+//
+int classifyInvalid(struct s_opcode * opcode) {
+	const struct s_decode *	d = opcode->decode;
+
+	if(!classify.enabled) {
+		return 0;
+	}
+	return d->mnemonic == M_NONE || (opcode->addressMode != AM_NONE && !(d->flags & (D_AM | D_AMPRE)));
+}
+
+#ifdef CLASSIFY_X86
+// Compare each byte with a range
+// Parameters:
+// - b: The bytes
+// - lo: Lowest value in the range
+// - hi: Highest value in the range
+// Returns:
+// - __m128i: 0xFF for each byte in the range, 0x00 for the rest
+//
+static __m128i classifyRange(__m128i b, int lo, int hi) {
+	__m128i	above = _mm_cmpeq_epi8(_mm_max_epu8(b, _mm_set1_epi8((char)lo)), b);
+	__m128i	below = _mm_cmpeq_epi8(_mm_min_epu8(b, _mm_set1_epi8((char)hi)), b);
+
+	return _mm_and_si128(above, below);
+}
+#endif
+
+// Build the masks of a block
+// Parameters:
+// - h: The block, after the last two bytes of the one before
+// - map: The flow map entries of the block, or NULL if nothing was traced
+// - m: The masks to fill
+//
+static void classifyMasks(const unsigned char * h, const unsigned char * map, struct s_mask * m) {
+	int	top = scan.lo >> 16;
+	int	bottom = (scan.hi - 1) >> 16;
+#ifdef CLASSIFY_X86
+	__m128i	b = _mm_loadu_si128((const __m128i *)(h + 2));
+	__m128i	before = _mm_loadu_si128((const __m128i *)(h + 1));
+	__m128i	eol = _mm_or_si128(_mm_cmpeq_epi8(b, _mm_set1_epi8(0x0D)), _mm_cmpeq_epi8(b, _mm_set1_epi8(0x0A)));
+	__m128i	quote = _mm_or_si128(_mm_cmpeq_epi8(b, _mm_set1_epi8('"')), _mm_cmpeq_epi8(b, _mm_set1_epi8('\\')));
+	__m128i	text = _mm_andnot_si128(quote, classifyRange(b, 0x20, 0x7E));
+	__m128i	word = _mm_or_si128(classifyRange(_mm_or_si128(b, _mm_set1_epi8(0x20)), 'a', 'z'), classifyRange(b, '0', '9'));
+
+	word = _mm_or_si128(word, _mm_cmpeq_epi8(b, _mm_set1_epi8(' ')));
+	text = _mm_or_si128(text, _mm_or_si128(eol, _mm_cmpeq_epi8(b, _mm_set1_epi8(0x09))));
+	m->text = _mm_movemask_epi8(text);
+	m->word = _mm_movemask_epi8(word);
+	m->eol = _mm_movemask_epi8(eol);
+	m->zero = _mm_movemask_epi8(_mm_cmpeq_epi8(b, _mm_setzero_si128()));
+	m->high = _mm_movemask_epi8(classifyRange(b, top, bottom));
+	m->same = _mm_movemask_epi8(_mm_cmpeq_epi8(b, before));
+	m->code = 0;
+	if(map != NULL) {
+		b = _mm_and_si128(_mm_loadu_si128((const __m128i *)map), _mm_set1_epi8((char)~FLOW_ADL));
+		m->code = _mm_movemask_epi8(classifyRange(b, FLOW_CODE, FLOW_BODY));
+	}
+#else
+	unsigned char	k;
+	int				i;
+
+	memset(m, 0, sizeof(struct s_mask));
+	for(i = 0; i < CLASSIFY_BLOCK; i++) {
+		k = t_class[h[i + 2]];
+		m->text |= (k & K_TEXT ? 1u : 0) << i;
+		m->word |= (k & K_WORD ? 1u : 0) << i;
+		m->eol |= (k & K_EOL ? 1u : 0) << i;
+		m->zero |= (k & K_ZERO ? 1u : 0) << i;
+		m->high |= (h[i + 2] >= top && h[i + 2] <= bottom ? 1u : 0) << i;
+		m->same |= (h[i + 2] == h[i + 1] ? 1u : 0) << i;
+		if(map != NULL) {
+			k = map[i] & ~FLOW_ADL;
+			m->code |= (k == FLOW_CODE || k == FLOW_BODY ? 1u : 0) << i;
+		}
+	}
+#endif
+}
+
+// Follow the runs through a block
+// Parameters:
+// - b: The block; the two bytes before it can be read
+// - address: Address of the block
+// - count: Number of bytes in the block
+// - m: The masks of the block
+//
+static void classifyBlock(const unsigned char * b, long address, int count, struct s_mask * m) {
+	unsigned int	valid = (1u << count) - 1;
+	unsigned int	code = m->code;
+	unsigned int	near = (code | code << 1 | code << 2 | scan.code >> 14 | scan.code >> 15) & 0xFFFF;
+	unsigned int	text = m->text & ~code & valid;
+	unsigned int	same = m->same & ~(code | code << 1 | scan.code >> 15) & valid;
+	unsigned int	high = scan.pointer ? m->high & ~near & valid : 0;
+	unsigned int	bits, run, lines;
+	long			a, value, end = address + count;
+	int				i, k, phase;
+
+	scan.code = code;
+
+	//
+	// Strings: from the start of each run of text to its end, where it is checked for a terminator
+	//
+	for(i = 0; i < count; i = k) {
+		if(scan.text < 0) {
+			if((text >> i) == 0) {
+				break;
+			}
+			i += classifyFirst(text >> i);
+			scan.text = address + i;
+			scan.length = scan.words = 0;
+			scan.line = -1;
+		}
+		bits = (~text & valid) >> i;
+		k = bits ? i + classifyFirst(bits) : count;
+		if(k > i) {
+			run = ((1u << k) - 1) & ~((1u << i) - 1);
+			lines = m->eol & run;
+			if(lines) {
+				bits = run & ((2u << classifyLast(lines)) - 1);
+				scan.line = address + classifyLast(lines) + 1;
+				scan.lineLength = scan.length + classifyCount(bits & ~m->eol);
+				scan.lineWords = scan.words + classifyCount(bits & m->word);
+			}
+			scan.length += classifyCount(run & ~m->eol);
+			scan.words += classifyCount(run & m->word);
+		}
+		if(k < count) {
+			classifyString((m->zero & ~code) & (1u << k) ? address + k + 1 : -1);
+			scan.text = -1;
+		}
+	}
+
+	//
+	// Fill: each byte that is the same as the one before carries a run on, or starts one
+	//
+	for(bits = same; bits; bits &= bits - 1) {
+		a = address + classifyFirst(bits);
+		if(scan.fillEnd == a) {
+			scan.fillEnd++;
+		}
+		else {
+			classifyFill();
+			scan.fill = a - 1;
+			scan.fillEnd = a + 1;
+		}
+	}
+	if(scan.fillEnd >= 0 && scan.fillEnd < end) {
+		classifyFill();					// The last byte of the block doesn't carry it on
+	}
+
+	//
+	// Pointer tables: each byte that could be the top of an address in the image carries on the
+	// table that ends 3 bytes before, or starts one
+	//
+	for(bits = high; bits; bits &= bits - 1) {
+		i = classifyFirst(bits);
+		a = address + i;
+		value = b[i - 2] | (b[i - 1] << 8) | ((long)b[i] << 16);
+		if(value < scan.lo || value >= scan.hi || value == 0) {
+			continue;
+		}
+		phase = a % 3;
+		if(scan.pointers[phase] > 0 && scan.last[phase] == a - 2) {
+			if(value != scan.first[phase]) {
+				scan.distinct[phase] = 1;
+			}
+			scan.pointers[phase]++;
+		}
+		else {
+			classifyPointers(phase);
+			scan.pointers[phase] = 1;
+			scan.first[phase] = value;
+			scan.distinct[phase] = 0;
+		}
+		scan.last[phase] = a + 1;
+	}
+	for(phase = 0; phase < 3; phase++) {
+		if(scan.pointers[phase] > 0 && scan.last[phase] + 2 < end) {
+			classifyPointers(phase);	// The next address would have ended in this block
+		}
+	}
+}
+
+// Add the string being followed as a region, if it looks like one; if it doesn't end in a 0, or
+// does but doesn't look like a string, it can still end at its last CR or LF
+// Parameters:
+// - end: Address after the 0 that ends it, or -1 if it doesn't end in one
+//
+static void classifyString(long end) {
+	if(end >= 0 && scan.length >= CLASSIFY_STRING && scan.words * 4 >= scan.length * 3) {
+		classifyAdd(scan.text, end - scan.text, REGION_STRING);
+	}
+	else if(scan.line >= 0 && scan.lineLength >= CLASSIFY_STRING && scan.lineWords * 4 >= scan.lineLength * 3) {
+		classifyAdd(scan.text, scan.line - scan.text, REGION_STRING);
+	}
+}
+
+// Add the addresses in a row in one phase as a pointer table, if there are enough of them,
+// and start again
+// Parameters:
+// - phase: The phase (0 to 2)
+//
+static void classifyPointers(int phase) {
+	long	n = scan.pointers[phase];
+
+	if(n >= CLASSIFY_POINTERS && scan.distinct[phase]) {
+		classifyAdd(scan.last[phase] - n * 3, n * 3, REGION_POINTER);
+	}
+	scan.pointers[phase] = 0;
+}
+
+// Add the fill being followed as a region, if it is long enough
+//
+static void classifyFill(void) {
+	if(scan.fillEnd - scan.fill >= CLASSIFY_FILL) {
+		classifyAdd(scan.fill, scan.fillEnd - scan.fill, REGION_FILL);
+	}
+	scan.fill = scan.fillEnd = -1;
+}
+
+// Add a region, keeping the regions in address order. Regions are found as they end, not as
+// they start, so one may overlap those already found: a fill is cut short to start after them;
+// otherwise the longer region is kept
+// Parameters:
+// - address: Address of the first byte
+// - length: Size in bytes
+// - type: REGION_*
+//
+static void classifyAdd(long address, long length, int type) {
+	struct s_region *	r;
+	long				end = address + length;
+	long				i = classify.count;
+
+	while(i > 0 && classify.region[i - 1].address >= end) {
+		i--;							// Regions that start after this one ends
+	}
+	while(i > 0 && classify.region[i - 1].address + classify.region[i - 1].length > address) {
+		r = &classify.region[i - 1];
+		if(type == REGION_FILL) {
+			address = r->address + r->length;
+			if(end - address < CLASSIFY_FILL) {
+				return;
+			}
+			break;
+		}
+		if(r->length >= end - address) {
+			return;
+		}
+		memmove(r, r + 1, (classify.count - i) * sizeof(struct s_region));
+		classify.count--;
+		i--;
+	}
+	if(classify.count == classify.max) {
+		r = realloc(classify.region, (classify.max ? classify.max * 2 : CLASSIFY_REGIONS) * sizeof(struct s_region));
+		if(r == NULL) {
+			scan.failed = 1;
+			return;
+		}
+		classify.region = r;
+		classify.max = classify.max ? classify.max * 2 : CLASSIFY_REGIONS;
+	}
+	r = &classify.region[i];
+	memmove(r + 1, r, (classify.count - i) * sizeof(struct s_region));
+	r->address = address;
+	r->length = end - address;
+	r->type = type;
+	classify.count++;
+}
+
+// Find the first region that ends after an address
+// Parameters:
+// - address: The address
+// Returns:
+// - long: Index of the region, or the number of regions if there isn't one
+//
+static long classifyFind(long address) {
+	long	lo = 0;
+	long	hi = classify.count;
+	long	mid;
+
+	while(lo < hi) {
+		mid = (lo + hi) / 2;
+		if(classify.region[mid].address + classify.region[mid].length <= address) {
+			lo = mid + 1;
+		}
+		else {
+			hi = mid;
+		}
+	}
+	return lo;
+}
+
+// Decode a line of data, and format it
+// Parameters:
+// - address: Pointer to the address counter
+// - opcode: Pointer to the opcode structure
+// - d: The decode entry to list it with
+// - count: Number of bytes (1 to DATA_MAX)
+//
+static void classifyData(long * address, struct s_opcode * opcode, const struct s_decode * d, int count) {
+	unsigned char *	b = opcode->byteData;
+	int				i;
+
+	opcode->shift = 0x00;
+	opcode->addressMode = 0x00;
+	opcode->address = *address;
+	opcode->count = 0;
+	opcode->decode = d;
+	while(count-- > 0) {
+		decodeByte(address, opcode);
+	}
+	for(i = 0; i < 2; i++) {
+		opcode->value[i] = opcode->count >= i * 3 + 3 ? b[i * 3] | (b[i * 3 + 1] << 8) | ((long)b[i * 3 + 2] << 16) : 0;
+	}
+	formatOpcode(opcode);
+}
+
+// Count the bits that are set
+// Parameters:
+// - bits: The bits
+// Returns:
+// - int: Number of them
+//
+static int classifyCount(unsigned int bits) {
+#ifdef __GNUC__
+	return __builtin_popcount(bits);
+#else
+	int	n;
+
+	for(n = 0; bits; n++) {
+		bits &= bits - 1;
+	}
+	return n;
+#endif
+}
+
+// Find the lowest bit that is set
+// Parameters:
+// - bits: The bits (not 0)
+// Returns:
+// - int: Its index
+//
+static int classifyFirst(unsigned int bits) {
+#ifdef __GNUC__
+	return __builtin_ctz(bits);
+#else
+	int	n;
+
+	for(n = 0; !(bits & 1); n++) {
+		bits >>= 1;
+	}
+	return n;
+#endif
+}
+
+// Find the highest bit that is set
+// Parameters:
+// - bits: The bits (not 0)
+// Returns:
+// - int: Its index
+//
+static int classifyLast(unsigned int bits) {
+#ifdef __GNUC__
+	return 31 - __builtin_clz(bits);
+#else
+	int	n;
+
+	for(n = 31; !(bits & (1u << n)); n--);
+	return n;
+#endif
+}
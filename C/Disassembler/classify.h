@@ -0,0 +1,50 @@
+/*
+ * Title:			Disassembler - Data Regions (host build)
+ * Author:			Dean Belfield
+ * Created:			17/10/2026
+ * Last Updated:	17/10/2026
+ *
+ * Modinfo:
+ */
+
+#ifndef CLASSIFY_H
+#define CLASSIFY_H
+
+#include "decode.h"
+
+#define REGION_STRING		0		// Text ending in a 0 (included) or CR/LF; listed as DB "text"
+#define REGION_POINTER		1		// 24-bit addresses in the image, in ADL mode; listed as DL
+#define REGION_FILL			2		// One byte repeated, such as padding; listed as DB
+
+#define CLASSIFY_STRING		6		// Fewest characters in a string, not counting the terminator
+#define CLASSIFY_POINTERS	4		// Fewest addresses in a pointer table
+#define CLASSIFY_FILL		8		// Fewest bytes in a fill
+
+// A run of bytes found to be data
+//
+struct s_region {
+	long	address;				// Address of the first byte
+	long	length;					// Size in bytes
+	int		type;					// REGION_*
+};
+
+// The data found in a range of the image, in address order; regions don't overlap
+//
+struct s_classify {
+	int					enabled;	// Set once a range has been classified
+	struct s_region *	region;		// The regions
+	long				count;		// Number of regions
+	long				max;		// Space allocated for regions
+};
+
+extern struct s_classify		classify;
+extern const struct s_decode	d_string;
+extern const struct s_decode	d_pointer[2];
+
+int		classifyOpen(long address, long end, long mode);
+void	classifyClose(void);
+int		classifyLine(long * address, long limit, struct s_opcode * opcode);
+long	classifyLimit(long address, long limit);
+int		classifyInvalid(struct s_opcode * opcode);
+
+#endif
@@ -0,0 +1,340 @@
+/*
+ * Title:			Disassembler - Cycle Counts (host build)
+ * Author:			Dean Belfield
+ * Created:			17/10/2026
+ * Last Updated:	17/10/2026
+ *
+ * Counts the eZ80 clock cycles each instruction takes with no wait states. The eZ80 spends one
+ * cycle on each byte it fetches, reads or writes, so an instruction takes a cycle for each of its
+ * bytes (including any prefix and suffix), one for each byte of data it reads or writes, plus:
+ * - One to refill the pipeline after a jump, call, return or restart
+ * - One for a DJNZ to decrement B, a read-modify-write of memory, a block compare, and RLD and
+ *   RRD; four for MLT. A 16/24-bit ADD, ADC or SBC takes only its fetch
+ * - One for a suffixed CALL, RST or RET to save or restore the ADL mode on the SPL stack
+ * Words are 3 bytes in ADL mode and 2 in Z80 mode, unless a suffix says otherwise
+ *
+ * Modinfo:
+ * 17/10/2026:		INIRX, OTIRX, INDRX and OTDRX are counted as block instructions
+ * 17/10/2026:		A 16/24-bit ADD, ADC or SBC takes no internal cycle
+ */
+
+#include <string.h>
+
+#include "cycles.h"
+#include "decode.h"
+#include "format.h"
+#include "syntax.h"
+
+#define CYCLES_TEXT		24			// Width of the mnemonics before the cycle counts in a line
+
+static struct s_cycle	t_cycle[T_COUNT * 256];	// Indexed as t_decode
+
+static void		cyclesEntry(const struct s_decode * d, struct s_cycle * c);
+static int		cyclesAccess(unsigned char operand);
+static int		cyclesWide(unsigned char operand);
+static char *	cyclesNumber(char * t, long value);
+static char *	cyclesPair(char * t, long taken, long cycles, int flags);
+
+// Build the cycle table from the decode tables
+//
+void cyclesOpen(void) {
+	const struct s_decode *	d = t_decode[0];
+	int						i;
+
+	for(i = 0; i < T_COUNT * 256; i++) {
+		cyclesEntry(&d[i], &t_cycle[i]);
+	}
+}
+
+// Count the cycles a decoded instruction takes in each mode
+// Parameters:
+// - opcode: Pointer to the opcode structure
+// - timing: Pointer to the cycle counts to fill
+//
+void cyclesTime(struct s_opcode * opcode, struct s_timing * timing) {
+	const struct s_cycle *	c;
+	unsigned long			i = opcode->decode - t_decode[0];
+	unsigned char			am = opcode->addressMode;
+	int						mode, width, cycles, stack;
+
+	if(i >= T_COUNT * 256 || opcode->decode->mnemonic == M_NONE) {
+		memset(timing, 0, sizeof(struct s_timing));		// Data, or bytes that aren't an instruction
+		return;
+	}
+	c = &t_cycle[i];
+	for(mode = 0; mode < 2; mode++) {
+		width = (am == AM_NONE ? mode == 1 : am == AM_LIS || am == AM_LIL) ? 3 : 2;
+		cycles = decodeLength(opcode->byteData, mode, AM_NONE) + c->bytes + c->internal;
+		stack = c->words * width + (am != AM_NONE && (c->flags & C_MIXED) ? 1 : 0);
+		if(c->flags & C_BRANCH) {
+			stack++;
+		}
+		if(c->flags & C_COND) {
+			timing->cycles[mode] = cycles;
+			timing->taken[mode] = cycles + stack;
+		}
+		else {
+			timing->cycles[mode] = cycles + stack;
+			timing->taken[mode] = cycles + stack + ((c->flags & C_REPEAT) ? 1 : 0);
+		}
+	}
+	timing->flags = c->flags;
+}
+
+// Add an instruction to a basic block, starting a new block if there isn't one
+// Parameters:
+// - block: Pointer to the block
+// - opcode: Pointer to the opcode structure
+// - timing: The cycles the instruction takes
+//
+void cyclesAdd(struct s_block * block, struct s_opcode * opcode, struct s_timing * timing) {
+	int	mode;
+
+	if(block->address < 0) {
+		memset(block, 0, sizeof(struct s_block));
+		block->address = opcode->address;
+	}
+	for(mode = 0; mode < 2; mode++) {
+		block->taken[mode] = block->cycles[mode] + timing->taken[mode];
+		block->cycles[mode] += timing->cycles[mode];
+	}
+	block->end = opcode->address + opcode->count;
+	block->count++;
+	block->flags = timing->flags;
+}
+
+// Write the cycle counts out: "ADL 5 Z80 4", or "ADL 5/4 Z80 4/3" (taken/not taken) if the
+// instruction is conditional or repeats
+// Parameters:
+// - t: Pointer to the text buffer
+// - timing: The cycle counts
+// Returns:
+// - char *: Pointer to the end of the text
+//
+char * cyclesFormat(char * t, struct s_timing * timing) {
+	t = formatString(t, "ADL ");
+	t = cyclesPair(t, timing->taken[1], timing->cycles[1], timing->flags);
+	t = formatString(t, " Z80 ");
+	return cyclesPair(t, timing->taken[0], timing->cycles[0], timing->flags);
+}
+
+// Add the cycle counts to a line of the listing or source as a comment
+// Parameters:
+// - t: Pointer to the line, which ends with a line feed (at least FORMAT_LINE_MAX bytes)
+// - length: Length of the line in bytes
+// - text: Length of the mnemonics at the end of the line
+// - timing: The cycle counts
+// Returns:
+// - int: Length of the line in bytes, excluding the terminator
+//
+int cyclesLine(char * t, int length, int text, struct s_timing * timing) {
+	char *	s = t;
+
+	if(timing->cycles[1] == 0) {
+		return length;					// Data has no cycle counts
+	}
+	t += length - 1;
+	do {
+		*t++ = ' ';
+	} while(++text < CYCLES_TEXT);
+	t = formatString(t, "; ");
+	t = cyclesFormat(t, timing);
+	*t++ = '\n';
+	*t = '\0';
+	return t - s;
+}
+
+// Build the line that follows a basic block in the listing or source, with its total cycles
+// Parameters:
+// - t: Pointer to the line buffer (at least FORMAT_LINE_MAX bytes)
+// - block: The block
+// Returns:
+// - int: Length of the line in bytes, excluding the terminator
+//
+int cyclesBlock(char * t, struct s_block * block) {
+	char *	s = t;
+	int		flags = block->flags & C_COND;
+
+	t = formatString(t, syntax.column);
+	t = formatString(t, "; Block at ");
+	t = formatString(t, syntax.hex);
+	t = formatHex(t, block->address, 6);
+	t = formatString(t, syntax.hexClose);
+	t = formatString(t, ", ");
+	t = cyclesNumber(t, block->count);
+	t = formatString(t, block->count == 1 ? " instruction: ADL " : " instructions: ADL ");
+	t = cyclesPair(t, block->taken[1], block->cycles[1], flags);
+	t = formatString(t, " Z80 ");
+	t = cyclesPair(t, block->taken[0], block->cycles[0], flags);
+	*t++ = '\n';
+	*t = '\0';
+	return t - s;
+}
+
+// Fill in the cycle table entry for an instruction
+// Parameters:
+// - d: The decode table entry
+// - c: The cycle table entry
+//
+static void cyclesEntry(const struct s_decode * d, struct s_cycle * c) {
+	unsigned char	cond = d->operand1 >= OP_CC_NZ && d->operand1 <= OP_CC_M ? C_COND : 0;
+	int				access;
+
+	memset(c, 0, sizeof(struct s_cycle));
+	if(d->flags & (D_PREFIX | D_SUFFIX)) {
+		return;
+	}
+	switch(d->mnemonic) {
+		case M_NONE: {
+			return;
+		} break;
+		case M_PUSH:
+		case M_POP:
+		case M_PEA: {
+			c->words = 1;
+		} return;
+		case M_CALL:
+		case M_RET:
+		case M_RETI:
+		case M_RETN: {
+			c->words = 1;
+			c->flags = C_BRANCH | C_MIXED | C_END | cond;
+		} return;
+		case M_RST: {
+			c->words = 1;
+			c->flags = C_BRANCH | C_MIXED | C_END;
+		} return;
+		case M_JP:
+		case M_JR: {
+			c->flags = C_BRANCH | C_END | cond;		// JP (HL) doesn't read memory
+		} return;
+		case M_DJNZ: {
+			c->internal = 1;
+			c->flags = C_BRANCH | C_END | C_COND;
+		} return;
+		case M_HALT:
+		case M_SLP: {
+			c->flags = C_END;
+		} return;
+		case M_MLT: {
+			c->internal = 4;
+		} return;
+		case M_TSTIO: {
+			c->bytes = 1;						// Reads the port in C
+		} return;
+		case M_EX: {
+			if(d->operand1 == OP_IND_SP) {
+				c->words = 2;					// Read, then written back
+			}
+		} return;
+		case M_RLD:
+		case M_RRD: {
+			c->bytes = 2;
+			c->internal = 1;
+		} return;
+		case M_CPIR: case M_CPDR: {
+			c->flags = C_REPEAT;
+		} // Fall through
+		case M_CPI: case M_CPD: {
+			c->bytes = 1;
+			c->internal = 1;
+		} return;
+		case M_LDIR: case M_LDDR: case M_INIR: case M_INDR: case M_OTIR: case M_OTDR:
+		case M_OTI2R: case M_OTD2R: case M_INIMR: case M_OTIMR: case M_INI2R: case M_INDMR:
+		case M_OTDMR: case M_IND2R: case M_INIRX: case M_OTIRX: case M_INDRX: case M_OTDRX: {
+			c->flags = C_REPEAT;
+		} // Fall through
+		case M_LDI: case M_LDD: case M_INI: case M_IND: case M_OUTI: case M_OUTD:
+		case M_OUTI2: case M_OUTD2: case M_INIM: case M_OTIM: case M_INI2: case M_INDM:
+		case M_OTDM: case M_IND2: {
+			c->bytes = 2;						// Read from one side, written to the other
+		} return;
+	}
+
+	// Anything else reads or writes memory or I/O if one of its operands is an address; a
+	// load does one or the other, a rotate, shift, INC, DEC, RES or SET on memory does both
+	//
+	access = cyclesAccess(d->operand1) || cyclesAccess(d->operand2);
+	if(!access) {
+		return;
+	}
+	switch(d->mnemonic) {
+		case M_INC: case M_DEC: case M_RLC: case M_RRC: case M_RL: case M_RR:
+		case M_SLA: case M_SRA: case M_SLL: case M_SRL: case M_RES: case M_SET: {
+			access = 2;
+			c->internal = 1;
+		} break;
+	}
+	if(cyclesWide(d->operand1) || cyclesWide(d->operand2)) {
+		c->words = access;						// LD HL,(nn), LD (IX+d),BC and so on
+	}
+	else {
+		c->bytes = access;
+	}
+}
+
+// Check whether an operand reads or writes memory or I/O
+// Parameters:
+// - operand: The operand (OP_*)
+// Returns:
+// - 1: It does
+// - 0: It doesn't
+//
+static int cyclesAccess(unsigned char operand) {
+	switch(operand) {
+		case OP_IND_BC: case OP_IND_DE: case OP_IND_HL: case OP_IND_IX: case OP_IND_IY:
+		case OP_IND_C: case OP_PORT: case OP_INN: case OP_IXD: case OP_IYD: {
+			return 1;
+		} break;
+	}
+	return 0;
+}
+
+// Check whether an operand is a 16/24-bit register
+// Parameters:
+// - operand: The operand (OP_*)
+// Returns:
+// - 1: It is
+// - 0: It isn't
+//
+static int cyclesWide(unsigned char operand) {
+	return operand >= OP_BC && operand <= OP_IY && operand != OP_AF_;
+}
+
+// Write a number out in decimal
+// Parameters:
+// - t: Pointer to the text buffer
+// - value: The number (not negative)
+// Returns:
+// - char *: Pointer to the end of the text
+//
+static char * cyclesNumber(char * t, long value) {
+	char	digits[12];
+	int		i = 0;
+
+	do {
+		digits[i++] = '0' + value % 10;
+		value /= 10;
+	} while(value > 0);
+	while(i > 0) {
+		*t++ = digits[--i];
+	}
+	return t;
+}
+
+// Write a cycle count out, with the count when taken first if it is conditional or repeats
+// Parameters:
+// - t: Pointer to the text buffer
+// - taken: Cycles when taken
+// - cycles: Cycles otherwise
+// - flags: C_* flags
+// Returns:
+// - char *: Pointer to the end of the text
+//
+static char * cyclesPair(char * t, long taken, long cycles, int flags) {
+	if(flags & (C_COND | C_REPEAT)) {
+		t = cyclesNumber(t, taken);
+		*t++ = '/';
+	}
+	return cyclesNumber(t, cycles);
+}
@@ -0,0 +1,63 @@
+/*
+ * Title:			Disassembler - Cycle Counts (host build)
+ * Author:			Dean Belfield
+ * Created:			17/10/2026
+ * Last Updated:	17/10/2026
+ *
+ * Modinfo:
+ */
+
+#ifndef CYCLES_H
+#define CYCLES_H
+
+#include "decode.h"
+
+#define TIMING_NONE		0			// No cycle counts
+#define TIMING_CYCLES	1			// Cycle counts for each instruction
+#define TIMING_BLOCKS	2			// And the total for each basic block
+
+// Cycle table entry flags
+//
+#define C_BRANCH	0x01			// Transfers control; a cycle is spent refilling the pipeline
+#define C_COND		0x02			// Conditional; the stack and the refill are only spent when taken
+#define C_REPEAT	0x04			// Block instruction that repeats until BC is zero
+#define C_MIXED		0x08			// With a suffix, the ADL mode is saved on or restored from the SPL stack too
+#define C_END		0x10			// Ends a basic block
+
+// An entry in the cycle table, indexed as t_decode; everything but the bytes fetched, which
+// depend upon the mode
+//
+struct s_cycle {
+	unsigned char	bytes;			// Bytes read from or written to memory or I/O
+	unsigned char	words;			// Words read from or written to memory or the stack (2 or 3 bytes)
+	unsigned char	internal;		// Cycles spent inside the CPU
+	unsigned char	flags;			// See C_* above
+};
+
+// The cycles an instruction takes, in Z80 mode [0] and ADL mode [1]
+//
+struct s_timing {
+	int		cycles[2];				// Cycles; if conditional, when the branch isn't taken
+	int		taken[2];				// Cycles when the branch is taken or the instruction repeats
+	int		flags;					// The C_* flags of the instruction, or 0 for data
+};
+
+// The running total of a basic block
+//
+struct s_block {
+	long	address;				// Address of the first instruction, or -1 if there is no block
+	long	end;					// Address after the last instruction
+	long	count;					// Number of instructions
+	long	cycles[2];				// Total cycles, in Z80 mode [0] and ADL mode [1]
+	long	taken[2];				// And if the branch that ends the block is taken
+	int		flags;					// The C_* flags of the last instruction
+};
+
+void	cyclesOpen(void);
+void	cyclesTime(struct s_opcode * opcode, struct s_timing * timing);
+void	cyclesAdd(struct s_block * block, struct s_opcode * opcode, struct s_timing * timing);
+char *	cyclesFormat(char * t, struct s_timing * timing);
+int		cyclesLine(char * t, int length, int text, struct s_timing * timing);
+int		cyclesBlock(char * t, struct s_block * block);
+
+#endif
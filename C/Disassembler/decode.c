@@ -0,0 +1,247 @@
+/*
+ * Title:			Disassembler - Decoder
+ * Author:			Dean Belfield
+ * Created:			17/10/2026
+ * Last Updated:	17/10/2026
+ *
+ * Modinfo:
+ * 17/10/2026:		Words after a .SIS or .LIS suffix are 2 bytes in ADL mode too
+ * 17/10/2026:		Added decodeInstruction, which leaves the text to be formatted later
+ * 17/10/2026:		decodeLength looks up most instructions in t_size
+ * 17/10/2026:		decodeLength looks up prefixed instructions in t_sizePrefixed, after any suffix
+ */
+
+#include "decode.h"
+#include "format.h"
+
+#ifdef HOST_BUILD
+#include "source.h"
+#define FETCH(a)	sourceFetch(a)				// Read from the loaded image
+#else
+#define FETCH(a)	(*(unsigned char *)(a))		// Read from memory
+#endif
+
+static long		decodeValue(long * address, struct s_opcode * opcode, unsigned char operand);
+
+const struct s_decode d_none = { M_NONE, OP_NONE, OP_NONE, 0 };	// Decoded when the bytes do not form an instruction
+const struct s_decode d_data = { M_DB, OP_NONE, OP_NONE, 0 };	// Bytes listed as data
+
+// Decode a byte
+// Parameters:
+// - address: Pointer to the address counter
+// - opcode: Pointer to the opcode structure
+// Returns:
+// - unsigned char: Word
+//
+unsigned char decodeByte(long * address, struct s_opcode * opcode) {
+	unsigned char b;
+
+	b = FETCH(*address);
+	(*address)++;
+	opcode->byteData[opcode->count++] = b;
+	return b;
+}
+
+// Decode a relative jump
+// Parameters:
+// - address: Pointer to the address counter
+// - opcode: Pointer to the opcode structure
+// Returns:
+// - long: Word
+//
+long decodeJR(long * address, struct s_opcode * opcode) {
+	unsigned char b;
+
+	b = FETCH(*address);
+	(*address)++;
+	opcode->byteData[opcode->count++] = b;
+	return (*address) + (b < 0x80 ? b : b - 256);
+}
+
+// Decode a word (2 or 3 bytes, depending upon ADL mode
+// Parameters:
+// - address: Pointer to the address counter
+// - opcode: Pointer to the opcode structure
+// Returns:
+// - long: Word
+//
+long decodeWord(long * address, struct s_opcode * opcode) {
+	unsigned char	l, h, u, am;
+
+	am = opcode->addressMode;
+
+	l = FETCH(*address);
+	(*address)++;
+	h = FETCH(*address);
+	(*address)++;
+
+	opcode->byteData[opcode->count++] = l;
+	opcode->byteData[opcode->count++] = h;
+
+	// 2 or 3 byte fetches are determined by opcode->addressMode (.IS or .IL) if there is a suffix,
+	// otherwise by ADL mode
+	//
+	if(am == AM_NONE ? adl == 1 : am >= AM_SIL) {
+		//
+		// Word size = 3; fetch a 24-bit word from the code
+		//
+		u = FETCH(*address);
+		(*address)++;
+		opcode->byteData[opcode->count++] = u;
+	}
+	else {
+		//
+		// Word size = 2; fetch a 16-bit word, and set bits 16-23 to the segment address
+		//
+		u = (*address & 0xFF0000) >> 16;
+	}
+	return l | (h << 8) | ((long)u << 16);
+}
+
+// Decode an instruction
+// Parameters:
+// - address: Pointer to the address counter
+// - opcode: Pointer to the opcode structure
+//
+void decodeOpcode(long * address, struct s_opcode * opcode) {
+	decodeInstruction(address, opcode);
+	formatOpcode(opcode);
+}
+
+// Decode an instruction without formatting its text
+// Parameters:
+// - address: Pointer to the address counter
+// - opcode: Pointer to the opcode structure
+//
+void decodeInstruction(long * address, struct s_opcode * opcode) {
+	const struct s_decode *	d;
+	unsigned char			b;
+
+	opcode->shift = 0x00;
+	opcode->addressMode = 0x00;
+	opcode->address = *address;
+	opcode->count = 0;
+
+	b = decodeByte(address, opcode);
+	d = &t_decode[T_MAIN][b];
+
+	// An addressing mode suffix (.SIS, .LIS, .SIL, .LIL) applies to the instruction that follows it
+	//
+	if(d->flags & D_SUFFIX) {
+		opcode->addressMode = d->operand1;
+		b = decodeByte(address, opcode);
+		d = &t_decode[T_MAIN][b];
+		if(d->flags & D_SUFFIX) {
+			opcode->addressMode = d->operand1;
+			d = &d_none;
+		}
+	}
+
+	// Prefixed instructions continue in that prefix's table; DD CB and FD CB are followed
+	// by the displacement and then the opcode
+	//
+	if(d->flags & D_PREFIX) {
+		opcode->shift = b;
+		b = decodeByte(address, opcode);
+		d = &t_decode[d->operand1][b];
+		if(d->flags & D_PREFIX) {
+			decodeByte(address, opcode);
+			b = decodeByte(address, opcode);
+			d = &t_decode[d->operand1][b];
+		}
+	}
+
+	opcode->decode = d;
+	opcode->value[0] = decodeValue(address, opcode, d->operand1);
+	opcode->value[1] = decodeValue(address, opcode, d->operand2);
+}
+
+// Decode bytes as data
+// Parameters:
+// - address: Pointer to the address counter
+// - opcode: Pointer to the opcode structure
+// - count: Number of bytes (1 to DATA_MAX)
+//
+void decodeData(long * address, struct s_opcode * opcode, int count) {
+	opcode->shift = 0x00;
+	opcode->addressMode = 0x00;
+	opcode->address = *address;
+	opcode->count = 0;
+	opcode->decode = &d_data;
+
+	while(count-- > 0) {
+		decodeByte(address, opcode);
+	}
+	formatOpcode(opcode);
+}
+
+// Get the length of an instruction without decoding it
+// Parameters:
+// - ptr: Pointer to the first byte of the instruction
+// - adlMode: ADL mode
+// - am: Addressing mode in effect (AM_NONE unless the instruction has its own suffix)
+// Returns:
+// - int: Size of the instruction in bytes, including any suffix and prefixes
+//
+int decodeLength(unsigned char * ptr, long adlMode, unsigned char am) {
+	unsigned char	l;
+	int				count = 0;
+
+	l = t_size[adlMode == 1][*ptr];
+	if(l && am == AM_NONE) {
+		return l;							// Most instructions: no prefix or suffix
+	}
+	l = t_length[T_MAIN][*ptr];
+	if(l & L_SUFFIX) {
+		am = l >> 5;
+		l = t_length[T_MAIN][*++ptr];
+		count++;
+		if(l & L_SUFFIX) {
+			return 2;
+		}
+	}
+	adlMode = am == AM_NONE ? adlMode == 1 : am >= AM_SIL;	// From here on, set if words are 3 bytes
+	if(l & L_PREFIX) {
+		return count + t_sizePrefixed[adlMode][(l >> 5) - T_CB][ptr[1]];
+	}
+	return count + t_size[adlMode][*ptr];
+}
+
+// Fetch the value of an operand from the code
+// Parameters:
+// - address: Pointer to the address counter
+// - opcode: Pointer to the opcode structure
+// - operand: The operand (OP_*)
+// Returns:
+// - long: The value, or 0 if the operand is not fetched from the code
+//
+static long decodeValue(long * address, struct s_opcode * opcode, unsigned char operand) {
+	unsigned char	b;
+
+	switch(operand) {
+		case OP_N:
+		case OP_PORT: {
+			return decodeByte(address, opcode);
+		} break;
+		case OP_NN:
+		case OP_INN: {
+			return decodeWord(address, opcode);
+		} break;
+		case OP_REL: {
+			return decodeJR(address, opcode);
+		} break;
+		case OP_IXD:
+		case OP_IYD:
+		case OP_IXO:
+		case OP_IYO: {
+			if(opcode->decode->flags & D_DISP) {
+				b = opcode->byteData[opcode->count - 2];
+			}
+			else {
+				b = decodeByte(address, opcode);
+			}
+			return b < 0x80 ? b : b - 256;
+		} break;
+	}
+	return 0;
+}
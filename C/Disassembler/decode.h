@@ -0,0 +1,145 @@
+/*
+ * Title:			Disassembler - Decoder
+ * Author:			Dean Belfield
+ * Created:			17/10/2026
+ * Last Updated:	17/10/2026
+ *
+ * Modinfo:
+ * 17/10/2026:		The opcode text has room for symbol names in the host build
+ * 17/10/2026:		Added decodeInstruction
+ * 17/10/2026:		Added D_TEXT and M_DL for the data found in the image
+ * 17/10/2026:		Added decodeMode and decodeRestart, so that everything follows a suffix to the same place
+ * 17/10/2026:		Added t_size
+ * 17/10/2026:		Added INIRX, OTIRX, INDRX and OTDRX
+ * 17/10/2026:		Added t_sizePrefixed
+ */
+
+#ifndef DECODE_H
+#define DECODE_H
+
+// An entry in the opcode decode tables
+//
+struct s_decode {
+	unsigned char mnemonic;		// Index into t_mnemonic (M_*)
+	unsigned char operand1;		// Index into t_operand (OP_*), or table / addressing mode for prefixes and suffixes
+	unsigned char operand2;		// Index into t_operand (OP_*)
+	unsigned char flags;		// See D_* below
+};
+
+#ifdef HOST_BUILD
+#define OPCODE_TEXT_MAX	64		// Room for a symbol name in an operand
+#else
+#define OPCODE_TEXT_MAX	32
+#endif
+
+// Storage for the opcode decoder
+//
+struct s_opcode {
+	long address;				// Start address of the opcode
+	long count;					// Size of the opcode in bytes
+	unsigned char addressMode;	// Addressing mode (0-5)
+	unsigned char shift;		// Shift byte (0X00, 0xCB, 0xDD, 0xED, 0xFD)
+	unsigned char byteData[8];	// The byte data
+	const struct s_decode * decode;	// The decode table entry
+	long value[2];				// Values of the operands fetched from the code
+	char text[OPCODE_TEXT_MAX];	// Storage for the opcode text
+};
+
+// Decode table flags
+//
+#define D_AM		0x01		// Addressing mode suffix follows the mnemonic
+#define D_AMPRE		0x02		// Addressing mode suffix precedes the mnemonic (block instructions)
+#define D_DISP		0x04		// Displacement byte precedes the opcode (DD CB d op, FD CB d op)
+#define D_PREFIX	0x08		// Prefix byte; operand1 is the table to continue decoding with
+#define D_SUFFIX	0x10		// Addressing mode suffix; operand1 is the addressing mode
+#define D_TEXT		0x20		// Data listed as a string (host build)
+
+// Decode tables, one per prefix
+//
+#define T_MAIN		0			// Unprefixed
+#define T_CB		1			// CB
+#define T_ED		2			// ED
+#define T_DD		3			// DD (IX)
+#define T_FD		4			// FD (IY)
+#define T_DDCB		5			// DD CB d
+#define T_FDCB		6			// FD CB d
+#define T_COUNT		7
+
+#define DATA_MAX	6			// Maximum number of bytes in a DB line
+
+// Length table entries
+//
+#define L_BYTES		0x03		// Number of operand bytes following the opcode (excluding words)
+#define L_WORD		0x04		// Followed by a word (2 or 3 bytes, depending upon ADL mode and suffix)
+#define L_SUFFIX	0x08		// Addressing mode suffix; bits 5-7 are the addressing mode
+#define L_PREFIX	0x10		// Prefix byte; bits 5-7 are the table to continue with
+
+// Addressing modes
+//
+#define AM_NONE		0
+#define AM_SIS		1
+#define AM_LIS		2
+#define AM_SIL		3
+#define AM_LIL		4
+
+// The ADL mode the destination of a JP, CALL or RST runs in. The IS/IL half of a suffix sets it
+// (.SIS and .LIS for Z80 mode, .SIL and .LIL for ADL mode); without one it is the current mode
+//
+#define decodeMode(o, mode)		((o)->addressMode == AM_NONE ? (mode) : (o)->addressMode >= AM_SIL)
+
+// The address a RST goes to: page 0 in ADL mode, otherwise the segment the RST is in
+//
+#define decodeRestart(o, mode)	((decodeMode(o, mode) ? 0 : (o)->address & 0xFF0000) | ((o)->decode->operand1 - OP_RST00) * 8)
+
+// Mnemonics
+//
+enum {
+	M_NONE = 0,
+	M_NOP, M_LD, M_INC, M_DEC, M_RLCA, M_EX, M_ADD, M_RRCA, M_DJNZ, M_RLA, M_JR, M_RRA, M_DAA, M_CPL, M_SCF, M_CCF,
+	M_HALT, M_ADC, M_SUB, M_SBC, M_AND, M_XOR, M_OR, M_CP, M_RET, M_POP, M_JP, M_CALL, M_PUSH, M_RST, M_OUT, M_EXX,
+	M_IN, M_DI, M_EI, M_RLC, M_RRC, M_RL, M_RR, M_SLA, M_SRA, M_SLL, M_SRL, M_BIT, M_RES, M_SET, M_IN0, M_OUT0,
+	M_LEA, M_TST, M_NEG, M_RETN, M_IM, M_MLT, M_RETI, M_PEA, M_RRD, M_LDMBA, M_LDAMB, M_RLD, M_TSTIO, M_SLP, M_STMIX, M_RSMIX,
+	M_INIM, M_OTIM, M_INI2, M_INDM, M_OTDM, M_IND2, M_INIMR, M_OTIMR, M_INI2R, M_INDMR, M_OTDMR, M_IND2R,
+	M_LDI, M_CPI, M_INI, M_OUTI, M_OUTI2, M_LDD, M_CPD, M_IND, M_OUTD, M_OUTD2,
+	M_LDIR, M_CPIR, M_INIR, M_OTIR, M_OTI2R, M_LDDR, M_CPDR, M_INDR, M_OTDR, M_OTD2R,
+	M_INIRX, M_OTIRX, M_INDRX, M_OTDRX,
+	M_DB, M_DL,
+	M_COUNT
+};
+
+// Operands
+//
+enum {
+	OP_NONE = 0,
+	OP_B, OP_C, OP_D, OP_E, OP_H, OP_L, OP_A, OP_I, OP_R, OP_IXH, OP_IXL, OP_IYH, OP_IYL,					// 8-bit registers
+	OP_BC, OP_DE, OP_HL, OP_SP, OP_AF, OP_AF_, OP_IX, OP_IY,											// 16/24-bit registers
+	OP_IND_BC, OP_IND_DE, OP_IND_HL, OP_IND_SP, OP_IND_IX, OP_IND_IY, OP_IND_C,							// Register indirect
+	OP_CC_NZ, OP_CC_Z, OP_CC_NC, OP_CC_C, OP_CC_PO, OP_CC_PE, OP_CC_P, OP_CC_M,							// Conditions
+	OP_0, OP_1, OP_2, OP_3, OP_4, OP_5, OP_6, OP_7, OP_IM01,											// Bit numbers and interrupt modes
+	OP_RST00, OP_RST08, OP_RST10, OP_RST18, OP_RST20, OP_RST28, OP_RST30, OP_RST38,						// Restart vectors
+	OP_N,																								// From here on the operands are fetched from the code
+	OP_PORT, OP_NN, OP_INN, OP_REL, OP_IXD, OP_IYD, OP_IXO, OP_IYO,
+	OP_COUNT
+};
+
+extern long		adl;									// ADL mode
+
+extern const char *				t_mnemonic[];
+extern const char *				t_operand[];
+extern const char *				t_am[];
+extern const struct s_decode	t_decode[T_COUNT][256];
+extern const unsigned char		t_length[T_COUNT][256];
+extern const unsigned char		t_size[2][256];
+extern const unsigned char		t_sizePrefixed[2][4][256];
+extern const struct s_decode	d_none;
+extern const struct s_decode	d_data;
+
+unsigned char	decodeByte(long * address, struct s_opcode * opcode);
+long			decodeWord(long * address, struct s_opcode * opcode);
+long			decodeJR(long * address, struct s_opcode * opcode);
+void			decodeOpcode(long * address, struct s_opcode * opcode);
+void			decodeInstruction(long * address, struct s_opcode * opcode);
+void			decodeData(long * address, struct s_opcode * opcode, int count);
+int				decodeLength(unsigned char * ptr, long adlMode, unsigned char am);
+
+#endif
@@ -0,0 +1,223 @@
+/*
+ * Title:			Disassembler - Hex Dump
+ * Author:			Dean Belfield
+ * Created:			17/10/2026
+ * Last Updated:	17/10/2026
+ *
+ * Formats memory in the same layout as Memory Dump: the address, 16 bytes in hex, then the
+ * same bytes as ASCII with anything that isn't printable shown as a dot. On an x86 host, whole
+ * rows are converted at once with SSE2 or AVX2; everywhere else, and for the short rows at the
+ * end of a dump, a byte at a time
+ *
+ * Modinfo:
+ */
+
+#include "dump.h"
+
+#if defined(HOST_BUILD) && defined(__GNUC__) && defined(__x86_64__)
+#define DUMP_X86					// SSE2 is always there; AVX2 is checked for when selected
+#include <immintrin.h>
+#endif
+
+static const char t_hex[] = "0123456789ABCDEF";
+
+static void	dumpRowScalar(char * hex, char * ascii, const unsigned char * bytes);
+#ifdef DUMP_X86
+static void	dumpRowSSE2(char * hex, char * ascii, const unsigned char * bytes);
+static void	dumpRowAVX2(char * hex, char * ascii, const unsigned char * bytes);
+#endif
+
+// The engine that converts full rows: 32 hex digits to hex, and 16 characters to ascii
+//
+static void	(* dumpRow)(char * hex, char * ascii, const unsigned char * bytes) = dumpRowScalar;
+
+// Select the engine that converts full rows
+// Parameters:
+// - engine: DUMP_BEST, DUMP_SCALAR, DUMP_SSE2 or DUMP_AVX2
+// Returns:
+// - int: The engine selected, or -1 if the CPU doesn't support it (the engine is unchanged)
+//
+int dumpSelect(int engine) {
+#ifdef DUMP_X86
+	int	avx2 = __builtin_cpu_supports("avx2");
+
+	if(engine == DUMP_BEST) {
+		engine = avx2 ? DUMP_AVX2 : DUMP_SSE2;
+	}
+	switch(engine) {
+		case DUMP_SSE2: {
+			dumpRow = dumpRowSSE2;
+			return engine;
+		} break;
+		case DUMP_AVX2: {
+			if(!avx2) {
+				return -1;
+			}
+			dumpRow = dumpRowAVX2;
+			return engine;
+		} break;
+	}
+#else
+	if(engine == DUMP_BEST) {
+		engine = DUMP_SCALAR;
+	}
+#endif
+	if(engine != DUMP_SCALAR) {
+		return -1;
+	}
+	dumpRow = dumpRowScalar;
+	return engine;
+}
+
+// Write bytes out in hexadecimal, two digits each with nothing in between
+// Parameters:
+// - t: Pointer to the text buffer
+// - bytes: The bytes
+// - count: Number of bytes
+// Returns:
+// - char *: Pointer to the end of the text
+//
+char * dumpHex(char * t, const unsigned char * bytes, int count) {
+	while(count-- > 0) {
+		*t++ = t_hex[*bytes >> 4];
+		*t++ = t_hex[*bytes++ & 0x0F];
+	}
+	return t;
+}
+
+// Write bytes out as ASCII; control characters, DEL and the top half of the character set are
+// written as dots
+// Parameters:
+// - t: Pointer to the text buffer
+// - bytes: The bytes
+// - count: Number of bytes
+// Returns:
+// - char *: Pointer to the end of the text
+//
+char * dumpAscii(char * t, const unsigned char * bytes, int count) {
+	unsigned char	c;
+
+	while(count-- > 0) {
+		c = *bytes++;
+		*t++ = (c > 31 && c < 127) ? c : '.';
+	}
+	return t;
+}
+
+// Build a line of the dump: "AAAAAA: HHHH...HH ASCII". A short row is padded so that its ASCII
+// lines up with the rows above
+// Parameters:
+// - t: Pointer to the line buffer (at least DUMP_LINE_MAX bytes)
+// - address: Address of the first byte
+// - bytes: The bytes
+// - count: Number of bytes (1 to DUMP_ROW)
+// Returns:
+// - int: Length of the line in bytes, excluding the terminator
+//
+int dumpLine(char * t, long address, const unsigned char * bytes, int count) {
+	char *	s = t;
+	int		i;
+
+	for(i = 20; i >= 0; i -= 4) {
+		*t++ = t_hex[(address >> i) & 0x0F];
+	}
+	*t++ = ':';
+	*t++ = ' ';
+	if(count == DUMP_ROW) {
+		dumpRow(t, t + DUMP_ROW * 2 + 1, bytes);
+		t[DUMP_ROW * 2] = ' ';
+		t += DUMP_ROW * 3 + 1;
+	}
+	else {
+		t = dumpHex(t, bytes, count);
+		for(i = count; i < DUMP_ROW; i++) {
+			*t++ = ' ';
+			*t++ = ' ';
+		}
+		*t++ = ' ';
+		t = dumpAscii(t, bytes, count);
+	}
+	*t++ = '\n';
+#ifndef HOST_BUILD
+	*t++ = '\r';
+#endif
+	*t = '\0';
+	return t - s;
+}
+
+// Convert a full row a byte at a time
+// Parameters:
+// - hex: Where to write the 32 hex digits
+// - ascii: Where to write the 16 characters
+// - bytes: The 16 bytes
+//
+static void dumpRowScalar(char * hex, char * ascii, const unsigned char * bytes) {
+	dumpHex(hex, bytes, DUMP_ROW);
+	dumpAscii(ascii, bytes, DUMP_ROW);
+}
+
+#ifdef DUMP_X86
+
+// Replace the bytes that aren't printable with dots. Compared as signed bytes, the printable
+// characters are those above &1F, other than &7F (DEL) which is the largest
+// Parameters:
+// - b: The bytes
+// Returns:
+// - __m128i: The characters
+//
+static inline __m128i dumpPrintable(__m128i b) {
+	__m128i	ok = _mm_and_si128(_mm_cmpgt_epi8(b, _mm_set1_epi8(0x1F)), _mm_cmplt_epi8(b, _mm_set1_epi8(0x7F)));
+
+	return _mm_or_si128(_mm_and_si128(ok, b), _mm_andnot_si128(ok, _mm_set1_epi8('.')));
+}
+
+// Convert nibbles to hex digits: '0' is added to each, and 7 more to those above 9
+// Parameters:
+// - n: The nibbles, one per byte
+// Returns:
+// - __m128i: The digits
+//
+static inline __m128i dumpDigits(__m128i n) {
+	__m128i	letter = _mm_and_si128(_mm_cmpgt_epi8(n, _mm_set1_epi8(9)), _mm_set1_epi8(7));
+
+	return _mm_add_epi8(_mm_add_epi8(n, _mm_set1_epi8('0')), letter);
+}
+
+// Convert a full row with SSE2; the high and low nibbles are split out and interleaved, so that
+// the digits come out in order
+// Parameters:
+// - hex: Where to write the 32 hex digits
+// - ascii: Where to write the 16 characters
+// - bytes: The 16 bytes
+//
+static void dumpRowSSE2(char * hex, char * ascii, const unsigned char * bytes) {
+	__m128i	b = _mm_loadu_si128((const __m128i *)bytes);
+	__m128i	mask = _mm_set1_epi8(0x0F);
+	__m128i	hi = _mm_and_si128(_mm_srli_epi16(b, 4), mask);
+	__m128i	lo = _mm_and_si128(b, mask);
+
+	_mm_storeu_si128((__m128i *)hex, dumpDigits(_mm_unpacklo_epi8(hi, lo)));
+	_mm_storeu_si128((__m128i *)(hex + 16), dumpDigits(_mm_unpackhi_epi8(hi, lo)));
+	_mm_storeu_si128((__m128i *)ascii, dumpPrintable(b));
+}
+
+// Convert a full row with AVX2. Each byte is widened to 16 bits, with its high nibble moved to
+// the low byte and its low nibble to the high byte; the nibbles are then looked up in a table of
+// digits, all 32 at once
+// Parameters:
+// - hex: Where to write the 32 hex digits
+// - ascii: Where to write the 16 characters
+// - bytes: The 16 bytes
+//
+__attribute__((target("avx2")))
+static void dumpRowAVX2(char * hex, char * ascii, const unsigned char * bytes) {
+	__m128i	b = _mm_loadu_si128((const __m128i *)bytes);
+	__m256i	w = _mm256_cvtepu8_epi16(b);
+	__m256i	n = _mm256_or_si256(_mm256_srli_epi16(w, 4), _mm256_slli_epi16(_mm256_and_si256(w, _mm256_set1_epi16(0x0F)), 8));
+	__m256i	digits = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *)t_hex));
+
+	_mm256_storeu_si256((__m256i *)hex, _mm256_shuffle_epi8(digits, n));
+	_mm_storeu_si128((__m128i *)ascii, dumpPrintable(b));
+}
+
+#endif
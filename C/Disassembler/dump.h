@@ -0,0 +1,27 @@
+/*
+ * Title:			Disassembler - Hex Dump
+ * Author:			Dean Belfield
+ * Created:			17/10/2026
+ * Last Updated:	17/10/2026
+ *
+ * Modinfo:
+ */
+
+#ifndef DUMP_H
+#define DUMP_H
+
+#define DUMP_ROW		16			// Bytes in a row of the dump
+#define DUMP_LINE_MAX	64			// Maximum size of a dump line, including the terminator
+
+#define DUMP_BEST		-1			// The fastest engine the CPU supports
+#define DUMP_SCALAR		0			// One byte at a time
+#define DUMP_SSE2		1			// A row at a time with SSE2 (x86 host build)
+#define DUMP_AVX2		2			// A row at a time with AVX2 (x86 host build)
+#define DUMP_COUNT		3
+
+int		dumpSelect(int engine);
+char *	dumpHex(char * t, const unsigned char * bytes, int count);
+char *	dumpAscii(char * t, const unsigned char * bytes, int count);
+int		dumpLine(char * t, long address, const unsigned char * bytes, int count);
+
+#endif
@@ -0,0 +1,170 @@
+/*
+ * Title:			Disassembler - Control Flow (host build)
+ * Author:			Dean Belfield
+ * Created:			17/10/2026
+ * Last Updated:	17/10/2026
+ *
+ * Finds the code in an image by following jumps and calls from the entry points
+ *
+ * Modinfo:
+ * 17/10/2026:		Code is traced in the ADL mode it runs in, which is recorded in the map
+ * 17/10/2026:		References made by the code are added to the cross-reference index
+ * 17/10/2026:		The IS/IL half of a suffix sets the mode of the destination, not the S/L half
+ * 17/10/2026:		The trace only decodes, and leaves the text to be formatted when the code is listed
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "decode.h"
+#include "flow.h"
+#include "xref.h"
+
+struct s_flow	flow;
+
+// Allocate the map for a range of addresses
+// Parameters:
+// - base: Address of the first byte
+// - length: Number of bytes
+// Returns:
+// - 1: OK
+// - 0: Out of memory
+//
+int flowOpen(long base, long length) {
+	memset(&flow, 0, sizeof(flow));
+	flow.map = calloc(length > 0 ? length : 1, 1);
+	flow.base = base;
+	flow.length = length;
+	return flow.map != NULL;
+}
+
+// Free the map
+//
+void flowClose(void) {
+	free(flow.map);
+	free(flow.queue);
+	memset(&flow, 0, sizeof(flow));
+}
+
+// Mark a range of bytes as data, so that they are never decoded as instructions
+// Parameters:
+// - address: Address of the first byte
+// - length: Number of bytes
+//
+void flowData(long address, long length) {
+	for(; length > 0; address++, length--) {
+		if((unsigned long)(address - flow.base) < (unsigned long)flow.length) {
+			flowMap(address) = FLOW_DATA;
+		}
+	}
+}
+
+// Add an address to the queue of addresses to trace; addresses outside the map, or that have
+// already been reached, are ignored
+// Parameters:
+// - address: The address
+// - mode: ADL mode the code at the address runs in
+//
+void flowEntry(long address, long mode) {
+	struct s_entry *	queue;
+
+	if((unsigned long)(address - flow.base) >= (unsigned long)flow.length || flowMap(address) != FLOW_UNKNOWN) {
+		return;
+	}
+	if(flow.queueLength == flow.queueMax) {
+		flow.queueMax = flow.queueMax ? flow.queueMax * 2 : 256;
+		queue = realloc(flow.queue, flow.queueMax * sizeof(struct s_entry));
+		if(queue == NULL) {
+			return;
+		}
+		flow.queue = queue;
+	}
+	flow.queue[flow.queueLength].address = address;
+	flow.queue[flow.queueLength].adl = mode;
+	flow.queueLength++;
+}
+
+// Trace every address in the queue. Each path is decoded until it reaches an instruction that
+// doesn't fall through, bytes that have already been reached, or bytes that aren't a valid
+// instruction; every instruction is decoded once. Each path is decoded in the ADL mode it was
+// queued with, which is recorded against the bytes of every instruction on it
+//
+void flowTrace(void) {
+	struct s_opcode	opcode;
+	long			address, next, a;
+	long			mode = adl;
+	unsigned char	code;
+
+	while(flow.queueLength > 0) {
+		flow.queueLength--;
+		address = flow.queue[flow.queueLength].address;
+		adl = flow.queue[flow.queueLength].adl;
+		code = adl ? FLOW_ADL : 0;
+		while((unsigned long)(address - flow.base) < (unsigned long)flow.length && flowMap(address) == FLOW_UNKNOWN) {
+			next = address;
+			decodeInstruction(&next, &opcode);
+			if(opcode.decode->mnemonic == M_NONE || next > flow.base + flow.length) {
+				break;
+			}
+			for(a = address + 1; a < next && flowMap(a) == FLOW_UNKNOWN; a++);
+			if(a < next) {
+				break;					// Overlaps an instruction or data that is already known
+			}
+			flowMap(address) = FLOW_CODE | code;
+			for(a = address + 1; a < next; a++) {
+				flowMap(a) = FLOW_BODY | code;
+			}
+			xrefAdd(&opcode);
+			if(!flowFollow(&opcode)) {
+				break;
+			}
+			address = next;
+		}
+	}
+	adl = mode;
+}
+
+// Queue the destination of a jump, call or restart. A suffix on JP, CALL and RST sets the ADL
+// mode of the destination (see decodeMode); JR and DJNZ, and the instruction after a call, stay
+// in the current mode
+// Parameters:
+// - opcode: The decoded instruction, decoded in the current ADL mode
+// Returns:
+// - 1: Execution can continue with the next instruction
+// - 0: It can't (unconditional jumps and returns)
+//
+int flowFollow(struct s_opcode * opcode) {
+	const struct s_decode *	d = opcode->decode;
+	long					mode = decodeMode(opcode, adl);
+
+	switch(d->mnemonic) {
+		case M_JP:
+		case M_JR:
+		case M_CALL:
+		case M_DJNZ: {
+			if(d->mnemonic == M_JR || d->mnemonic == M_DJNZ) {
+				mode = adl;
+			}
+			if(d->operand1 == OP_NN || d->operand1 == OP_REL) {
+				flowEntry(opcode->value[0], mode);
+				return d->mnemonic == M_CALL || d->mnemonic == M_DJNZ;
+			}
+			if(d->operand2 == OP_NN || d->operand2 == OP_REL) {
+				flowEntry(opcode->value[1], mode);
+				return 1;				// Conditional
+			}
+			return d->mnemonic != M_JP;	// JP (HL), JP (IX), JP (IY)
+		} break;
+		case M_RST: {
+			flowEntry(decodeRestart(opcode, adl), mode);
+		} break;
+		case M_RET: {
+			return d->operand1 != OP_NONE;
+		} break;
+		case M_RETI:
+		case M_RETN: {
+			return 0;
+		} break;
+	}
+	return 1;
+}
@@ -0,0 +1,54 @@
+/*
+ * Title:			Disassembler - Control Flow (host build)
+ * Author:			Dean Belfield
+ * Created:			17/10/2026
+ * Last Updated:	17/10/2026
+ *
+ * Modinfo:
+ * 17/10/2026:		Code is traced in the ADL mode it runs in, which is recorded in the map
+ */
+
+#ifndef FLOW_H
+#define FLOW_H
+
+#include "decode.h"
+
+#define FLOW_UNKNOWN	0			// Not reached
+#define FLOW_CODE		1			// First byte of an instruction
+#define FLOW_BODY		2			// Subsequent byte of an instruction
+#define FLOW_DATA		3			// Known to be data
+#define FLOW_ADL		0x80		// Set on the bytes of instructions decoded in ADL mode
+
+// An address waiting to be traced
+//
+struct s_entry {
+	long			address;		// The address
+	long			adl;			// ADL mode the code there runs in
+};
+
+// The result of following the control flow through an image
+//
+struct s_flow {
+	unsigned char *	map;			// One FLOW_* entry per byte of the image
+	long			base;			// Address of the first byte of the map
+	long			length;			// Size of the map in bytes
+	struct s_entry *	queue;		// Addresses waiting to be traced
+	int				queueLength;	// Number of addresses in the queue
+	int				queueMax;		// Space allocated for the queue
+};
+
+extern struct s_flow	flow;
+
+// Get the FLOW_* entry for an address in the map, with and without the ADL mode
+//
+#define flowMap(a)	(flow.map[(a) - flow.base])
+#define flowType(a)	(flowMap(a) & ~FLOW_ADL)
+
+int		flowOpen(long base, long length);
+void	flowClose(void);
+void	flowData(long address, long length);
+void	flowEntry(long address, long mode);
+void	flowTrace(void);
+int		flowFollow(struct s_opcode * opcode);
+
+#endif
@@ -0,0 +1,404 @@
+/*
+ * Title:			Disassembler - Formatter
+ * Author:			Dean Belfield
+ * Created:			17/10/2026
+ * Last Updated:	17/10/2026
+ *
+ * Modinfo:
+ * 17/10/2026:		Added formatAssume
+ * 17/10/2026:		Addresses with a cross-reference label are written as the label (host build)
+ * 17/10/2026:		Addresses and ports with a symbol are written as the symbol (host build)
+ * 17/10/2026:		Operands, data and directives are written in the selected syntax; added formatOrg and formatEqu
+ * 17/10/2026:		The ASCII column is written by dumpAscii
+ * 17/10/2026:		Strings are written in quotes, and the addresses in a DL always with 6 digits (host build)
+ * 17/10/2026:		Only addresses are written as a symbol: jump and call targets, memory operands and pointers, not immediates or ports
+ * 17/10/2026:		Clean with -Wextra
+ * 17/10/2026:		Ports are written as a symbol if an equate below &100 names them (host build)
+ */
+
+#include <stddef.h>
+
+#include "decode.h"
+#include "dump.h"
+#include "format.h"
+#include "syntax.h"
+
+#ifdef HOST_BUILD
+#include "symbol.h"
+#include "xref.h"
+#endif
+
+static const char t_hex[] = "0123456789ABCDEF";
+
+// Write a number out in hexadecimal
+// Parameters:
+// - t: Pointer to the text buffer
+// - value: The number to write
+// - digits: Number of digits to write (leading zeros are included)
+// Returns:
+// - char *: Pointer to the end of the text
+//
+char * formatHex(char * t, unsigned long value, int digits) {
+	char *	e = t + digits;
+
+	while(digits-- > 0) {
+		t[digits] = t_hex[value & 0x0F];
+		value >>= 4;
+	}
+	return e;
+}
+
+// Write a signed displacement out in decimal, always with a sign (as printf's %+d)
+// Parameters:
+// - t: Pointer to the text buffer
+// - value: The number to write (-128 to 127)
+// Returns:
+// - char *: Pointer to the end of the text
+//
+char * formatSigned(char * t, int value) {
+	if(value < 0) {
+		*t++ = '-';
+		value = -value;
+	}
+	else {
+		*t++ = '+';
+	}
+	if(value >= 100) {
+		*t++ = '0' + value / 100;
+		value %= 100;
+		*t++ = '0' + value / 10;
+	}
+	else if(value >= 10) {
+		*t++ = '0' + value / 10;
+	}
+	*t++ = '0' + value % 10;
+	return t;
+}
+
+// Copy a string (without the terminator)
+// Parameters:
+// - t: Pointer to the text buffer
+// - s: The string to copy
+// Returns:
+// - char *: Pointer to the end of the text
+//
+char * formatString(char * t, const char * s) {
+	while(*s) {
+		*t++ = *s++;
+	}
+	return t;
+}
+
+// Write an operand out
+// Parameters:
+// - t: Pointer to the text buffer
+// - operand: The operand (OP_*)
+// - value: The value fetched from the code, if any
+// - digits: Number of digits to write a word out with (4 or 6)
+// - target: Set if a word is an address: the target of a jump or call, or an entry in a pointer table
+// Returns:
+// - char *: Pointer to the end of the text
+//
+char * formatOperand(char * t, unsigned char operand, long value, int digits, int target) {
+#ifndef HOST_BUILD
+	(void)target;						// Only symbols need it
+#endif
+	switch(operand) {
+		case OP_N:
+		case OP_PORT: {
+#ifdef HOST_BUILD
+			if(operand == OP_PORT && symbolPort(value)) {
+				t = formatString(t, syntax.label[operand]);
+				t = formatString(t, symbolPort(value));
+				return formatString(t, syntax.labelClose[operand]);
+			}
+#endif
+			t = formatString(t, syntax.operand[operand]);
+			t = formatHex(t, value, 2);
+		} break;
+		case OP_NN:
+		case OP_INN:
+		case OP_REL: {
+#ifdef HOST_BUILD
+			//
+			// A word that isn't an address, as in LD HL,nn, is as likely to be a count or a
+			// constant that an equate happens to share, so it isn't written as a symbol
+			//
+			if(((operand != OP_NN || target) && symbolFind(value)) || xrefLabel(value)) {
+				t = formatString(t, syntax.label[operand]);
+				t = formatLabel(t, value);
+				return formatString(t, syntax.labelClose[operand]);
+			}
+#endif
+			t = formatString(t, syntax.operand[operand]);
+			t = formatHex(t, value, operand == OP_REL ? 6 : digits);
+		} break;
+		case OP_IXD:
+		case OP_IYD:
+		case OP_IXO:
+		case OP_IYO: {
+			t = formatString(t, syntax.operand[operand]);
+			t = formatSigned(t, (int)value);
+		} break;
+		default: {
+			return formatString(t, syntax.operand[operand]);
+		}
+	}
+	return formatString(t, syntax.close[operand]);
+}
+
+#ifdef HOST_BUILD
+// Build the text for part of a string: the characters that can be written in quotes are, and
+// the rest (and any quotes or backslashes) are written as hex bytes
+// Parameters:
+// - opcode: Pointer to the opcode structure
+//
+static void formatText(struct s_opcode * opcode) {
+	char *			t = formatString(opcode->text, syntax.db);
+	unsigned char	b;
+	int				quoted = 0;
+	int				i;
+
+	for(i = 0; i < opcode->count; i++) {
+		b = opcode->byteData[i];
+		if(b >= 0x20 && b < 0x7F && b != '"' && b != '\\') {
+			if(!quoted) {
+				if(i > 0) {
+					*t++ = ',';
+				}
+				*t++ = '"';
+				quoted = 1;
+			}
+			*t++ = b;
+			continue;
+		}
+		if(quoted) {
+			*t++ = '"';
+			quoted = 0;
+		}
+		if(i > 0) {
+			*t++ = ',';
+		}
+		t = formatString(t, syntax.hex);
+		t = formatHex(t, b, 2);
+		t = formatString(t, syntax.hexClose);
+	}
+	if(quoted) {
+		*t++ = '"';
+	}
+	*t = '\0';
+}
+#endif
+
+// Build the mnemonic text for a decoded opcode. In source, an instruction that wouldn't
+// reassemble to the same bytes is written as data
+// Parameters:
+// - opcode: Pointer to the opcode structure
+//
+void formatOpcode(struct s_opcode * opcode) {
+	const struct s_decode *	d = opcode->decode;
+	const char *			am = t_am[opcode->addressMode];
+	char *					t = opcode->text;
+	unsigned char			pre = d->flags & syntax.amPre;
+	int						digits = 6;
+	int						target = d->mnemonic == M_JP || d->mnemonic == M_CALL || d->mnemonic == M_DL;
+	int						i;
+
+#ifdef HOST_BUILD
+	if(d->flags & D_TEXT) {
+		formatText(opcode);
+		return;
+	}
+#endif
+	if(d->mnemonic == M_DB || !syntaxValid(opcode)) {
+		t = formatString(t, syntax.db);
+		for(i = 0; i < opcode->count; i++) {
+			if(i > 0) {
+				*t++ = ',';
+			}
+			t = formatString(t, syntax.hex);
+			t = formatHex(t, opcode->byteData[i], 2);
+			t = formatString(t, syntax.hexClose);
+		}
+		*t = '\0';
+		return;
+	}
+
+	if(!syntax.segment && d->mnemonic != M_DL && !(opcode->addressMode == AM_NONE ? adl == 1 : opcode->addressMode >= AM_SIL)) {
+		digits = 4;						// A 16-bit word, written without the segment
+	}
+	if(pre) {
+		t = formatString(t, am);
+	}
+	t = formatString(t, t_mnemonic[d->mnemonic]);
+	if(!pre && (d->flags & (D_AM | D_AMPRE))) {
+		t = formatString(t, am);
+	}
+	if(d->operand1 != OP_NONE) {
+		*t++ = ' ';
+		t = formatOperand(t, d->operand1, opcode->value[0], digits, target);
+		if(d->operand2 != OP_NONE) {
+			*t++ = ',';
+			t = formatOperand(t, d->operand2, opcode->value[1], digits, target);
+		}
+	}
+	*t = '\0';
+}
+
+// Build a listing line: address, opcode bytes, opcode chars and mnemonics; in source, just the
+// mnemonics
+// Parameters:
+// - t: Pointer to the line buffer (at least FORMAT_LINE_MAX bytes)
+// - opcode: Pointer to the opcode structure
+// Returns:
+// - int: Length of the line in bytes, excluding the terminator
+//
+int formatLine(char * t, struct s_opcode * opcode) {
+	char *	s = t;
+	int		i;
+
+	if(syntax.source) {
+		t = formatString(t, syntax.column);
+		t = formatString(t, opcode->text);
+		*t++ = '\n';
+		*t = '\0';
+		return t - s;
+	}
+	t = formatHex(t, opcode->address, 6);
+	*t++ = ' ';
+	for(i = 0; i < opcode->count; i++) {
+		t = formatHex(t, opcode->byteData[i], 2);
+		*t++ = ' ';
+	}
+	for(i = opcode->count; i < 6; i++) {
+		*t++ = ' ';
+		*t++ = ' ';
+		*t++ = ' ';
+	}
+	t = dumpAscii(t, opcode->byteData, opcode->count);
+	for(i = opcode->count; i < 6; i++) {
+		*t++ = ' ';
+	}
+	*t++ = ' ';
+	t = formatString(t, opcode->text);
+	*t++ = '\n';
+#ifndef HOST_BUILD
+	*t++ = '\r';
+#endif
+	*t = '\0';
+	return t - s;
+}
+
+// Write a label out: the symbol for the address if there is one (host build), otherwise a
+// generated label
+// Parameters:
+// - t: Pointer to the text buffer
+// - address: The address the label is for
+// Returns:
+// - char *: Pointer to the end of the text
+//
+char * formatLabel(char * t, long address) {
+#ifdef HOST_BUILD
+	const char *	s = symbolFind(address);
+
+	if(s) {
+		return formatString(t, s);
+	}
+#endif
+	*t++ = 'L';
+	return formatHex(t, address, 6);
+}
+
+// Build a listing line with a directive or label in the mnemonics column
+// Parameters:
+// - t: Pointer to the line buffer (at least FORMAT_LINE_MAX bytes)
+// - s: The directive, or NULL for a label
+// - value: The ADL mode for a directive, or the address for a label
+// Returns:
+// - int: Length of the line in bytes, excluding the terminator
+//
+static int formatColumn(char * t, const char * s, long value) {
+	char *	e = t;
+
+	if(s) {
+		t = formatString(t, syntax.column);
+		t = formatString(t, s);
+		*t++ = '0' + (value != 0);
+	}
+	else {
+		t = formatString(t, syntax.labelColumn);
+		t = formatLabel(t, value);
+		*t++ = ':';
+	}
+	*t++ = '\n';
+#ifndef HOST_BUILD
+	*t++ = '\r';
+#endif
+	*t = '\0';
+	return t - e;
+}
+
+// Build a listing line that marks a change of ADL mode, with the directive in the mnemonics column
+// Parameters:
+// - t: Pointer to the line buffer (at least FORMAT_LINE_MAX bytes)
+// - mode: The ADL mode from here on
+// Returns:
+// - int: Length of the line in bytes, excluding the terminator
+//
+int formatAssume(char * t, long mode) {
+	return formatColumn(t, syntax.assume, mode);
+}
+
+// Build a listing line that defines a generated label
+// Parameters:
+// - t: Pointer to the line buffer (at least FORMAT_LINE_MAX bytes)
+// - address: The address of the label
+// Returns:
+// - int: Length of the line in bytes, excluding the terminator
+//
+int formatLabelLine(char * t, long address) {
+	return formatColumn(t, NULL, address);
+}
+
+#ifdef HOST_BUILD
+// Build the origin directive that starts assembler source
+// Parameters:
+// - t: Pointer to the line buffer (at least FORMAT_LINE_MAX bytes)
+// - address: The address the code is assembled at
+// Returns:
+// - int: Length of the line in bytes, excluding the terminator
+//
+int formatOrg(char * t, long address) {
+	char *	s = t;
+
+	t = formatString(t, syntax.column);
+	t = formatString(t, syntax.org);
+	t = formatString(t, syntax.hex);
+	t = formatHex(t, address, 6);
+	t = formatString(t, syntax.hexClose);
+	*t++ = '\n';
+	*t = '\0';
+	return t - s;
+}
+
+// Build a line that defines a symbol that isn't a label in assembler source
+// Parameters:
+// - t: Pointer to the line buffer (at least FORMAT_LINE_MAX bytes)
+// - address: The value of the symbol
+// Returns:
+// - int: Length of the line in bytes, excluding the terminator
+//
+int formatEqu(char * t, long address) {
+	char *	s = t;
+
+	t = formatString(t, syntax.labelColumn);
+	t = formatLabel(t, address);
+	t = formatString(t, syntax.equ);
+	t = formatString(t, syntax.hex);
+	t = formatHex(t, address, 6);
+	t = formatString(t, syntax.hexClose);
+	*t++ = '\n';
+	*t = '\0';
+	return t - s;
+}
+#endif
@@ -0,0 +1,40 @@
+/*
+ * Title:			Disassembler - Formatter
+ * Author:			Dean Belfield
+ * Created:			17/10/2026
+ * Last Updated:	17/10/2026
+ *
+ * Modinfo:
+ * 17/10/2026:		Added formatAssume
+ * 17/10/2026:		Added formatLabel and formatLabelLine
+ * 17/10/2026:		Longer lines in the host build, for symbol names
+ * 17/10/2026:		Added formatOrg and formatEqu; words are written with 4 or 6 digits
+ * 17/10/2026:		formatOperand is told whether a word is an address
+ */
+
+#ifndef FORMAT_H
+#define FORMAT_H
+
+#include "decode.h"
+
+#ifdef HOST_BUILD
+#define FORMAT_LINE_MAX		128		// Maximum size of a listing line, including the terminator
+#else
+#define FORMAT_LINE_MAX		80
+#endif
+
+char *	formatHex(char * t, unsigned long value, int digits);
+char *	formatSigned(char * t, int value);
+char *	formatString(char * t, const char * s);
+char *	formatOperand(char * t, unsigned char operand, long value, int digits, int target);
+void	formatOpcode(struct s_opcode * opcode);
+int		formatLine(char * t, struct s_opcode * opcode);
+int		formatAssume(char * t, long mode);
+char *	formatLabel(char * t, long address);
+int		formatLabelLine(char * t, long address);
+#ifdef HOST_BUILD
+int		formatOrg(char * t, long address);
+int		formatEqu(char * t, long address);
+#endif
+
+#endif
@@ -0,0 +1,534 @@
+/*
+ * Title:			Disassembler - Control Flow and Call Graphs (host build)
+ * Author:			Dean Belfield
+ * Created:			17/10/2026
+ * Last Updated:	17/10/2026
+ *
+ * Splits the code in a range of the image into basic blocks, and writes out the control flow
+ * graph or the call graph. A block starts at the target of a branch or call, and after a JP, JR,
+ * DJNZ, RET, RETI, RETN or RST; a function is the blocks that can be reached from a call target
+ * without another call. The instructions are added in address order, so each step is a single
+ * pass over the map, the blocks or the edges
+ *
+ * Modinfo:
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "decode.h"
+#include "format.h"
+#include "graph.h"
+#include "output.h"
+#include "symbol.h"
+#include "xref.h"
+
+#define GRAPH_SEEN		0x1000000	// Number of bits in the set of callees; one per address in the eZ80's 24-bit address space
+
+struct s_graph	graph;
+
+static const char	t_edgeTag[] = "fjc";	// Tag for each E_* type in the adjacency format
+
+static int		graphGrow(void ** ptr, long * max, long count, int size);
+static long		graphFind(long address);
+static void		graphOwn(long root, long * queue);
+static void		graphCfg(int format);
+static void		graphCalls(int format);
+static void		graphNode(char prefix, long address, const char * label, long count);
+static void		graphLine(long address, long count);
+static void		graphEdge(char prefix, long from, struct s_edge * e, int format);
+static char *	graphNumber(char * t, long value);
+
+// Allocate the map for a range of addresses
+// Parameters:
+// - base: Address of the first byte
+// - length: Number of bytes
+// Returns:
+// - 1: OK
+// - 0: Out of memory
+//
+int graphOpen(long base, long length) {
+	memset(&graph, 0, sizeof(graph));
+	graph.base = base;
+	graph.length = length;
+	graph.map = calloc(length > 0 ? length : 1, 1);
+	graph.index = malloc((length > 0 ? length : 1) * sizeof(long));
+	return graph.map != NULL && graph.index != NULL;
+}
+
+// Free the graph
+//
+void graphClose(void) {
+	free(graph.map);
+	free(graph.index);
+	free(graph.branch);
+	free(graph.node);
+	free(graph.edge);
+	memset(&graph, 0, sizeof(graph));
+}
+
+// Mark an entry point; it starts a function, as if it were called
+// Parameters:
+// - address: The address
+//
+void graphEntry(long address) {
+	if((unsigned long)(address - graph.base) < (unsigned long)graph.length) {
+		graph.map[address - graph.base] |= G_LEADER | G_CALLED;
+	}
+}
+
+// Add a decoded instruction; instructions must be added in address order
+// Parameters:
+// - opcode: The decoded instruction
+// Returns:
+// - 1: OK
+// - 0: Out of memory
+//
+int graphAdd(struct s_opcode * opcode) {
+	const struct s_decode *	d = opcode->decode;
+	struct s_branch *		b;
+	long					offset = opcode->address - graph.base;
+	long					i, target;
+	int						type;
+
+	if((unsigned long)offset >= (unsigned long)graph.length || d->mnemonic == M_DB || d->mnemonic == M_NONE) {
+		return 1;
+	}
+	graph.map[offset] |= G_CODE;
+	for(i = 1; i < opcode->count && offset + i < graph.length; i++) {
+		graph.map[offset + i] |= G_BODY;
+	}
+	switch(d->mnemonic) {
+		case M_JP:
+		case M_JR: {
+			graph.map[offset] |= G_END | (d->operand2 != OP_NONE ? G_FALL : 0);	// Conditional
+		} break;
+		case M_DJNZ:
+		case M_RST: {
+			graph.map[offset] |= G_END | G_FALL;
+		} break;
+		case M_RET: {
+			graph.map[offset] |= G_END | (d->operand1 != OP_NONE ? G_FALL : 0);
+		} break;
+		case M_RETI:
+		case M_RETN: {
+			graph.map[offset] |= G_END;
+		} break;
+	}
+	type = xrefTarget(opcode, &target);
+	if(type != XREF_CALL && type != XREF_JUMP) {
+		return 1;
+	}
+	if(!graphGrow((void **)&graph.branch, &graph.branchMax, graph.branches, sizeof(struct s_branch))) {
+		return 0;
+	}
+	b = &graph.branch[graph.branches++];
+	b->source = opcode->address;
+	b->target = target;
+	b->type = type == XREF_CALL ? E_CALL : E_JUMP;
+	if((unsigned long)(target - graph.base) < (unsigned long)graph.length) {
+		graph.map[target - graph.base] |= G_LEADER | (type == XREF_CALL ? G_CALLED : 0);
+	}
+	return 1;
+}
+
+// Split the instructions into blocks, join them up with edges, and work out which function
+// each block is part of
+// Returns:
+// - 1: OK
+// - 0: Out of memory
+//
+int graphBuild(void) {
+	struct s_node *	n = NULL;
+	struct s_edge *	e;
+	long			nodeMax = 0, edgeMax = 0;
+	long			a, i, k = 0;
+	long *			queue;
+	unsigned char	m;
+	int				round;
+
+	//
+	// One pass over the map: a block starts at a leader, after an instruction that ends one, or
+	// after a gap in the code
+	//
+	for(a = 0; a < graph.length; a++) {
+		m = graph.map[a];
+		if(m & G_CODE) {
+			if(n == NULL || (m & G_LEADER) || (n->flags & G_END) || n->end != graph.base + a) {
+				if(!graphGrow((void **)&graph.node, &nodeMax, graph.nodes, sizeof(struct s_node))) {
+					return 0;
+				}
+				n = &graph.node[graph.nodes];
+				memset(n, 0, sizeof(struct s_node));
+				n->address = graph.base + a;
+				n->owner = -1;
+				graph.index[a] = graph.nodes++;
+			}
+			n->count++;
+			n->flags = m;
+			n->end = graph.base + a + 1;
+		}
+		else if((m & G_BODY) && n != NULL && n->end == graph.base + a) {
+			n->end++;
+		}
+	}
+
+	//
+	// One pass over the blocks, and the branches alongside them: the branches and calls in each
+	// block, then the fall through to the next
+	//
+	for(i = 0; i < graph.nodes; i++) {
+		n = &graph.node[i];
+		n->edge = graph.edges;
+		for(; k < graph.branches && graph.branch[k].source < n->end; k++) {
+			if(graph.branch[k].source < n->address) {
+				continue;					// Not in a block
+			}
+			if(!graphGrow((void **)&graph.edge, &edgeMax, graph.edges, sizeof(struct s_edge))) {
+				return 0;
+			}
+			e = &graph.edge[graph.edges++];
+			e->from = i;
+			e->target = graph.branch[k].target;
+			e->to = graphFind(e->target);
+			e->type = graph.branch[k].type;
+		}
+		if((!(n->flags & G_END) || (n->flags & G_FALL)) && i + 1 < graph.nodes && graph.node[i + 1].address == n->end) {
+			if(!graphGrow((void **)&graph.edge, &edgeMax, graph.edges, sizeof(struct s_edge))) {
+				return 0;
+			}
+			e = &graph.edge[graph.edges++];
+			e->from = i;
+			e->target = n->end;
+			e->to = i + 1;
+			e->type = E_FALL;
+		}
+		n->edges = graph.edges - n->edge;
+	}
+	for(i = 0; i < graph.edges; i++) {
+		if(graph.edge[i].type != E_CALL && graph.edge[i].to >= 0) {
+			graph.node[graph.edge[i].to].entered = 1;
+		}
+	}
+
+	//
+	// Each call target starts a function; so does any block that can't be reached from another
+	// block, then any left over (loops that can only be reached from themselves)
+	//
+	queue = malloc((graph.nodes > 0 ? graph.nodes : 1) * sizeof(long));
+	if(queue == NULL) {
+		return 0;
+	}
+	for(i = 0; i < graph.nodes; i++) {
+		if(graph.map[graph.node[i].address - graph.base] & G_CALLED) {
+			graph.node[i].owner = i;
+		}
+	}
+	for(round = 0; round < 2; round++) {
+		for(i = 0; i < graph.nodes; i++) {
+			n = &graph.node[i];
+			if(round == 0 ? n->owner == i || (n->owner < 0 && !n->entered) : n->owner < 0) {
+				graphOwn(i, queue);
+			}
+		}
+	}
+	free(queue);
+	return 1;
+}
+
+// Write the graph out
+// Parameters:
+// - type: GRAPH_CFG or GRAPH_CALLS
+// - format: GRAPH_DOT or GRAPH_ADJACENCY
+//
+void graphWrite(int type, int format) {
+	if(format == GRAPH_DOT) {
+		outputString(type == GRAPH_CFG ? "digraph cfg {\n" : "digraph calls {\n");
+		outputString("\tnode [shape=box, fontname=\"monospace\"];\n");
+	}
+	if(type == GRAPH_CFG) {
+		graphCfg(format);
+	}
+	else {
+		graphCalls(format);
+	}
+	if(format == GRAPH_DOT) {
+		outputString("}\n");
+	}
+}
+
+// Make sure there is room for one more element in an array, doubling its size if there isn't
+// Parameters:
+// - ptr: Pointer to the array
+// - max: Pointer to the number of elements allocated
+// - count: Number of elements in use
+// - size: Size of an element
+// Returns:
+// - 1: OK
+// - 0: Out of memory
+//
+static int graphGrow(void ** ptr, long * max, long count, int size) {
+	void *	p;
+
+	if(count < *max) {
+		return 1;
+	}
+	p = realloc(*ptr, (size_t)(*max ? *max * 2 : 4096) * size);
+	if(p == NULL) {
+		return 0;
+	}
+	*ptr = p;
+	*max = *max ? *max * 2 : 4096;
+	return 1;
+}
+
+// Find the block that starts at an address
+// Parameters:
+// - address: The address
+// Returns:
+// - long: Index of the block, or -1 if no block starts there
+//
+static long graphFind(long address) {
+	long	offset = address - graph.base;
+
+	if((unsigned long)offset >= (unsigned long)graph.length || (graph.map[offset] & (G_CODE | G_LEADER)) != (G_CODE | G_LEADER)) {
+		return -1;						// Outside the range, or in the middle of an instruction
+	}
+	return graph.index[offset];
+}
+
+// Make a block the start of a function, along with every block that can be reached from it
+// through jumps and falls that isn't already part of a function
+// Parameters:
+// - root: Index of the block
+// - queue: Space for the index of every block
+//
+static void graphOwn(long root, long * queue) {
+	struct s_node *	n;
+	struct s_edge *	e;
+	long			head = 0, tail = 0;
+	long			i;
+
+	graph.node[root].owner = root;
+	queue[tail++] = root;
+	while(head < tail) {
+		n = &graph.node[queue[head++]];
+		for(i = 0; i < n->edges; i++) {
+			e = &graph.edge[n->edge + i];
+			if(e->type != E_CALL && e->to >= 0 && graph.node[e->to].owner < 0) {
+				graph.node[e->to].owner = root;
+				queue[tail++] = e->to;
+			}
+		}
+	}
+}
+
+// Write the control flow graph out: each block, then the jumps and falls from it. In the
+// adjacency format, a block is "address instructions", followed by a tag and the address of
+// each successor: f (fall) or j (jump)
+// Parameters:
+// - format: GRAPH_DOT or GRAPH_ADJACENCY
+//
+static void graphCfg(int format) {
+	struct s_node *	n;
+	long			i, k;
+
+	for(i = 0; i < graph.nodes; i++) {
+		n = &graph.node[i];
+		if(format == GRAPH_DOT) {
+			graphNode('b', n->address, n->count == 1 ? " instruction" : " instructions", n->count);
+		}
+		else {
+			graphLine(n->address, n->count);
+		}
+		for(k = 0; k < n->edges; k++) {
+			if(graph.edge[n->edge + k].type != E_CALL) {
+				graphEdge('b', n->address, &graph.edge[n->edge + k], format);
+			}
+		}
+		if(format == GRAPH_ADJACENCY) {
+			outputString("\n");
+		}
+	}
+}
+
+// Write the call graph out: each function, then the functions it calls, each listed once. In
+// the adjacency format, a function is "address blocks", followed by the address of each
+// function it calls
+// Parameters:
+// - format: GRAPH_DOT or GRAPH_ADJACENCY
+//
+static void graphCalls(int format) {
+	unsigned char *	seen;
+	long *			blocks;
+	long *			first;
+	long *			call;
+	struct s_edge *	e;
+	long			i, k, f;
+
+	seen = calloc(GRAPH_SEEN / 8, 1);
+	blocks = calloc(graph.nodes + 1, sizeof(long));
+	first = calloc(graph.nodes + 2, sizeof(long));
+	call = malloc((graph.edges > 0 ? graph.edges : 1) * sizeof(long));
+	if(seen == NULL || blocks == NULL || first == NULL || call == NULL) {
+		free(seen);
+		free(blocks);
+		free(first);
+		free(call);
+		return;
+	}
+
+	//
+	// Group the calls by the function they are made from, with a counting sort
+	//
+	for(i = 0; i < graph.nodes; i++) {
+		blocks[graph.node[i].owner]++;
+	}
+	for(i = 0; i < graph.edges; i++) {
+		if(graph.edge[i].type == E_CALL) {
+			first[graph.node[graph.edge[i].from].owner + 2]++;
+		}
+	}
+	for(i = 2; i <= graph.nodes + 1; i++) {
+		first[i] += first[i - 1];
+	}
+	for(i = 0; i < graph.edges; i++) {
+		if(graph.edge[i].type == E_CALL) {
+			call[first[graph.node[graph.edge[i].from].owner + 1]++] = i;
+		}
+	}
+
+	//
+	// Then list each function with its callees; a callee is only listed the first time it is
+	// seen, and the set is emptied again after each function
+	//
+	for(f = 0; f < graph.nodes; f++) {
+		if(graph.node[f].owner != f) {
+			continue;
+		}
+		if(format == GRAPH_DOT) {
+			graphNode('f', graph.node[f].address, blocks[f] == 1 ? " block" : " blocks", blocks[f]);
+		}
+		else {
+			graphLine(graph.node[f].address, blocks[f]);
+		}
+		for(k = first[f]; k < first[f + 1]; k++) {
+			e = &graph.edge[call[k]];
+			i = e->target & (GRAPH_SEEN - 1);
+			if(!(seen[i >> 3] & (1 << (i & 7)))) {
+				seen[i >> 3] |= 1 << (i & 7);
+				graphEdge('f', graph.node[f].address, e, format);
+			}
+		}
+		for(k = first[f]; k < first[f + 1]; k++) {
+			i = graph.edge[call[k]].target & (GRAPH_SEEN - 1);
+			seen[i >> 3] &= ~(1 << (i & 7));
+		}
+		if(format == GRAPH_ADJACENCY) {
+			outputString("\n");
+		}
+	}
+	free(seen);
+	free(blocks);
+	free(first);
+	free(call);
+}
+
+// Write a node out in DOT, labelled with its symbol or address, and a count
+// Parameters:
+// - prefix: The prefix of the node's name (b for a block, f for a function)
+// - address: Address of the node
+// - label: What is counted
+// - count: The count
+//
+static void graphNode(char prefix, long address, const char * label, long count) {
+	const char *	name = symbolFind(address);
+	char *			s = outputReserve(FORMAT_LINE_MAX);
+	char *			t = s;
+
+	*t++ = '\t';
+	*t++ = prefix;
+	t = formatHex(t, address, 6);
+	t = formatString(t, " [label=\"");
+	t = name ? formatString(t, name) : formatHex(t, address, 6);
+	t = formatString(t, "\\n");
+	t = graphNumber(t, count);
+	t = formatString(t, label);
+	t = formatString(t, "\"];\n");
+	outputCommit(t - s);
+}
+
+// Start a line of the adjacency format: the address of the node, and a count
+// Parameters:
+// - address: Address of the node
+// - count: The count
+//
+static void graphLine(long address, long count) {
+	char *	s = outputReserve(FORMAT_LINE_MAX);
+	char *	t = s;
+
+	t = formatHex(t, address, 6);
+	*t++ = ' ';
+	t = graphNumber(t, count);
+	outputCommit(t - s);
+}
+
+// Write an edge out. In DOT, a target that isn't the start of a block in the range is drawn as
+// an ellipse, and a fall through as a dashed line; in the adjacency format, jumps and falls are
+// tagged with their type
+// Parameters:
+// - prefix: The prefix of the nodes' names (b for a block, f for a function)
+// - from: Address of the node the edge is from
+// - e: The edge
+// - format: GRAPH_DOT or GRAPH_ADJACENCY
+//
+static void graphEdge(char prefix, long from, struct s_edge * e, int format) {
+	char *	s = outputReserve(FORMAT_LINE_MAX);
+	char *	t = s;
+	char	to = e->to >= 0 ? prefix : 'x';
+
+	if(format == GRAPH_ADJACENCY) {
+		*t++ = ' ';
+		if(e->type != E_CALL) {
+			*t++ = t_edgeTag[e->type];
+		}
+		t = formatHex(t, e->target, 6);
+		outputCommit(t - s);
+		return;
+	}
+	if(to == 'x') {
+		*t++ = '\t';
+		*t++ = to;
+		t = formatHex(t, e->target, 6);
+		t = formatString(t, " [shape=ellipse];\n");
+	}
+	*t++ = '\t';
+	*t++ = prefix;
+	t = formatHex(t, from, 6);
+	t = formatString(t, " -> ");
+	*t++ = to;
+	t = formatHex(t, e->target, 6);
+	t = formatString(t, e->type == E_FALL ? " [style=dashed];\n" : ";\n");
+	outputCommit(t - s);
+}
+
+// Write a number out in decimal
+// Parameters:
+// - t: Pointer to the text buffer
+// - value: The number (not negative)
+// Returns:
+// - char *: Pointer to the end of the text
+//
+static char * graphNumber(char * t, long value) {
+	char	digits[12];
+	int		i = 0;
+
+	do {
+		digits[i++] = '0' + value % 10;
+		value /= 10;
+	} while(value > 0);
+	while(i > 0) {
+		*t++ = digits[--i];
+	}
+	return t;
+}
@@ -0,0 +1,92 @@
+/*
+ * Title:			Disassembler - Control Flow and Call Graphs (host build)
+ * Author:			Dean Belfield
+ * Created:			17/10/2026
+ * Last Updated:	17/10/2026
+ *
+ * Modinfo:
+ */
+
+#ifndef GRAPH_H
+#define GRAPH_H
+
+#include "decode.h"
+
+#define GRAPH_CFG		0			// The control flow graph: basic blocks and the branches between them
+#define GRAPH_CALLS		1			// The call graph: functions and the functions they call
+
+#define GRAPH_DOT		0			// Graphviz DOT
+#define GRAPH_ADJACENCY	1			// One line per node, listing its successors
+
+// Map entries, one per byte of the range
+//
+#define G_CODE			0x01		// First byte of an instruction
+#define G_BODY			0x02		// Subsequent byte of an instruction
+#define G_LEADER		0x04		// A block starts here: the target of a branch or call
+#define G_END			0x08		// The instruction ends a block (JP, JR, DJNZ, RET, RETI, RETN or RST)
+#define G_FALL			0x10		// The instruction ends a block, but can carry on with the next
+#define G_CALLED		0x20		// The target of a CALL or RST, or an entry point
+
+// Edge types
+//
+#define E_FALL			0			// On to the next block
+#define E_JUMP			1			// JP, JR or DJNZ
+#define E_CALL			2			// CALL or RST
+
+// A basic block
+//
+struct s_node {
+	long			address;		// Address of the first instruction
+	long			end;			// Address after the last instruction
+	long			count;			// Number of instructions
+	long			edge;			// Index of the first edge from the block
+	long			edges;			// Number of edges from the block
+	long			owner;			// The block that starts the function it is part of, or -1
+	int				flags;			// The G_* entry of the last instruction
+	int				entered;		// Set if there is a fall or jump into the block
+};
+
+// An edge, from a branch or call in a block to its target
+//
+struct s_edge {
+	long			from;			// Index of the block the branch is in
+	long			to;				// Index of the block at the target, or -1 if the target isn't the start of a block in the range
+	long			target;			// Address of the target
+	int				type;			// E_*
+};
+
+// A branch or call found as the instructions were added
+//
+struct s_branch {
+	long			source;			// Address of the instruction
+	long			target;			// Address of the target
+	int				type;			// E_JUMP or E_CALL
+};
+
+// The graph of a range of the image; everything is held in flat arrays, indexed by address or
+// block number, so that it can be built in time linear in the size of the range
+//
+struct s_graph {
+	long				base;		// Address of the first byte of the range
+	long				length;		// Size of the range in bytes
+	unsigned char *		map;		// One G_* entry per byte
+	long *				index;		// For each byte that starts a block, the index of the block
+	struct s_branch *	branch;		// Branches and calls, in address order
+	long				branches;	// Number of branches
+	long				branchMax;	// Space allocated for branches
+	struct s_node *		node;		// The blocks, in address order
+	long				nodes;		// Number of blocks
+	struct s_edge *		edge;		// The edges, grouped by the block they are from
+	long				edges;		// Number of edges
+};
+
+extern struct s_graph	graph;
+
+int		graphOpen(long base, long length);
+void	graphClose(void);
+void	graphEntry(long address);
+int		graphAdd(struct s_opcode * opcode);
+int		graphBuild(void);
+void	graphWrite(int type, int format);
+
+#endif
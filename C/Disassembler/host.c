@@ -0,0 +1,1154 @@
+/*
+ * Title:			Disassembler - Host
+ * Author:			Dean Belfield
+ * Created:			17/10/2026
+ * Last Updated:	17/10/2026
+ *
+ * Disassembles MOS executables, Intel HEX files and raw memory dumps on a host PC
+ *
+ * Modinfo:
+ * 17/10/2026:		Added -w to set the size of the mapped window
+ * 17/10/2026:		Added -j to disassemble in parallel
+ * 17/10/2026:		Added -m and -e to list only the code reached from the entry points
+ * 17/10/2026:		The flow mode follows changes of ADL mode
+ * 17/10/2026:		Added -x to list jump, call and memory targets with labels, and a cross-reference index
+ * 17/10/2026:		Added -y to load symbols
+ * 17/10/2026:		Added -f for JSON Lines and binary output
+ * 17/10/2026:		Added -c and -r to write ZDS II or ez80asm source in a choice of hex styles
+ * 17/10/2026:		Added -p to patch the image, updating the listing incrementally
+ * 17/10/2026:		A raw image can be streamed from stdin (-)
+ * 17/10/2026:		Added -m dump for a hex dump
+ * 17/10/2026:		Added -z to list the cycles each instruction and basic block takes
+ * 17/10/2026:		Added -g to write the control flow graph or call graph
+ * 17/10/2026:		Added -m stats for the instruction mix
+ * 17/10/2026:		A linear listing with labels is decoded once, into a batch
+ * 17/10/2026:		Added -d to list the strings, pointer tables and fill found in the image as data
+ * 17/10/2026:		Clean with -Wextra
+ * 17/10/2026:		The lines a patch changes are spliced into the batch, which is kept, rather than listing the image again
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+#include <unistd.h>
+#include <pthread.h>
+
+#include "batch.h"
+#include "classify.h"
+#include "cycles.h"
+#include "decode.h"
+#include "dump.h"
+#include "flow.h"
+#include "format.h"
+#include "graph.h"
+#include "output.h"
+#include "parse.h"
+#include "patch.h"
+#include "record.h"
+#include "source.h"
+#include "stats.h"
+#include "symbol.h"
+#include "syntax.h"
+#include "xref.h"
+
+#define CHUNK_SIZE		0x40000		// Bytes decoded by each thread in the parallel mode
+#define CHUNK_OVERLAP	64			// Bytes each thread decodes past the end of its chunk to find a sync point
+#define ENTRY_MAX		16			// Maximum number of entry points on the command line
+#define EDIT_MAX		16			// Maximum number of patches on the command line
+
+#define RESERVE_MAX		(RECORD_JSON_MAX + FORMAT_LINE_MAX)	// Space reserved in the output for each line or record, and a block total
+#define LABEL_MAX		(FORMAT_LINE_MAX * 2)				// Space reserved for a label line, and a block total
+
+#define XREF_NONE		0			// No labels
+#define XREF_LABELS		1			// List targets with labels
+#define XREF_INDEX		2			// And list the cross-reference index after the listing
+
+// A line of listing decoded by a thread
+//
+struct s_line {
+	long	address;				// Address of the instruction
+	long	next;					// Address of the following instruction
+	int		offset;					// Offset of the text in the chunk's text buffer
+	int		length;					// Length of the text
+};
+
+// A patch given on the command line
+//
+struct s_edit {
+	long			address;		// Address of the first byte
+	int				count;			// Number of bytes
+	unsigned char	bytes[PATCH_MAX];	// The new bytes
+};
+
+// A chunk of the image decoded by a thread
+//
+struct s_chunk {
+	long			start;			// Address the thread starts decoding at
+	long			end;			// Address of the start of the next chunk
+	long			limit;			// Address the thread stops decoding at
+	struct s_line *	line;			// The lines decoded, in address order
+	int				lines;			// Number of lines
+	int				linesMax;		// Space allocated for lines
+	char *			text;			// The text of the lines
+	int				textLength;		// Size of the text in bytes
+	int				textMax;		// Space allocated for text
+	pthread_t		thread;			// The thread decoding this chunk
+	int				running;		// Set if the thread was started
+};
+
+void	help(void);
+long	disassembleLine(long address, struct s_opcode * opcode);
+int		disassembleLabel(char * t, long address);
+int		disassembleFormat(char * t, struct s_opcode * opcode);
+int		disassembleBlock(char * t);
+void	disassemble(long address, long end);
+void	disassembleParallel(long address, long end, int threads);
+void	disassembleFlow(long address, long end, long * entry, int entries, int detect);
+int		disassembleTrace(long * entry, int entries);
+void	disassembleGraph(long address, long end, long * entry, int entries, int follow);
+void	disassembleIndex(void);
+void	disassembleSource(int (* defined)(long address));
+void	disassemblePatch(long address, long end);
+void	disassembleStream(long address, long end);
+void	disassembleDump(long address, long end);
+void	disassembleStats(long address, long end);
+void	streamIdle(void);
+int		editParse(char * arg);
+int		definedLinear(long address);
+int		definedFlow(long address);
+void *	disassembleChunk(void * arg);
+long	disassembleStitch(struct s_chunk * chunk, int count, long address);
+int		chunkFind(struct s_chunk * chunk, long address);
+void *	chunkGrow(void * ptr, int * max, int size);
+
+long	adl;					// ADL mode
+long	imageEnd;				// Address after the last byte of the image
+long	listStart;				// Address of the first byte listed
+long	listEnd;				// Address after the last byte listed
+int		listFormat;				// RECORD_TEXT, RECORD_JSON or RECORD_BINARY
+int		timing;					// TIMING_NONE, TIMING_CYCLES or TIMING_BLOCKS
+int		graphType = -1;			// GRAPH_CFG or GRAPH_CALLS to write a graph instead of the listing
+int		graphFormat = GRAPH_DOT;	// GRAPH_DOT or GRAPH_ADJACENCY
+struct s_block	block = { -1, 0, 0, { 0, 0 }, { 0, 0 }, 0 };	// The basic block being totalled
+struct s_edit	edit[EDIT_MAX];	// Patches to apply after the image is first disassembled
+int		edits;					// Number of patches
+
+// Parameters:
+// - argc: Argument count
+// - argv: Array of arguments
+//
+int main(int argc, char * argv[]) {
+	char *	filename = NULL;
+	char *	outname = NULL;
+	FILE *	file = NULL;
+	int		type = SOURCE_AUTO;
+	long	base = -1;
+	long	start = -1;
+	long	length = -1;
+	long	mode = -1;
+	long	window = SOURCE_WINDOW;
+	long	threads = 1;
+	long	entry[ENTRY_MAX];
+	int		entries = 0;
+	int		follow = 0;
+	int		detect = 0;
+	int		dump = 0;
+	int		mix = 0;
+	int		stream = 0;
+	int		labels = XREF_NONE;
+	int		dialect = SYNTAX_LISTING;
+	int		hex = HEX_DEFAULT;
+	int		i;
+
+	for(i = 1; i < argc; i++) {
+		if(argv[i][0] != '-' || argv[i][1] == '\0') {
+			if(filename != NULL) {
+				help();
+				return 1;
+			}
+			filename = argv[i];
+			continue;
+		}
+		if(strcmp(argv[i], "-d") == 0) {
+			detect = 1;					// The only option without a value
+			continue;
+		}
+		if(i + 1 >= argc) {
+			help();
+			return 1;
+		}
+		switch(argv[i][1]) {
+			case 't': {
+				i++;
+				if(strcmp(argv[i], "bin") == 0) type = SOURCE_BIN;
+				else if(strcmp(argv[i], "hex") == 0) type = SOURCE_HEX;
+				else if(strcmp(argv[i], "raw") == 0) type = SOURCE_RAW;
+				else {
+					help();
+					return 1;
+				}
+			} break;
+			case 'b': {
+				if(!parseNumber(argv[++i], &base)) return 1;
+			} break;
+			case 's': {
+				if(!parseNumber(argv[++i], &start)) return 1;
+			} break;
+			case 'l': {
+				if(!parseNumber(argv[++i], &length)) return 1;
+			} break;
+			case 'a': {
+				if(!parseNumber(argv[++i], &mode)) return 1;
+			} break;
+			case 'w': {
+				if(!parseNumber(argv[++i], &window)) return 1;
+			} break;
+			case 'j': {
+				if(!parseNumber(argv[++i], &threads)) return 1;
+			} break;
+			case 'p': {
+				if(edits == EDIT_MAX || !editParse(argv[++i])) {
+					help();
+					return 1;
+				}
+			} break;
+			case 'm': {
+				i++;
+				if(strcmp(argv[i], "linear") == 0) follow = dump = mix = 0;
+				else if(strcmp(argv[i], "flow") == 0) follow = 1, dump = mix = 0;
+				else if(strcmp(argv[i], "dump") == 0) follow = mix = 0, dump = 1;
+				else if(strcmp(argv[i], "stats") == 0) follow = dump = 0, mix = 1;
+				else {
+					help();
+					return 1;
+				}
+			} break;
+			case 'e': {
+				if(entries == ENTRY_MAX || !parseNumber(argv[++i], &entry[entries++])) return 1;
+				follow = 1;
+			} break;
+			case 'x': {
+				i++;
+				if(strcmp(argv[i], "labels") == 0) labels = XREF_LABELS;
+				else if(strcmp(argv[i], "index") == 0) labels = XREF_INDEX;
+				else {
+					help();
+					return 1;
+				}
+			} break;
+			case 'f': {
+				i++;
+				if(strcmp(argv[i], "text") == 0) listFormat = RECORD_TEXT;
+				else if(strcmp(argv[i], "json") == 0) listFormat = RECORD_JSON;
+				else if(strcmp(argv[i], "binary") == 0) listFormat = RECORD_BINARY;
+				else if(strcmp(argv[i], "dot") == 0) graphFormat = GRAPH_DOT;
+				else if(strcmp(argv[i], "adjacency") == 0) graphFormat = GRAPH_ADJACENCY;
+				else {
+					help();
+					return 1;
+				}
+			} break;
+			case 'c': {
+				i++;
+				if(strcmp(argv[i], "listing") == 0) dialect = SYNTAX_LISTING;
+				else if(strcmp(argv[i], "zds") == 0) dialect = SYNTAX_ZDS;
+				else if(strcmp(argv[i], "ez80asm") == 0) dialect = SYNTAX_EZ80ASM;
+				else {
+					help();
+					return 1;
+				}
+			} break;
+			case 'r': {
+				i++;
+				if(strcmp(argv[i], "&") == 0) hex = HEX_AMPERSAND;
+				else if(strcmp(argv[i], "$") == 0) hex = HEX_DOLLAR;
+				else if(strcmp(argv[i], "0x") == 0) hex = HEX_C;
+				else if(strcmp(argv[i], "h") == 0) hex = HEX_SUFFIX;
+				else {
+					help();
+					return 1;
+				}
+			} break;
+			case 'y': {
+				if(!symbolLoad(argv[++i])) {
+					fprintf(stderr, "Cannot load %s\n", argv[i]);
+					return 1;
+				}
+			} break;
+			case 'g': {
+				i++;
+				if(strcmp(argv[i], "cfg") == 0) graphType = GRAPH_CFG;
+				else if(strcmp(argv[i], "calls") == 0) graphType = GRAPH_CALLS;
+				else {
+					help();
+					return 1;
+				}
+			} break;
+			case 'z': {
+				i++;
+				if(strcmp(argv[i], "cycles") == 0) timing = TIMING_CYCLES;
+				else if(strcmp(argv[i], "blocks") == 0) timing = TIMING_BLOCKS;
+				else {
+					help();
+					return 1;
+				}
+			} break;
+			case 'o': {
+				outname = argv[++i];
+			} break;
+			default: {
+				help();
+				return 1;
+			}
+		}
+	}
+	if(filename == NULL) {
+		help();
+		return 1;
+	}
+	symbolSort();
+	syntaxSelect(dialect, hex);
+	if(syntax.source && labels == XREF_NONE) {
+		labels = XREF_LABELS;		// Source is always written with labels
+	}
+	if(graphType >= 0) {
+		labels = XREF_NONE;			// A graph has no listing
+		timing = TIMING_NONE;
+		threads = 1;
+		edits = 0;
+		dump = mix = 0;
+		detect = 0;
+	}
+	if(dump || mix) {
+		labels = XREF_NONE;			// A dump is only ever hex and ASCII, and the instruction mix a report
+		edits = 0;
+		listFormat = RECORD_TEXT;
+		timing = TIMING_NONE;
+		detect = 0;
+		dumpSelect(DUMP_BEST);
+	}
+	if(timing != TIMING_NONE) {
+		cyclesOpen();
+	}
+	if(timing == TIMING_BLOCKS) {
+		threads = 1;				// The blocks are totalled in address order
+	}
+	if(strcmp(filename, "-") == 0) {
+		if(follow || detect || labels != XREF_NONE || edits > 0 || graphType >= 0 || type == SOURCE_BIN || type == SOURCE_HEX) {
+			fprintf(stderr, "Only a linear listing of a raw image, without labels, patches or data detection, can be read from stdin\n");
+			return 1;
+		}
+		stream = 1;
+		threads = 1;
+	}
+	if(edits > 0) {
+		if(follow) {
+			fprintf(stderr, "Patches can only be applied to a linear listing\n");
+			return 1;
+		}
+		threads = 1;
+		window = 0;					// The image is patched, so it is read into memory
+	}
+	if(threads < 1) {
+		threads = sysconf(_SC_NPROCESSORS_ONLN);
+	}
+	if(threads > 1) {
+		window = LONG_MAX;			// The threads share the image, so it can't be moved around
+	}
+	if(stream) {
+		sourceStream(STDIN_FILENO, base < 0 ? 0 : base, streamIdle);
+	}
+	else if(!sourceLoad(filename, type, base, window)) {
+		fprintf(stderr, "Cannot load %s\n", filename);
+		return 1;
+	}
+
+	adl = mode >= 0 ? mode : source.mode >= 0 ? source.mode : 1;
+	imageEnd = source.base + source.length;
+	if(start < source.base) {
+		start = source.base;
+	}
+	if(stream) {
+		if(length < 0) {
+			length = LONG_MAX - start;	// The length of a stream isn't known until it ends
+		}
+	}
+	else if(length < 0 || start + length > imageEnd) {
+		length = imageEnd - start;
+	}
+
+	outputOpen(OUTPUT_BLOCK);
+	if(outname != NULL) {
+		file = fopen(outname, "wb");
+		if(file == NULL) {
+			fprintf(stderr, "Cannot create %s\n", outname);
+			return 1;
+		}
+		outputFile(file);
+	}
+	if(listFormat == RECORD_BINARY) {
+		i = timing != TIMING_NONE ? RECORD_SIZE_CYCLES : RECORD_SIZE;
+		outputCommit(recordHeader(outputReserve(i), i));
+	}
+	listStart = start;
+	listEnd = start + length;
+	if(labels != XREF_NONE) {
+		xrefOpen();
+	}
+	if(detect && !follow && !classifyOpen(start, start + length, adl)) {
+		fprintf(stderr, "Out of memory\n");
+		return 1;
+	}
+	if(graphType >= 0) {
+		disassembleGraph(start, start + length, entry, entries, follow);
+	}
+	else if(dump) {
+		disassembleDump(start, start + length);
+	}
+	else if(mix) {
+		disassembleStats(start, start + length);
+	}
+	else if(stream) {
+		disassembleStream(start, start + length);
+	}
+	else if(follow) {
+		disassembleFlow(start, start + length, entry, entries, detect);
+	}
+	else if(threads > 1 && labels == XREF_NONE) {
+		disassembleParallel(start, start + length, threads);
+	}
+	else {
+		disassemble(start, start + length);
+	}
+	outputCommit(disassembleBlock(outputReserve(RESERVE_MAX)));
+	if(labels == XREF_INDEX && listFormat == RECORD_TEXT && !syntax.source) {
+		disassembleIndex();
+	}
+	classifyClose();
+	xrefClose();
+	symbolClose();
+	outputFlush();
+	if(file != NULL) {
+		fclose(file);
+	}
+	sourceClose();
+	return 0;
+}
+
+// Help text
+//
+void help() {
+	printf("AGON eZ80 Disassembler by Dean Belfield\n");
+	printf("Usage:\n");
+	printf("disassemble [-t bin|hex|raw] [-b base] [-s start] [-l length] [-a adl] [-w window] [-j threads] [-p address,byte[,byte...]] [-m linear|flow|dump|stats] [-e entry] [-d] [-x labels|index] [-y symbols] [-f text|json|binary|dot|adjacency] [-c listing|zds|ez80asm] [-r &|$|0x|h] [-z cycles|blocks] [-g cfg|calls] [-o output] file|-\n");
+}
+
+// Decode one line of the listing; an instruction that runs off the end of the image, or into
+// a region the classifier found, is listed as data, as is one the classifier finds unlikely
+// Parameters:
+// - address: Address of the instruction
+// - opcode: Pointer to the opcode structure to fill
+// Returns:
+// - long: Address of the following instruction
+//
+long disassembleLine(long address, struct s_opcode * opcode) {
+	long	next = address;
+	long	limit, count;
+
+	if(classifyLine(&next, imageEnd, opcode)) {
+		return next;
+	}
+	decodeOpcode(&next, opcode);
+	limit = classifyLimit(address, imageEnd);
+	if(next > limit || classifyInvalid(opcode)) {
+		count = (next < limit ? next : limit) - address;
+		next = address;
+		decodeData(&next, opcode, count < DATA_MAX ? count : DATA_MAX);
+	}
+	return next;
+}
+
+// Build the label line for an address, if it has a symbol or a cross-reference label; labels
+// are only listed in text output. A label starts a new basic block, so the total of the one
+// before it comes first
+// Parameters:
+// - t: Pointer to the line buffer (at least LABEL_MAX bytes)
+// - address: The address
+// Returns:
+// - int: Length of the lines in bytes, or 0 if the address has no label
+//
+int disassembleLabel(char * t, long address) {
+	int	length = 0;
+
+	if((listFormat == RECORD_TEXT || timing == TIMING_BLOCKS) && (symbolFind(address) || xrefLabel(address))) {
+		length = disassembleBlock(t);
+		if(listFormat == RECORD_TEXT) {
+			length += formatLabelLine(t + length, address);
+		}
+	}
+	return length;
+}
+
+// Build the output for a decoded instruction in the format chosen with -f
+// Parameters:
+// - t: Pointer to the buffer (at least RESERVE_MAX bytes)
+// - opcode: Pointer to the opcode structure
+// Returns:
+// - int: Length of the output in bytes, including the total of a basic block it ends
+//
+int disassembleFormat(char * t, struct s_opcode * opcode) {
+	struct s_timing *	cycles = NULL;
+	struct s_timing		count;
+	char *				s = t;
+	int					length;
+
+	if(timing != TIMING_NONE) {
+		cycles = &count;
+		cyclesTime(opcode, cycles);
+		if(count.cycles[1] == 0) {
+			t += disassembleBlock(t);	// Data ends a basic block
+		}
+	}
+	switch(listFormat) {
+		case RECORD_JSON: {
+			t += recordJson(t, opcode, cycles);
+		} break;
+		case RECORD_BINARY: {
+			t += recordBinary(t, opcode, cycles);
+		} break;
+		default: {
+			length = formatLine(t, opcode);
+			t += cycles ? cyclesLine(t, length, strlen(opcode->text), cycles) : length;
+		}
+	}
+	if(timing == TIMING_BLOCKS && count.cycles[1] > 0) {
+		cyclesAdd(&block, opcode, cycles);
+		if(count.flags & C_END) {
+			t += disassembleBlock(t);
+		}
+	}
+	return t - s;
+}
+
+// Build the total of the basic block being added up, and start a new one; the total is only
+// listed in text and JSON output
+// Parameters:
+// - t: Pointer to the buffer (at least FORMAT_LINE_MAX bytes)
+// Returns:
+// - int: Length of the output in bytes, or 0 if there is no block
+//
+int disassembleBlock(char * t) {
+	int	length = 0;
+
+	if(block.address < 0) {
+		return 0;
+	}
+	switch(listFormat) {
+		case RECORD_TEXT: {
+			length = cyclesBlock(t, &block);
+		} break;
+		case RECORD_JSON: {
+			length = recordBlock(t, &block);
+		} break;
+	}
+	block.address = -1;
+	return length;
+}
+
+// Disassemble a range of the image. If references are being collected, the range is decoded
+// once, into a batch, to build the index; it is then listed from the batch with labels
+// Parameters:
+// - address: Start address
+// - end: Address to stop at
+//
+void disassemble(long address, long end) {
+	struct s_opcode	opcode;
+	long			a, i;
+
+	if(xref.enabled || edits > 0) {
+		if(!flowOpen(source.base, source.length) || !batchOpen(BATCH_SIZE)) {
+			fprintf(stderr, "Out of memory\n");
+			flowClose();
+			return;
+		}
+		for(a = address; a < end; ) {
+			if(!batchDecode(&a, imageEnd)) {
+				fprintf(stderr, "Out of memory\n");
+				batchClose();
+				flowClose();
+				return;
+			}
+		}
+		for(i = 0; i < batch.count; i++) {
+			if(xref.enabled) {
+				batchOpcode(i, &opcode);
+				xrefAdd(&opcode);
+			}
+			flowData(batch.address[i], batch.length[i]);
+			flowMap(batch.address[i]) = FLOW_CODE;	// Only the start of each line can have a label
+		}
+		if(xref.enabled) {
+			xrefSort(definedLinear);
+		}
+		if(edits > 0) {
+			disassemblePatch(address, end);
+		}
+	}
+	disassembleSource(definedLinear);
+
+	//
+	// The instructions in the batch are formatted now that the labels are known
+	//
+	for(i = 0; i < batch.count; i++) {
+		batchOpcode(i, &opcode);
+		formatOpcode(&opcode);
+		outputCommit(disassembleLabel(outputReserve(LABEL_MAX), opcode.address));
+		outputCommit(disassembleFormat(outputReserve(RESERVE_MAX), &opcode));
+		address = opcode.address + opcode.count;
+	}
+	batchClose();
+	while(address < end) {
+		outputCommit(disassembleLabel(outputReserve(LABEL_MAX), address));
+		address = disassembleLine(address, &opcode);
+		outputCommit(disassembleFormat(outputReserve(RESERVE_MAX), &opcode));
+	}
+	if(xref.enabled || edits > 0) {
+		flowClose();
+	}
+}
+
+// Disassemble a raw image as it is read from a stream, a line at a time; only the bytes of the
+// line being decoded are held, so the memory used doesn't grow with the image, and each line is
+// listed as soon as its bytes have arrived
+// Parameters:
+// - address: Start address
+// - end: Address to stop at
+//
+void disassembleStream(long address, long end) {
+	struct s_opcode	opcode;
+	long			next;
+
+	imageEnd = LONG_MAX;				// Not known until the stream ends
+	while(address < end && sourceFill(address)) {
+		outputCommit(disassembleLabel(outputReserve(LABEL_MAX), address));
+		next = disassembleLine(address, &opcode);
+		if(next > source.head) {		// The stream ended part way through; list the rest as data
+			imageEnd = source.head;
+			next = disassembleLine(address, &opcode);
+		}
+		address = next;
+		outputCommit(disassembleFormat(outputReserve(RESERVE_MAX), &opcode));
+	}
+}
+
+// Dump a range of the image in hex and ASCII, 16 bytes to a line. Rows in the window are
+// formatted straight from it; the rest, and streams, are gathered a byte at a time first
+// Parameters:
+// - address: Start address
+// - end: Address to stop at
+//
+void disassembleDump(long address, long end) {
+	unsigned char			row[DUMP_ROW];
+	const unsigned char *	bytes;
+	long					offset;
+	int						i, count;
+
+	while(address < end) {
+		count = end - address < DUMP_ROW ? end - address : DUMP_ROW;
+		offset = address - source.windowBase;
+		if(offset >= 0 && offset + count <= source.windowLength) {
+			bytes = &source.window[offset];
+		}
+		else {
+			for(i = 0; i < count && (!source.stream || sourceFill(address + i)); i++) {
+				row[i] = sourceFetch(address + i);
+			}
+			if(i == 0) {
+				break;					// The stream has ended
+			}
+			count = i;
+			bytes = row;
+		}
+		outputCommit(dumpLine(outputReserve(DUMP_LINE_MAX), address, bytes, count));
+		address += count;
+	}
+}
+
+// Called while waiting for more of a stream; the lines listed so far are written out, so that
+// they appear as soon as their bytes arrive
+//
+void streamIdle(void) {
+	outputFlush();
+	fflush(NULL);
+}
+
+// Apply the patches given on the command line. The lines each patch changes are decoded again
+// and spliced into the batch, and the cross-references and labels are updated to match, rather
+// than disassembling the whole image again
+// Parameters:
+// - address: Address of the first line of the listing
+// - end: Address after the last byte listed
+//
+void disassemblePatch(long address, long end) {
+	long	first, last;
+	int		i;
+
+	patchOpen(address, end, disassembleLine, definedLinear);
+	for(i = 0; i < edits; i++) {
+		if(!patchApply(edit[i].address, edit[i].bytes, edit[i].count, &first, &last)) {
+			fprintf(stderr, "Cannot patch &%06lX\n", edit[i].address);
+		}
+		else if(!batchSplice(first, last, imageEnd)) {
+			fprintf(stderr, "Out of memory\n");
+			break;
+		}
+	}
+	patchClose();
+}
+
+// Parse a patch from the command line: the address, then the bytes, separated by commas
+// Parameters:
+// - arg: The argument
+// Returns:
+// - 1: OK
+// - 0: Not a valid patch
+//
+int editParse(char * arg) {
+	struct s_edit *	e = &edit[edits];
+	char *			p;
+	long			value;
+	int				i;
+
+	e->count = -1;
+	for(i = 0; arg != NULL; i++) {
+		p = strchr(arg, ',');
+		if(p != NULL) {
+			*p++ = '\0';
+		}
+		if(!parseNumber(arg, &value)) {
+			return 0;
+		}
+		if(i == 0) {
+			e->address = value;
+		}
+		else if(value < 0 || value > 255 || e->count == PATCH_MAX) {
+			return 0;
+		}
+		else {
+			e->bytes[e->count] = value;
+		}
+		e->count++;
+		arg = p;
+	}
+	if(e->count < 1) {
+		return 0;
+	}
+	edits++;
+	return 1;
+}
+
+// Disassemble a range of the image in parallel. The range is split into chunks that are
+// decoded by separate threads, a round of one chunk per thread at a time. A thread can't know
+// whether its chunk starts on an instruction boundary, so the output of each chunk is only used
+// from the first address the previous chunk's instructions also land on; from there on the
+// two decodes are the same. The listing is identical to disassemble()
+// Parameters:
+// - address: Start address
+// - end: Address to stop at
+// - threads: Number of threads
+//
+void disassembleParallel(long address, long end, int threads) {
+	struct s_chunk *	chunk;
+	long				start = address;
+	int					i, count;
+
+	chunk = calloc(threads, sizeof(struct s_chunk));
+	if(chunk == NULL) {
+		disassemble(address, end);
+		return;
+	}
+	while(address < end) {
+		for(count = 0; count < threads && start < end; count++) {
+			chunk[count].start = start;
+			chunk[count].end = start + CHUNK_SIZE < end ? start + CHUNK_SIZE : end;
+			chunk[count].limit = chunk[count].end + CHUNK_OVERLAP < end ? chunk[count].end + CHUNK_OVERLAP : end;
+			start = chunk[count].end;
+			chunk[count].running = pthread_create(&chunk[count].thread, NULL, disassembleChunk, &chunk[count]) == 0;
+			if(!chunk[count].running) {
+				disassembleChunk(&chunk[count]);
+			}
+		}
+		for(i = 0; i < count; i++) {
+			if(chunk[i].running) {
+				pthread_join(chunk[i].thread, NULL);
+			}
+		}
+		address = disassembleStitch(chunk, count, address);
+	}
+	for(i = 0; i < threads; i++) {
+		free(chunk[i].line);
+		free(chunk[i].text);
+	}
+	free(chunk);
+}
+
+// Disassemble a range of the image, listing only the code that can be reached from the entry
+// points; everything else is listed as data. Each instruction is listed in the ADL mode it was
+// reached in, and an .ASSUME line is listed wherever the mode changes
+// Parameters:
+// - address: Start address
+// - end: Address to stop at
+// - entry: Array of entry points from the command line
+// - entries: Number of entry points
+// - detect: Set to look for strings, pointer tables and fill in the bytes that weren't reached
+//
+void disassembleFlow(long address, long end, long * entry, int entries, int detect) {
+	struct s_opcode	opcode;
+	long			next;
+	long			mode = adl;
+
+	if(!disassembleTrace(entry, entries)) {
+		return;
+	}
+	if(detect && !classifyOpen(address, end, adl)) {
+		fprintf(stderr, "Out of memory\n");
+		flowClose();
+		return;
+	}
+	if(xref.enabled) {
+		xrefSort(definedFlow);
+	}
+	disassembleSource(definedFlow);
+
+	while(address < end) {
+		if(flowType(address) == FLOW_CODE) {
+			adl = (flowMap(address) & FLOW_ADL) != 0;
+			if(adl != mode && listFormat == RECORD_TEXT) {
+				outputCommit(formatAssume(outputReserve(FORMAT_LINE_MAX), adl));
+			}
+		}
+		outputCommit(disassembleLabel(outputReserve(LABEL_MAX), address));
+		if(flowType(address) == FLOW_CODE) {
+			address = disassembleLine(address, &opcode);
+			mode = adl;
+		}
+		else {
+			for(next = address + 1; next < end && next - address < DATA_MAX && flowType(next) != FLOW_CODE && !xrefLabel(next) && !symbolFind(next); next++);
+			if(!classifyLine(&address, next, &opcode)) {
+				decodeData(&address, &opcode, classifyLimit(address, next) - address);
+			}
+		}
+		outputCommit(disassembleFormat(outputReserve(RESERVE_MAX), &opcode));
+	}
+	adl = mode;
+	flowClose();
+}
+
+// Count the instructions in a range of the image by class, and write the report out. Each
+// instruction is read straight from the window where it can be; only the last few bytes of
+// the range, and instructions that straddle the window, are copied first
+// Parameters:
+// - address: Start address
+// - end: Address to stop at
+//
+void disassembleStats(long address, long end) {
+	unsigned char	bytes[8];
+	long			offset, start = address;
+	int				i, count;
+
+	statsOpen();
+	while(address < end) {
+		offset = address - source.windowBase;
+		if(offset >= 0 && offset + 8 <= source.windowLength && end - address >= 8) {
+			address += statsInstruction(&source.window[offset], adl);
+			continue;
+		}
+		if(source.stream && !sourceFill(address)) {
+			break;					// The stream has ended
+		}
+		for(i = 0; i < 8 && address + i < end; i++) {
+			bytes[i] = sourceFetch(address + i);
+			if(source.stream && address + i >= source.head) {
+				break;
+			}
+		}
+		count = i;
+		while(i < 8) {
+			bytes[i++] = 0;
+		}
+		if(decodeLength(bytes, adl, AM_NONE) > count) {
+			stats.data += count;	// Listed as DB
+			address += count;
+			break;
+		}
+		address += statsInstruction(bytes, adl);
+	}
+	stats.bytes = address - start;
+	statsWrite(start, address);
+}
+
+// Find the code that can be reached from the entry points, for flow mode
+// Parameters:
+// - entry: Array of entry points from the command line
+// - entries: Number of entry points
+// Returns:
+// - 1: OK
+// - 0: Out of memory
+//
+int disassembleTrace(long * entry, int entries) {
+	int	i;
+
+	if(!flowOpen(source.base, source.length)) {
+		fprintf(stderr, "Out of memory\n");
+		return 0;
+	}
+	//
+	// MOS executables start at the load address, with the header at offset 64
+	//
+	if(source.mode >= 0) {
+		flowData(source.base + 64, 5);
+		flowEntry(source.base, adl);
+	}
+	for(i = 0; i < 8; i++) {
+		flowEntry(i * 8, adl);			// Restart vectors, if the image covers them
+	}
+	for(i = 0; i < entries; i++) {
+		flowEntry(entry[i], adl);
+	}
+	if(flow.queueLength == 0) {
+		flowEntry(source.base, adl);
+	}
+	flowTrace();
+	return 1;
+}
+
+// Write the control flow graph or call graph of a range of the image instead of the listing.
+// In flow mode only the code that can be reached from the entry points is in the graph, each
+// instruction decoded in the ADL mode it was reached in
+// Parameters:
+// - address: Start address
+// - end: Address to stop at
+// - entry: Array of entry points from the command line
+// - entries: Number of entry points
+// - follow: Set for flow mode
+//
+void disassembleGraph(long address, long end, long * entry, int entries, int follow) {
+	struct s_opcode	opcode;
+	long			mode = adl;
+	long			k;
+	int				i, ok;
+
+	if(!graphOpen(address, end - address) || !batchOpen(BATCH_SIZE)) {
+		fprintf(stderr, "Out of memory\n");
+		batchClose();
+		graphClose();
+		return;
+	}
+	if(follow && !disassembleTrace(entry, entries)) {
+		batchClose();
+		graphClose();
+		return;
+	}
+	graphEntry(follow && source.mode >= 0 ? source.base : address);
+	for(i = 0; i < entries; i++) {
+		graphEntry(entry[i]);
+	}
+	for(ok = 1; ok && address < end; ) {
+		if(follow && flowType(address) != FLOW_CODE) {
+			address++;
+			continue;
+		}
+		if(follow) {
+			adl = (flowMap(address) & FLOW_ADL) != 0;
+		}
+		ok = batchDecode(&address, imageEnd);
+	}
+	for(k = 0; ok && k < batch.count; k++) {
+		adl = batchOpcode(k, &opcode);
+		ok = graphAdd(&opcode);
+	}
+	batchClose();
+	adl = mode;
+	if(follow) {
+		flowClose();
+	}
+	if(!ok || !graphBuild()) {
+		fprintf(stderr, "Out of memory\n");
+	}
+	else {
+		graphWrite(graphType, graphFormat);
+	}
+	graphClose();
+}
+
+// List the cross-reference index: every address referred to, followed by the instructions
+// that refer to it
+//
+void disassembleIndex(void) {
+	long	i = 0;
+
+	while(i < xref.count) {
+		outputCommit(xrefFormat(outputReserve(FORMAT_LINE_MAX), i, &i));
+	}
+}
+
+// Start assembler source: define the symbols that aren't listed as labels, then set the origin
+// and ADL mode. Nothing is written for the listing or structured output
+// Parameters:
+// - defined: Function that returns non-zero if a line of the listing starts at an address
+//
+void disassembleSource(int (* defined)(long address)) {
+	long	i;
+
+	if(!syntax.source || listFormat != RECORD_TEXT) {
+		return;
+	}
+	for(i = 0; i < symbols.count; i++) {
+		if((i == 0 || symbols.symbol[i].address != symbols.symbol[i - 1].address) && !defined(symbols.symbol[i].address)) {
+			outputCommit(formatEqu(outputReserve(FORMAT_LINE_MAX), symbols.symbol[i].address));
+		}
+	}
+	outputCommit(formatOrg(outputReserve(FORMAT_LINE_MAX), listStart));
+	outputCommit(formatAssume(outputReserve(FORMAT_LINE_MAX), adl));
+}
+
+// Check whether a line of the linear listing starts at an address
+// Parameters:
+// - address: The address
+// Returns:
+// - 1: It does
+// - 0: It doesn't
+//
+int definedLinear(long address) {
+	return address >= listStart && address < listEnd && flowType(address) == FLOW_CODE;
+}
+
+// Check whether a line of the flow listing starts at an address; data is split into lines
+// wherever there is a label, so only the bytes after the first in an instruction can't
+// Parameters:
+// - address: The address
+// Returns:
+// - 1: It does
+// - 0: It doesn't
+//
+int definedFlow(long address) {
+	return address >= listStart && address < listEnd && flowType(address) != FLOW_BODY;
+}
+
+// Thread that decodes a chunk into its line and text buffers
+// Parameters:
+// - arg: Pointer to the chunk
+// Returns:
+// - void *: NULL
+//
+void * disassembleChunk(void * arg) {
+	struct s_chunk *	chunk = arg;
+	struct s_opcode		opcode;
+	struct s_line *		line;
+	long				address = chunk->start;
+
+	chunk->lines = 0;
+	chunk->textLength = 0;
+	while(address < chunk->limit) {
+		if(chunk->lines == chunk->linesMax) {
+			chunk->line = chunkGrow(chunk->line, &chunk->linesMax, sizeof(struct s_line));
+		}
+		if(chunk->textLength + LABEL_MAX + RESERVE_MAX > chunk->textMax) {
+			chunk->text = chunkGrow(chunk->text, &chunk->textMax, 1);
+		}
+		line = &chunk->line[chunk->lines++];
+		line->address = address;
+		address = disassembleLine(address, &opcode);
+		line->next = address;
+		line->offset = chunk->textLength;
+		line->length = disassembleLabel(&chunk->text[chunk->textLength], line->address);
+		line->length += disassembleFormat(&chunk->text[chunk->textLength + line->length], &opcode);
+		chunk->textLength += line->length;
+	}
+	return NULL;
+}
+
+// Write the decoded chunks of a round out in address order
+// Parameters:
+// - chunk: The chunks
+// - count: Number of chunks
+// - address: Address of the first instruction, which may be past the start of the first chunk
+// Returns:
+// - long: Address of the first instruction after the round
+//
+long disassembleStitch(struct s_chunk * chunk, int count, long address) {
+	struct s_opcode	opcode;
+	struct s_line *	line;
+	long			end = chunk[count - 1].end;
+	int				i = 0, k, first;
+
+	while(address < end) {
+		while(i + 1 < count && address >= chunk[i + 1].start) {
+			i++;
+		}
+		k = chunkFind(&chunk[i], address);
+		//
+		// If the chunk didn't land on this address, decode it here until the two line up
+		//
+		if(k < 0) {
+			outputCommit(disassembleLabel(outputReserve(LABEL_MAX), address));
+			address = disassembleLine(address, &opcode);
+			outputCommit(disassembleFormat(outputReserve(RESERVE_MAX), &opcode));
+			continue;
+		}
+		//
+		// Otherwise copy its lines up to the end of the chunk, then on into the overlap until
+		// the next chunk lines up as well
+		//
+		for(first = k; k < chunk[i].lines; k++) {
+			line = &chunk[i].line[k];
+			if(line->address >= chunk[i].end && (i + 1 == count || chunkFind(&chunk[i + 1], line->address) >= 0)) {
+				break;
+			}
+			address = line->next;
+		}
+		line = &chunk[i].line[k - 1];
+		outputWrite(&chunk[i].text[chunk[i].line[first].offset], line->offset + line->length - chunk[i].line[first].offset);
+	}
+	return address;
+}
+
+// Find the line of a chunk at an address
+// Parameters:
+// - chunk: The chunk
+// - address: The address
+// Returns:
+// - int: Index of the line, or -1 if no instruction in the chunk starts at the address
+//
+int chunkFind(struct s_chunk * chunk, long address) {
+	int	lo = 0;
+	int	hi = chunk->lines - 1;
+	int	mid;
+
+	while(lo <= hi) {
+		mid = (lo + hi) / 2;
+		if(chunk->line[mid].address < address) lo = mid + 1;
+		else if(chunk->line[mid].address > address) hi = mid - 1;
+		else return mid;
+	}
+	return -1;
+}
+
+// Double the size of a chunk buffer
+// Parameters:
+// - ptr: The buffer
+// - max: Pointer to the number of elements allocated
+// - size: Size of an element
+// Returns:
+// - void *: The new buffer
+//
+void * chunkGrow(void * ptr, int * max, int size) {
+	*max = *max ? *max * 2 : 4096;
+	ptr = realloc(ptr, (size_t)*max * size);
+	if(ptr == NULL) {
+		fprintf(stderr, "Out of memory\n");
+		exit(1);
+	}
+	return ptr;
+}
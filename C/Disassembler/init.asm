@@ -2,9 +2,10 @@
 ; Title:	Disassembler - Initialisation Code
 ; Author:	Dean Belfield
 ; Created:	18/12/2022
-; Last Updated: 18/12/2022
+; Last Updated: 17/10/2026
 ;
 ; Modinfo:
+; 17/10/2026:	Added putbuf
 
 			SEGMENT CODE
 			
@@ -14,6 +15,7 @@
 			XREF	_main
 			
 			XDEF	_putch
+			XDEF	_putbuf
 			XDEF	_getch
 			
 			XDEF	__putch
@@ -177,6 +179,20 @@ _putch:			PUSH	IY
 			POP	IY				
 			RET
 
+; Write a block of characters out to the ESP32
+; void putbuf(char * buffer, int length)
+;
+_putbuf:		PUSH	IY
+			LD	IY, 0
+			ADD	IY, SP
+			LD	HL, (IY+6)		; HL: Pointer to the buffer
+			LD	BC, (IY+9)		; BC: Number of bytes to send
+			XOR	A, A			; A: Delimiter (not used as BC is not 0)
+			RST.LIL	18h			; Send them to the VDP as one stream
+			LD	SP, IY
+			POP	IY
+			RET
+
 ; Read a character in from the ESP32
 ; int getch(void)
 ;
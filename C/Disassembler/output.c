@@ -0,0 +1,112 @@
+/*
+ * Title:			Disassembler - Output
+ * Author:			Dean Belfield
+ * Created:			17/10/2026
+ * Last Updated:	17/10/2026
+ *
+ * Modinfo:
+ */
+
+#include <string.h>
+
+#include "output.h"
+
+#ifndef HOST_BUILD
+extern void putbuf(char * buffer, int length);	// In init.asm
+#endif
+
+static struct s_output	output;
+
+// Open the output sink
+// Parameters:
+// - mode: OUTPUT_BLOCK or OUTPUT_LINE
+//
+void outputOpen(int mode) {
+#ifdef HOST_BUILD
+	output.file = stdout;
+#endif
+	output.length = 0;
+	output.mode = mode;
+}
+
+#ifdef HOST_BUILD
+// Redirect the output to a file
+// Parameters:
+// - file: The file to write to
+//
+void outputFile(FILE * file) {
+	outputFlush();
+	output.file = file;
+}
+#endif
+
+// Reserve space at the end of the buffer to write into directly
+// Parameters:
+// - length: Maximum number of bytes that will be written
+// Returns:
+// - char *: Pointer to the reserved space
+//
+char * outputReserve(int length) {
+	if(output.length + length > OUTPUT_BUFFER_SIZE) {
+		outputFlush();
+	}
+	return &output.buffer[output.length];
+}
+
+// Commit bytes written into reserved space
+// Parameters:
+// - length: Number of bytes actually written
+//
+void outputCommit(int length) {
+	output.length += length;
+	if(output.mode == OUTPUT_LINE) {
+		outputFlush();
+	}
+}
+
+// Write a block of bytes
+// Parameters:
+// - s: Pointer to the bytes
+// - length: Number of bytes
+//
+void outputWrite(const char * s, int length) {
+	int	n;
+
+	while(length > 0) {
+		if(output.length == OUTPUT_BUFFER_SIZE) {
+			outputFlush();
+		}
+		n = OUTPUT_BUFFER_SIZE - output.length;
+		if(n > length) {
+			n = length;
+		}
+		memcpy(&output.buffer[output.length], s, n);
+		output.length += n;
+		s += n;
+		length -= n;
+	}
+	if(output.mode == OUTPUT_LINE) {
+		outputFlush();
+	}
+}
+
+// Write a zero-terminated string
+// Parameters:
+// - s: Pointer to the string
+//
+void outputString(const char * s) {
+	outputWrite(s, strlen(s));
+}
+
+// Send the buffered output to the VDP (target) or file (host)
+//
+void outputFlush(void) {
+	if(output.length > 0) {
+#ifdef HOST_BUILD
+		fwrite(output.buffer, 1, output.length, output.file);
+#else
+		putbuf(output.buffer, output.length);
+#endif
+		output.length = 0;
+	}
+}
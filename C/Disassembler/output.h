@@ -0,0 +1,44 @@
+/*
+ * Title:			Disassembler - Output
+ * Author:			Dean Belfield
+ * Created:			17/10/2026
+ * Last Updated:	17/10/2026
+ *
+ * Modinfo:
+ */
+
+#ifndef OUTPUT_H
+#define OUTPUT_H
+
+#ifdef HOST_BUILD
+#include <stdio.h>
+#define OUTPUT_BUFFER_SIZE	65536		// Size of the output buffer in bytes
+#else
+#define OUTPUT_BUFFER_SIZE	1024
+#endif
+
+#define OUTPUT_BLOCK		0			// Flush when the buffer is full
+#define OUTPUT_LINE			1			// Flush at the end of every line
+
+// The output sink
+//
+struct s_output {
+	char	buffer[OUTPUT_BUFFER_SIZE];	// Buffered output
+	int		length;						// Number of bytes in the buffer
+	int		mode;						// OUTPUT_BLOCK or OUTPUT_LINE
+#ifdef HOST_BUILD
+	FILE *	file;						// Where the output is written to
+#endif
+};
+
+void	outputOpen(int mode);
+#ifdef HOST_BUILD
+void	outputFile(FILE * file);
+#endif
+char *	outputReserve(int length);
+void	outputCommit(int length);
+void	outputWrite(const char * s, int length);
+void	outputString(const char * s);
+void	outputFlush(void);
+
+#endif
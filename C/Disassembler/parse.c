@@ -0,0 +1,42 @@
+/*
+ * Title:			Disassembler - Parsing Functions
+ * Author:			Dean Belfield
+ * Created:			17/10/2026
+ * Last Updated:	17/10/2026
+ *
+ * Modinfo:
+ */
+
+#include <stdlib.h>
+
+#include "parse.h"
+
+#ifdef HOST_BUILD
+#include <errno.h>
+#else
+extern int errno;				// errno - used by stdlib
+#endif
+
+// Parse a number
+// Parameters:
+// - ptr: Pointer to the number to parse
+// - value: Pointer to the storage for the return value
+// Returns:
+// - 1: Parsed OK
+// - 0: Error parsing the number
+//
+int parseNumber(char * ptr, long * value) {
+	char *  endptr;
+	int 	base = 10;
+	
+	if(*ptr == '&') {
+		base = 16;
+		ptr++;
+	}	
+	errno = 0;
+	*value = strtol(ptr, &endptr, base);
+	if(ptr == endptr || *endptr != '\0' || errno != 0) {
+		return 0;
+	}	
+	return 1;
+}
@@ -0,0 +1,15 @@
+/*
+ * Title:			Disassembler - Parsing Functions
+ * Author:			Dean Belfield
+ * Created:			17/10/2026
+ * Last Updated:	17/10/2026
+ *
+ * Modinfo:
+ */
+
+#ifndef PARSE_H
+#define PARSE_H
+
+int		parseNumber(char * ptr, long * value);
+
+#endif
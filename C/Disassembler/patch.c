@@ -0,0 +1,177 @@
+/*
+ * Title:			Disassembler - Incremental Re-disassembly (host build)
+ * Author:			Dean Belfield
+ * Created:			17/10/2026
+ * Last Updated:	17/10/2026
+ *
+ * Keeps a linear listing up to date as bytes of the image are patched. Only the lines from the
+ * one that contains the first patched byte, up to the first line after the patch that starts
+ * where a line started before, are decoded again; the cross-references they made are replaced
+ * with the ones they make now
+ *
+ * Modinfo:
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "decode.h"
+#include "flow.h"
+#include "patch.h"
+#include "source.h"
+#include "xref.h"
+
+struct s_patch	patch;
+
+static void	patchTarget(struct s_opcode * opcode);
+static void	patchClear(long address, long end);
+
+// Start keeping a listing up to date; the flow map must already hold its lines
+// Parameters:
+// - start: Address of the first line
+// - end: Address after the last byte listed
+// - line: Function that decodes one line of the listing, and returns the address of the next
+// - defined: Function that returns non-zero if a line of the listing starts at an address
+//
+void patchOpen(long start, long end, long (* line)(long address, struct s_opcode * opcode), int (* defined)(long address)) {
+	patchClose();
+	patch.start = start;
+	patch.end = end;
+	patch.line = line;
+	patch.defined = defined;
+}
+
+// Stop keeping the listing up to date
+//
+void patchClose(void) {
+	free(patch.target);
+	memset(&patch, 0, sizeof(patch));
+}
+
+// Patch bytes of the image, and decode the lines of the listing that change
+// Parameters:
+// - address: Address of the first byte
+// - bytes: The new bytes
+// - count: Number of bytes (up to PATCH_MAX)
+// - first: Pointer to the storage for the address of the first line that was decoded again
+// - last: Pointer to the storage for the address after the last line that was decoded again;
+//   the same as first if no line changed
+// Returns:
+// - 1: OK
+// - 0: The bytes aren't all in an image that was read into memory
+//
+int patchApply(long address, unsigned char * bytes, int count, long * first, long * last) {
+	struct s_opcode	opcode;
+	unsigned char	saved[PATCH_MAX];
+	long			end = address + count;
+	long			a, start, sync, old;
+	long			i;
+
+	if(count < 1 || count > PATCH_MAX || source.windowSize > 0 ||
+		address < source.windowBase || end > source.windowBase + source.windowLength) {
+		return 0;
+	}
+	for(i = 0; i < count; i++) {
+		saved[i] = sourceFetch(address + i);
+		sourceStore(address + i, bytes[i]);
+	}
+	*first = *last = address;
+
+	// Find the line the patch starts in; any line before it is unchanged
+	//
+	a = address;
+	while(a > patch.start && a > flow.base && flowType(a) == FLOW_DATA) {
+		a--;
+	}
+	if(flowType(a) != FLOW_CODE) {
+		if(address >= patch.start || end <= patch.start) {
+			return 1;					// Not in a line of the listing
+		}
+		a = patch.start;
+	}
+	start = a;
+
+	// Decode the patched code until a line starts after the patch where a line started before;
+	// from there on the lines are the same
+	//
+	do {
+		a = patch.line(a, &opcode);
+	} while(a < patch.end && (a < end || flowType(a) != FLOW_CODE));
+	sync = a;
+
+	// Remove the references made by the lines as they were
+	//
+	patch.targets = 0;
+	for(i = 0; i < count; i++) {
+		sourceStore(address + i, saved[i]);
+	}
+	for(a = start; a < sync && a < patch.end; ) {
+		a = patch.line(a, &opcode);
+		xrefRemove(&opcode);
+		patchTarget(&opcode);
+	}
+	old = a;
+	for(i = 0; i < count; i++) {
+		sourceStore(address + i, bytes[i]);
+	}
+
+	// Add the lines as they are now
+	//
+	patchClear(start, old > sync ? old : sync);
+	for(a = start; a < sync; ) {
+		flowMap(a) = FLOW_CODE;
+		a = patch.line(a, &opcode);
+		flowData(opcode.address + 1, a - opcode.address - 1);
+		xrefInsert(&opcode);
+		patchTarget(&opcode);
+	}
+
+	// The addresses referred to, and the addresses in the lines decoded, may have gained or
+	// lost a label
+	//
+	for(i = 0; i < patch.targets; i++) {
+		xrefRelabel(patch.target[i], patch.defined);
+	}
+	for(a = start; a < sync; a++) {
+		xrefRelabel(a, patch.defined);
+	}
+	*first = start;
+	*last = sync;
+	return 1;
+}
+
+// Note the address a line refers to, as its label may change
+// Parameters:
+// - opcode: The decoded line
+//
+static void patchTarget(struct s_opcode * opcode) {
+	long *	target;
+	long	address, max;
+
+	if(xrefTarget(opcode, &address) < 0) {
+		return;
+	}
+	if(patch.targets == patch.targetMax) {
+		max = patch.targetMax ? patch.targetMax * 2 : 64;
+		target = realloc(patch.target, max * sizeof(long));
+		if(target == NULL) {
+			return;
+		}
+		patch.target = target;
+		patch.targetMax = max;
+	}
+	patch.target[patch.targets++] = address;
+}
+
+// Clear the flow map for a range of addresses in the image
+// Parameters:
+// - address: Address of the first byte
+// - end: Address after the last byte
+//
+static void patchClear(long address, long end) {
+	for(; address < end; address++) {
+		if((unsigned long)(address - flow.base) < (unsigned long)flow.length) {
+			flowMap(address) = FLOW_UNKNOWN;
+		}
+	}
+}
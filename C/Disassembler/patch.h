@@ -0,0 +1,36 @@
+/*
+ * Title:			Disassembler - Incremental Re-disassembly (host build)
+ * Author:			Dean Belfield
+ * Created:			17/10/2026
+ * Last Updated:	17/10/2026
+ *
+ * Modinfo:
+ */
+
+#ifndef PATCH_H
+#define PATCH_H
+
+#include "decode.h"
+
+#define PATCH_MAX		256			// Maximum number of bytes in a patch
+
+// A linear listing that is kept up to date as the image is patched. The start of each line is
+// marked FLOW_CODE in the flow map, and the rest of its bytes FLOW_DATA
+//
+struct s_patch {
+	long	start;					// Address of the first line of the listing
+	long	end;					// Address after the last byte listed
+	long	(* line)(long address, struct s_opcode * opcode);	// Decodes one line of the listing
+	int		(* defined)(long address);	// Returns non-zero if a line of the listing starts at an address
+	long *	target;					// Addresses whose label may have changed with the last patch
+	long	targets;				// Number of addresses
+	long	targetMax;				// Space allocated for addresses
+};
+
+extern struct s_patch	patch;
+
+void	patchOpen(long start, long end, long (* line)(long address, struct s_opcode * opcode), int (* defined)(long address));
+void	patchClose(void);
+int		patchApply(long address, unsigned char * bytes, int count, long * first, long * last);
+
+#endif
@@ -0,0 +1,297 @@
+/*
+ * Title:			Disassembler - Structured Output (host build)
+ * Author:			Dean Belfield
+ * Created:			17/10/2026
+ * Last Updated:	17/10/2026
+ *
+ * Writes decoded instructions as JSON Lines or fixed-size binary records for other tools
+ *
+ * Modinfo:
+ * 17/10/2026:		Added the cycle counts, and recordBlock
+ * 17/10/2026:		Control characters are escaped in JSON strings
+ */
+
+#include <string.h>
+
+#include "cycles.h"
+#include "decode.h"
+#include "format.h"
+#include "record.h"
+#include "symbol.h"
+#include "xref.h"
+
+static const char *	t_kind[] = {	// Kinds of the operands fetched from the code, from OP_N on
+	"n", "port", "nn", "(nn)", "rel", "(IX+d)", "(IY+d)", "IX+d", "IY+d"
+};
+
+static const char *	t_ref[] = { "call", "jump", "read", "write" };	// Indexed by XREF_*
+
+static char *	recordEscape(char * t, const char * s);
+static char *	recordNumber(char * t, long value);
+static char *	recordOperand(char * t, unsigned char operand, long value);
+static char *	recordLong(char * t, long value);
+static char *	recordCycles(char * t, const char * name, long adl, long z80);
+
+// Build the header of the binary output
+// Parameters:
+// - t: Pointer to the buffer (at least size bytes)
+// - size: Size of a record, RECORD_SIZE or RECORD_SIZE_CYCLES
+// Returns:
+// - int: The size
+//
+int recordHeader(char * t, int size) {
+	memset(t, 0, size);
+	memcpy(t, "eZ80DIS", 7);
+	t[7] = RECORD_VERSION;
+	t[8] = size & 0xFF;
+	t[9] = size >> 8;
+	return size;
+}
+
+// Build a JSON record for a decoded instruction, terminated with a line feed
+// Parameters:
+// - t: Pointer to the buffer (at least RECORD_JSON_MAX bytes)
+// - opcode: Pointer to the opcode structure
+// - timing: The cycles the instruction takes, or NULL to leave them out
+// Returns:
+// - int: Length of the record in bytes, excluding the terminator
+//
+int recordJson(char * t, struct s_opcode * opcode, struct s_timing * timing) {
+	const struct s_decode *	d = opcode->decode;
+	const char *			name;
+	char *					s = t;
+	long					target;
+	int						type, i;
+
+	t = formatString(t, "{\"address\":");
+	t = recordNumber(t, opcode->address);
+	t = formatString(t, ",\"length\":");
+	t = recordNumber(t, opcode->count);
+	t = formatString(t, ",\"bytes\":[");
+	for(i = 0; i < opcode->count; i++) {
+		if(i > 0) {
+			*t++ = ',';
+		}
+		t = recordNumber(t, opcode->byteData[i]);
+	}
+	t = formatString(t, "],\"shift\":");
+	t = recordNumber(t, opcode->shift);
+	t = formatString(t, ",\"suffix\":\"");
+	t = recordEscape(t, t_am[opcode->addressMode] + (opcode->addressMode != AM_NONE));
+	t = formatString(t, "\",\"adl\":");
+	t = recordNumber(t, adl != 0);
+	t = formatString(t, ",\"mnemonic\":\"");
+	t = recordEscape(t, t_mnemonic[d->mnemonic]);
+	t = formatString(t, "\",\"operands\":[");
+	if(d->mnemonic != M_DB && d->operand1 != OP_NONE) {
+		t = recordOperand(t, d->operand1, opcode->value[0]);
+		if(d->operand2 != OP_NONE) {
+			*t++ = ',';
+			t = recordOperand(t, d->operand2, opcode->value[1]);
+		}
+	}
+	*t++ = ']';
+	type = xrefTarget(opcode, &target);
+	if(type >= 0) {
+		t = formatString(t, ",\"ref\":\"");
+		t = recordEscape(t, t_ref[type]);
+		t = formatString(t, "\",\"target\":");
+		t = recordNumber(t, target);
+		name = symbolFind(target);
+		if(name) {
+			t = formatString(t, ",\"symbol\":\"");
+			t = recordEscape(t, name);
+			*t++ = '"';
+		}
+	}
+	if(timing && timing->cycles[1] > 0) {
+		t = recordCycles(t, "cycles", timing->cycles[1], timing->cycles[0]);
+		if(timing->flags & (C_COND | C_REPEAT)) {
+			t = recordCycles(t, "taken", timing->taken[1], timing->taken[0]);
+		}
+	}
+	t = formatString(t, ",\"text\":\"");
+	t = recordEscape(t, opcode->text);
+	t = formatString(t, "\"}\n");
+	*t = '\0';
+	return t - s;
+}
+
+// Build a binary record for a decoded instruction (see record.h for the layout)
+// Parameters:
+// - t: Pointer to the buffer (at least RECORD_SIZE_CYCLES bytes)
+// - opcode: Pointer to the opcode structure
+// - timing: The cycles the instruction takes, or NULL to leave them out
+// Returns:
+// - int: RECORD_SIZE_CYCLES with the cycles, otherwise RECORD_SIZE
+//
+int recordBinary(char * t, struct s_opcode * opcode, struct s_timing * timing) {
+	const struct s_decode *	d = opcode->decode;
+	long					target = 0;
+	int						type;
+
+	memset(t, 0, RECORD_SIZE);
+	recordLong(t, opcode->address);
+	t[4] = opcode->count;
+	t[5] = opcode->shift;
+	t[6] = opcode->addressMode;
+	t[7] = d->mnemonic;
+	memcpy(&t[8], opcode->byteData, opcode->count);
+	if(d->mnemonic != M_DB) {
+		t[16] = d->operand1;
+		t[17] = d->operand2;
+	}
+	t[18] = adl ? RECORD_F_ADL : 0;
+	type = xrefTarget(opcode, &target);
+	t[19] = type >= 0 ? type : 0xFF;
+	recordLong(&t[20], opcode->value[0]);
+	recordLong(&t[24], opcode->value[1]);
+	recordLong(&t[28], type >= 0 ? target : 0);
+	if(timing) {
+		t[32] = timing->cycles[1];
+		t[33] = timing->taken[1];
+		t[34] = timing->cycles[0];
+		t[35] = timing->taken[0];
+		return RECORD_SIZE_CYCLES;
+	}
+	return RECORD_SIZE;
+}
+
+// Build a JSON record with the total cycles of a basic block, terminated with a line feed
+// Parameters:
+// - t: Pointer to the buffer (at least RECORD_JSON_MAX bytes)
+// - block: The block
+// Returns:
+// - int: Length of the record in bytes, excluding the terminator
+//
+int recordBlock(char * t, struct s_block * block) {
+	char *	s = t;
+
+	t = formatString(t, "{\"block\":");
+	t = recordNumber(t, block->address);
+	t = formatString(t, ",\"end\":");
+	t = recordNumber(t, block->end);
+	t = formatString(t, ",\"instructions\":");
+	t = recordNumber(t, block->count);
+	t = recordCycles(t, "cycles", block->cycles[1], block->cycles[0]);
+	if(block->flags & C_COND) {
+		t = recordCycles(t, "taken", block->taken[1], block->taken[0]);
+	}
+	t = formatString(t, "}\n");
+	*t = '\0';
+	return t - s;
+}
+
+// Write a string value out, escaping the characters JSON requires: quotes, backslashes and
+// control characters (\n and \t, and the rest as \u00XX)
+// Parameters:
+// - t: Pointer to the buffer
+// - s: The string
+// Returns:
+// - char *: Pointer to the end of the text
+//
+static char * recordEscape(char * t, const char * s) {
+	unsigned char	c;
+
+	for(; *s; s++) {
+		c = *s;
+		if(c == '"' || c == '\\') {
+			*t++ = '\\';
+			*t++ = c;
+		}
+		else if(c == '\n') {
+			t = formatString(t, "\\n");
+		}
+		else if(c == '\t') {
+			t = formatString(t, "\\t");
+		}
+		else if(c < 0x20) {
+			t = formatString(t, "\\u00");
+			t = formatHex(t, c, 2);
+		}
+		else {
+			*t++ = c;
+		}
+	}
+	return t;
+}
+
+// Write a number out in decimal
+// Parameters:
+// - t: Pointer to the buffer
+// - value: The number
+// Returns:
+// - char *: Pointer to the end of the text
+//
+static char * recordNumber(char * t, long value) {
+	char	digits[12];
+	int		i = 0;
+
+	if(value < 0) {
+		*t++ = '-';
+		value = -value;
+	}
+	do {
+		digits[i++] = '0' + value % 10;
+		value /= 10;
+	} while(value > 0);
+	while(i > 0) {
+		*t++ = digits[--i];
+	}
+	return t;
+}
+
+// Write an operand out as a JSON object: its kind, and its value if it is fetched from the code
+// Parameters:
+// - t: Pointer to the buffer
+// - operand: The operand (OP_*)
+// - value: The value fetched from the code, if any
+// Returns:
+// - char *: Pointer to the end of the text
+//
+static char * recordOperand(char * t, unsigned char operand, long value) {
+	t = formatString(t, "{\"kind\":\"");
+	t = recordEscape(t, operand >= OP_N ? t_kind[operand - OP_N] : t_operand[operand]);
+	*t++ = '"';
+	if(operand >= OP_N) {
+		t = formatString(t, ",\"value\":");
+		t = recordNumber(t, value);
+	}
+	*t++ = '}';
+	return t;
+}
+
+// Write a 32-bit value out, little-endian
+// Parameters:
+// - t: Pointer to the buffer
+// - value: The value
+// Returns:
+// - char *: Pointer to the end of the value
+//
+static char * recordLong(char * t, long value) {
+	*t++ = value & 0xFF;
+	*t++ = (value >> 8) & 0xFF;
+	*t++ = (value >> 16) & 0xFF;
+	*t++ = (value >> 24) & 0xFF;
+	return t;
+}
+
+// Write cycle counts out as a JSON member: "name":{"adl":n,"z80":n}, preceded by a comma
+// Parameters:
+// - t: Pointer to the buffer
+// - name: Name of the member
+// - adl: Cycles in ADL mode
+// - z80: Cycles in Z80 mode
+// Returns:
+// - char *: Pointer to the end of the text
+//
+static char * recordCycles(char * t, const char * name, long adl, long z80) {
+	t = formatString(t, ",\"");
+	t = formatString(t, name);
+	t = formatString(t, "\":{\"adl\":");
+	t = recordNumber(t, adl);
+	t = formatString(t, ",\"z80\":");
+	t = recordNumber(t, z80);
+	*t++ = '}';
+	return t;
+}
@@ -0,0 +1,59 @@
+/*
+ * Title:			Disassembler - Structured Output (host build)
+ * Author:			Dean Belfield
+ * Created:			17/10/2026
+ * Last Updated:	17/10/2026
+ *
+ * Modinfo:
+ * 17/10/2026:		Records can carry cycle counts, and JSON output the totals of basic blocks
+ * 17/10/2026:		Version 2: INIRX, OTIRX, INDRX and OTDRX were added to the mnemonics before M_DB
+ * 17/10/2026:		JSON records can be longer, as control characters are escaped
+ */
+
+#ifndef RECORD_H
+#define RECORD_H
+
+#include "cycles.h"
+#include "decode.h"
+
+#define RECORD_TEXT		0			// Listing lines
+#define RECORD_JSON		1			// One JSON object per line
+#define RECORD_BINARY	2			// Fixed-size binary records
+
+#define RECORD_JSON_MAX	1024		// Maximum size of a JSON record, including the terminator; a control character in a symbol takes 6
+#define RECORD_SIZE		32			// Size of a binary record, and of the header that precedes them
+#define RECORD_SIZE_CYCLES	36		// Size of a binary record with cycle counts
+#define RECORD_VERSION	2			// Version of the binary layout in the header
+
+// Binary records are little-endian, with no padding:
+//
+// Offset	Size	Field
+// 0		4		Address
+// 4		1		Length in bytes
+// 5		1		Prefix (shift): 0x00, 0xCB, 0xDD, 0xED or 0xFD
+// 6		1		Addressing mode suffix (AM_*)
+// 7		1		Mnemonic (M_*; M_DB for data)
+// 8		8		The bytes, padded with zeros
+// 16		1		First operand (OP_*)
+// 17		1		Second operand (OP_*)
+// 18		1		Flags (RECORD_F_*)
+// 19		1		Reference type (XREF_*), or 0xFF if there is no target
+// 20		4		Value of the first operand, signed
+// 24		4		Value of the second operand, signed
+// 28		4		Target address, if the reference type is set
+// 32		1		Cycles in ADL mode; if conditional, when not taken (RECORD_SIZE_CYCLES only)
+// 33		1		Cycles in ADL mode when taken, or when a block instruction repeats
+// 34		1		Cycles in Z80 mode; if conditional, when not taken
+// 35		1		Cycles in Z80 mode when taken, or when a block instruction repeats
+//
+// The header is "eZ80DIS", the version byte, the record size as 2 bytes, then zeros; it is
+// the size of a record, padded with zeros
+//
+#define RECORD_F_ADL	0x01		// Decoded in ADL mode
+
+int		recordHeader(char * t, int size);
+int		recordJson(char * t, struct s_opcode * opcode, struct s_timing * timing);
+int		recordBinary(char * t, struct s_opcode * opcode, struct s_timing * timing);
+int		recordBlock(char * t, struct s_block * block);
+
+#endif
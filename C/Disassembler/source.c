@@ -0,0 +1,410 @@
+/*
+ * Title:			Disassembler - Memory Source (host build)
+ * Author:			Dean Belfield
+ * Created:			17/10/2026
+ * Last Updated:	17/10/2026
+ *
+ * Modinfo:
+ * 17/10/2026:		Images are memory-mapped in windows rather than read into a buffer
+ * 17/10/2026:		Added sourceStore
+ * 17/10/2026:		Added sourceStream and sourceFill, to read an image from a pipe
+ * 17/10/2026:		Intel HEX records are checked to be all there before their fields are read
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "source.h"
+
+struct s_source	source;
+
+static int	sourceMap(long address);
+static int	sourceRead(void);
+static long	sourceHex(unsigned char * text);
+static int	sourceHexPass(unsigned char * text, unsigned char * image, long * lo, long * hi);
+static int	hexByte(unsigned char * ptr);
+static int	hexBytes(unsigned char * ptr, int count);
+
+// Load an image
+// Parameters:
+// - filename: The file to load
+// - type: SOURCE_AUTO, SOURCE_BIN, SOURCE_HEX or SOURCE_RAW
+// - base: Address of the first byte of the image, or -1 for the default (ignored for Intel HEX)
+// - window: Size of the window to map the file in, or 0 to read it into memory; anything
+//   larger than the file maps it whole
+// Returns:
+// - 1: Loaded OK
+// - 0: Error reading or parsing the file
+//
+int sourceLoad(char * filename, int type, long base, long window) {
+	unsigned char	header[69];
+	unsigned char *	data;
+	struct stat		st;
+	long			length;
+	long			page;
+	int				fd;
+
+	fd = open(filename, O_RDONLY);
+	if(fd < 0 || fstat(fd, &st) < 0) {
+		return 0;
+	}
+	length = st.st_size;
+	memset(header, 0, sizeof(header));
+	if(pread(fd, header, sizeof(header), 0) < 0) {
+		close(fd);
+		return 0;
+	}
+
+	memset(&source, 0, sizeof(source));
+	source.mode = -1;
+	source.fd = -1;
+
+	if(type == SOURCE_AUTO) {
+		if(length > 0 && header[0] == ':') {
+			type = SOURCE_HEX;
+		}
+		else if(length >= 69 && memcmp(&header[64], "MOS", 3) == 0) {
+			type = SOURCE_BIN;
+		}
+		else {
+			type = SOURCE_RAW;
+		}
+	}
+	source.type = type;
+
+	if(type == SOURCE_BIN && length >= 69 && memcmp(&header[64], "MOS", 3) == 0) {
+		source.mode = header[68];
+	}
+	if(base < 0) {
+		base = type == SOURCE_BIN ? SOURCE_BASE_BIN : 0;
+	}
+	source.base = base;
+	source.length = length;
+
+	// Intel HEX files need parsing, so are always read; anything else is mapped straight from
+	// the file unless asked otherwise
+	//
+	if(type == SOURCE_HEX || window <= 0) {
+		data = malloc(length + 1);
+		if(data == NULL || pread(fd, data, length, 0) != length) {
+			free(data);
+			close(fd);
+			return 0;
+		}
+		close(fd);
+		if(type == SOURCE_HEX) {
+			data[length] = '\0';
+			length = sourceHex(data);
+			free(data);
+			return length > 0;
+		}
+		source.buffer = data;
+		source.window = data;
+		source.windowBase = base;
+		source.windowLength = length;
+		return 1;
+	}
+
+	if(window > length && length > 0) {
+		window = length;				// Map the whole file if it fits in one window
+	}
+	page = sysconf(_SC_PAGESIZE);
+	source.windowSize = (window + page - 1) / page * page;
+	source.fd = fd;
+	return length == 0 || sourceMap(base);
+}
+
+// Read a raw image from a stream, such as a pipe, rather than a file. Only the last SOURCE_RING
+// bytes are kept, so the image is disassembled a line at a time as it arrives; see sourceFill
+// Parameters:
+// - fd: The stream, which is not closed by sourceClose
+// - base: Address of the first byte of the image
+// - idle: Function called before waiting for more of the stream (to flush the output), or NULL
+//
+void sourceStream(int fd, long base, void (* idle)(void)) {
+	memset(&source, 0, sizeof(source));
+	source.mode = -1;
+	source.type = SOURCE_RAW;
+	source.base = base;
+	source.fd = fd;
+	source.stream = 1;
+	source.head = base;
+	source.keep = base;
+	source.idle = idle;
+}
+
+// Start decoding a line from a stream: the bytes before its address are no longer needed, and
+// any that haven't been read yet are skipped. The bytes of the line are read as they are fetched
+// Parameters:
+// - address: Address of the line
+// Returns:
+// - 1: There is at least one byte at the address
+// - 0: The stream has ended
+//
+int sourceFill(long address) {
+	source.keep = address;
+	while(source.head <= address && sourceRead());
+	return source.head > address;
+}
+
+// Free the image
+//
+void sourceClose(void) {
+	if(source.windowSize > 0) {
+		if(source.window != NULL) {
+			munmap(source.window, source.windowLength);
+		}
+		close(source.fd);
+	}
+	free(source.buffer);
+	memset(&source, 0, sizeof(source));
+}
+
+// Called by sourceFetch when reading outside of the window; moves the window if the address
+// is in the image. A stream has no window, so every byte is fetched from its ring buffer here
+// Parameters:
+// - address: The address being read
+// Returns:
+// - unsigned char: The byte, or 0 if the address is outside of the image
+//
+unsigned char sourceMiss(long address) {
+	if(source.stream && address >= source.keep && address < source.keep + SOURCE_RING) {
+		while(address >= source.head && sourceRead());
+		if(address < source.head) {
+			return source.ring[address & (SOURCE_RING - 1)];
+		}
+	}
+	if(source.windowSize > 0 && (unsigned long)(address - source.base) < (unsigned long)source.length) {
+		if(sourceMap(address)) {
+			return source.window[address - source.windowBase];
+		}
+	}
+	source.overrun = 1;
+	return 0;
+}
+
+// Change a byte of an image that was read into memory
+// Parameters:
+// - address: The address
+// - value: The new byte
+// Returns:
+// - 1: OK
+// - 0: The address is outside the image, or the image is mapped
+//
+int sourceStore(long address, unsigned char value) {
+	if(source.windowSize > 0 || (unsigned long)(address - source.windowBase) >= (unsigned long)source.windowLength) {
+		return 0;
+	}
+	source.window[address - source.windowBase] = value;
+	return 1;
+}
+
+// Map the window containing an address; only one window is mapped at a time so that the
+// resident memory stays bounded however large the image is
+// Parameters:
+// - address: The address
+// Returns:
+// - 1: Mapped OK
+// - 0: The mapping failed
+//
+static int sourceMap(long address) {
+	long	offset = (address - source.base) / source.windowSize * source.windowSize;
+	long	length = source.length - offset;
+
+	if(length > source.windowSize) {
+		length = source.windowSize;
+	}
+	if(source.window != NULL) {
+		munmap(source.window, source.windowLength);
+	}
+	source.window = mmap(NULL, length, PROT_READ, MAP_PRIVATE, source.fd, offset);
+	if(source.window == MAP_FAILED) {
+		source.window = NULL;
+		source.windowLength = 0;
+		return 0;
+	}
+	madvise(source.window, length, MADV_SEQUENTIAL);
+	source.windowBase = source.base + offset;
+	source.windowLength = length;
+	return 1;
+}
+
+// Read as much of a stream as there is room for in the ring buffer, without overwriting the
+// line being decoded; waits if nothing has arrived yet
+// Returns:
+// - 1: Read OK
+// - 0: The stream has ended
+//
+static int sourceRead(void) {
+	struct pollfd	p;
+	long			offset = source.head & (SOURCE_RING - 1);
+	long			n = SOURCE_RING - offset;
+
+	if(n > source.keep + SOURCE_RING - source.head) {
+		n = source.keep + SOURCE_RING - source.head;
+	}
+	while(!source.ended) {
+		if(source.idle != NULL) {
+			p.fd = source.fd;
+			p.events = POLLIN;
+			if(poll(&p, 1, 0) == 0) {
+				source.idle();			// Nothing to read yet, so let the output catch up
+			}
+		}
+		n = read(source.fd, &source.ring[offset], n);
+		if(n > 0) {
+			source.head += n;
+			source.length = source.head - source.base;
+			return 1;
+		}
+		if(n == 0 || errno != EINTR) {
+			source.ended = 1;
+		}
+	}
+	return 0;
+}
+
+// Parse an Intel HEX file into the image; gaps between records are filled with &FF
+// Parameters:
+// - text: The file contents, zero terminated
+// Returns:
+// - long: Size of the image, or 0 if the file is invalid
+//
+static long sourceHex(unsigned char * text) {
+	unsigned char *	image;
+	long			lo = 0x7FFFFFFF;
+	long			hi = 0;
+
+	if(!sourceHexPass(text, NULL, &lo, &hi) || hi <= lo) {
+		return 0;
+	}
+	image = malloc(hi - lo);
+	if(image == NULL) {
+		return 0;
+	}
+	memset(image, 0xFF, hi - lo);
+	sourceHexPass(text, image, &lo, &hi);
+
+	source.buffer = image;
+	source.window = image;
+	source.base = source.windowBase = lo;
+	source.length = source.windowLength = hi - lo;
+	return source.length;
+}
+
+// One pass over the records of an Intel HEX file
+// Parameters:
+// - text: The file contents, zero terminated
+// - image: Where to write the data, or NULL to just find the address range
+// - lo: Pointer to the lowest address
+// - hi: Pointer to the address after the highest
+// Returns:
+// - 1: Parsed OK
+// - 0: The file is invalid
+//
+static int sourceHexPass(unsigned char * text, unsigned char * image, long * lo, long * hi) {
+	unsigned char *	ptr = text;
+	long			upper = 0;
+	long			address;
+	int				count, type, sum, i;
+
+	while(*ptr) {
+		if(*ptr != ':') {
+			ptr++;						// Skip line endings and anything else between records
+			continue;
+		}
+		ptr++;
+		//
+		// The byte count says how long the record is; every digit up to the checksum is checked
+		// before any of the other fields are read, so a record cut short is never read past
+		//
+		count = hexByte(ptr);
+		if(count < 0 || !hexBytes(ptr + 2, count + 4)) {
+			return 0;
+		}
+		address = (hexByte(ptr + 2) << 8) | hexByte(ptr + 4);
+		type = hexByte(ptr + 6);
+		if((type == 0x02 || type == 0x04) && count != 2) {
+			return 0;					// An extended address is always 2 bytes
+		}
+		sum = count + (address >> 8) + (address & 0xFF) + type;
+		for(i = 0; i <= count; i++) {
+			sum += hexByte(ptr + 8 + i * 2);
+		}
+		if((sum & 0xFF) != 0) {
+			return 0;					// Checksum error
+		}
+		switch(type) {
+			case 0x00: {				// Data
+				address += upper;
+				if(image) {
+					for(i = 0; i < count; i++) {
+						image[address - *lo + i] = hexByte(ptr + 8 + i * 2);
+					}
+				}
+				else if(count > 0) {
+					if(address < *lo) *lo = address;
+					if(address + count > *hi) *hi = address + count;
+				}
+			} break;
+			case 0x01: {				// End of file
+				return 1;
+			} break;
+			case 0x02: {				// Extended segment address
+				upper = ((hexByte(ptr + 8) << 8) | hexByte(ptr + 10)) << 4;
+			} break;
+			case 0x04: {				// Extended linear address
+				upper = ((long)hexByte(ptr + 8) << 24) | ((long)hexByte(ptr + 10) << 16);
+			} break;
+		}
+		ptr += 8 + (count + 1) * 2;
+	}
+	return 1;
+}
+
+// Parse two hexadecimal digits
+// Parameters:
+// - ptr: Pointer to the digits
+// Returns:
+// - int: The byte, or -1 if either character is not a hexadecimal digit
+//
+static int hexByte(unsigned char * ptr) {
+	int	i, c, v = 0;
+
+	for(i = 0; i < 2; i++) {
+		c = ptr[i];
+		if(c >= '0' && c <= '9') c -= '0';
+		else if(c >= 'A' && c <= 'F') c -= 'A' - 10;
+		else if(c >= 'a' && c <= 'f') c -= 'a' - 10;
+		else return -1;
+		v = (v << 4) | c;
+	}
+	return v;
+}
+
+// Check that there are enough bytes written as pairs of hexadecimal digits. It stops at the first
+// character that isn't a digit, so it doesn't read past the end of the text
+// Parameters:
+// - ptr: Pointer to the digits
+// - count: Number of bytes needed
+// Returns:
+// - 1: They are all there
+// - 0: They aren't
+//
+static int hexBytes(unsigned char * ptr, int count) {
+	int	i;
+
+	for(i = 0; i < count; i++) {
+		if(hexByte(ptr + i * 2) < 0) {
+			return 0;
+		}
+	}
+	return 1;
+}
@@ -0,0 +1,59 @@
+/*
+ * Title:			Disassembler - Memory Source (host build)
+ * Author:			Dean Belfield
+ * Created:			17/10/2026
+ * Last Updated:	17/10/2026
+ *
+ * Modinfo:
+ * 17/10/2026:		Images are memory-mapped in windows rather than read into a buffer
+ * 17/10/2026:		Images can be streamed through a ring buffer
+ */
+
+#ifndef SOURCE_H
+#define SOURCE_H
+
+#define SOURCE_AUTO		0			// Work out the type from the file contents
+#define SOURCE_BIN		1			// MOS executable
+#define SOURCE_HEX		2			// Intel HEX
+#define SOURCE_RAW		3			// Raw memory dump
+
+#define SOURCE_BASE_BIN	0x040000	// Default load address of MOS executables
+#define SOURCE_WINDOW	0x400000	// Default size of the mapped window (4MB)
+#define SOURCE_RING		8			// Size of the stream ring buffer: a power of 2, and no less than the longest instruction
+
+// An image of the eZ80's memory
+//
+struct s_source {
+	long			base;			// Address of the first byte of the image
+	long			length;			// Size of the image in bytes
+	int				type;			// SOURCE_BIN, SOURCE_HEX or SOURCE_RAW
+	int				mode;			// ADL mode from the MOS header, or -1 if there isn't one
+	int				overrun;		// Set if a fetch was made outside the image
+	unsigned char *	window;			// The part of the image that can be read directly
+	long			windowBase;		// Address of the first byte of the window
+	long			windowLength;	// Size of the window in bytes
+	long			windowSize;		// Size of a mapped window, or 0 if the image was read into memory
+	int				fd;				// The mapped file
+	unsigned char *	buffer;			// The image, if it was read into memory
+	int				stream;			// Set if the image is read from a stream, a line at a time
+	int				ended;			// Set when the end of the stream has been read
+	long			head;			// Address after the last byte read from the stream
+	long			keep;			// Address of the line being decoded; the ring holds from here on
+	unsigned char	ring[SOURCE_RING];	// The bytes of the line being decoded, indexed by address
+	void			(* idle)(void);	// Called before waiting for more of the stream, or NULL
+};
+
+extern struct s_source	source;
+
+// Fetch a byte from the image; bytes outside the image read as 0 and set source.overrun
+//
+#define sourceFetch(a)	((unsigned long)((a) - source.windowBase) < (unsigned long)source.windowLength ? source.window[(a) - source.windowBase] : sourceMiss(a))
+
+int				sourceLoad(char * filename, int type, long base, long window);
+void			sourceStream(int fd, long base, void (* idle)(void));
+int				sourceFill(long address);
+void			sourceClose(void);
+unsigned char	sourceMiss(long address);
+int				sourceStore(long address, unsigned char value);
+
+#endif
@@ -0,0 +1,283 @@
+/*
+ * Title:			Disassembler - Instruction Mix (host build)
+ * Author:			Dean Belfield
+ * Created:			17/10/2026
+ * Last Updated:	17/10/2026
+ *
+ * Counts the instructions in a range of the image without decoding their operands or building
+ * any text. Each instruction is walked through the length tables, as decodeLength does, and
+ * counted against its entry in the decode tables; the prefixes, the eZ80-only instructions and
+ * the operand sizes are all worked out from those counts when the report is written
+ *
+ * Modinfo:
+ * 17/10/2026:		INIRX, OTIRX, INDRX and OTDRX are eZ80-only instructions
+ * 17/10/2026:		Clean with -Wextra
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "decode.h"
+#include "format.h"
+#include "output.h"
+#include "stats.h"
+#include "syntax.h"
+
+#define STATS_NAME		16			// Width of the name column in the report
+#define STATS_COUNT		12			// Width of the count column
+
+struct s_stats	stats;
+
+// The instructions that the eZ80 has and the Z80 doesn't
+//
+static const unsigned char	t_ez80[] = {
+	M_IN0, M_OUT0, M_LEA, M_PEA, M_TST, M_TSTIO, M_MLT, M_LDMBA, M_LDAMB, M_SLP, M_STMIX, M_RSMIX,
+	M_INIM, M_OTIM, M_INI2, M_INDM, M_OTDM, M_IND2, M_INIMR, M_OTIMR, M_INI2R, M_INDMR, M_OTDMR, M_IND2R,
+	M_OUTI2, M_OUTD2, M_OTI2R, M_OTD2R, M_INIRX, M_OTIRX, M_INDRX, M_OTDRX,
+};
+
+static const char *	t_prefix[] = { "CB", "ED", "DD", "FD" };	// Indexed by T_* - 1
+
+static unsigned long	mnemonic[M_COUNT];	// Instructions, by mnemonic, while the report is written
+
+static int		statsCompare(const void * a, const void * b);
+static void		statsTitle(const char * title);
+static void		statsRow(const char * name, unsigned long count, unsigned long total);
+static char *	statsNumber(char * t, unsigned long value);
+
+// Clear the counters
+//
+void statsOpen(void) {
+	memset(&stats, 0, sizeof(stats));
+}
+
+// Count an instruction
+// Parameters:
+// - ptr: Pointer to the first byte of the instruction; at least 8 bytes must be readable
+// - adlMode: ADL mode
+// Returns:
+// - int: Size of the instruction in bytes, including any suffix and prefixes
+//
+int statsInstruction(unsigned char * ptr, long adlMode) {
+	unsigned char	l, b = *ptr, am = AM_NONE;
+	int				table = T_MAIN, count = 1;
+
+	l = t_length[T_MAIN][b];
+	if(l & L_SUFFIX) {
+		am = l >> 5;
+		b = ptr[count++];
+		l = t_length[T_MAIN][b];
+		if(l & L_SUFFIX) {
+			stats.suffix[l >> 5]++;			// The second suffix stands, as in decodeOpcode
+			stats.invalid++;
+			return count;
+		}
+	}
+	if(l & L_PREFIX) {
+		table = l >> 5;
+		b = ptr[count++];
+		l = t_length[table][b];
+		if(l & L_PREFIX) {
+			table = l >> 5;
+			b = ptr[count + 1];				// DD CB d op / FD CB d op
+			l = 0;
+			count += 2;
+		}
+	}
+	stats.entry[table * 256 + b]++;
+	stats.suffix[am]++;
+	count += l & L_BYTES;
+	if(l & L_WORD) {
+		if(am == AM_NONE ? adlMode == 1 : am >= AM_SIL) {
+			stats.word[1]++;
+			count += 3;
+		}
+		else {
+			stats.word[0]++;
+			count += 2;
+		}
+	}
+	return count;
+}
+
+// Write the report out: the instructions by mnemonic, most used first, then by prefix, suffix,
+// the eZ80-only instructions, and the operands fetched from the code
+// Parameters:
+// - address: Start address of the range
+// - end: Address after the range
+//
+void statsWrite(long address, long end) {
+	const struct s_decode *	d = t_decode[0];
+	unsigned long			prefix[4] = { 0, 0, 0, 0 };
+	unsigned long			operand[3] = { 0, 0, 0 };
+	unsigned long			total = 0, ez80 = 0;
+	unsigned char			order[M_COUNT];
+	char *					s = outputReserve(FORMAT_LINE_MAX);
+	char *					t = s;
+	int						i, k, table;
+
+	memset(mnemonic, 0, sizeof(mnemonic));
+	for(i = 0; i < T_COUNT * 256; i++) {
+		if(stats.entry[i] == 0) {
+			continue;
+		}
+		total += stats.entry[i];
+		mnemonic[d[i].mnemonic] += stats.entry[i];
+		table = i >> 8;
+		if(table == T_DDCB || table == T_FDCB) {
+			prefix[T_CB - 1] += stats.entry[i];
+			table = table == T_DDCB ? T_DD : T_FD;
+		}
+		if(table != T_MAIN) {
+			prefix[table - 1] += stats.entry[i];
+		}
+		for(k = 0; k < 2; k++) {
+			switch(k == 0 ? d[i].operand1 : d[i].operand2) {
+				case OP_N: case OP_PORT: {
+					operand[0] += stats.entry[i];
+				} break;
+				case OP_IXD: case OP_IYD: case OP_IXO: case OP_IYO: {
+					operand[1] += stats.entry[i];
+				} break;
+				case OP_REL: {
+					operand[2] += stats.entry[i];
+				} break;
+			}
+		}
+	}
+	total += stats.invalid;
+
+	t = formatString(t, "Instruction mix of ");
+	t = formatString(t, syntax.hex);
+	t = formatHex(t, address, 6);
+	t = formatString(t, syntax.hexClose);
+	t = formatString(t, " to ");
+	t = formatString(t, syntax.hex);
+	t = formatHex(t, end - 1, 6);
+	t = formatString(t, syntax.hexClose);
+	*t++ = '\n';
+	outputCommit(t - s);
+	statsRow("Bytes", stats.bytes, 0);
+	statsRow("Instructions", total, 0);
+	statsRow("Invalid", mnemonic[M_NONE] + stats.invalid, total);
+	statsRow("Data", stats.data, 0);
+
+	statsTitle("Mnemonics");
+	for(i = 0; i < M_COUNT; i++) {
+		order[i] = i;
+	}
+	qsort(order, M_COUNT, 1, statsCompare);
+	for(i = 0; i < M_COUNT && mnemonic[order[i]] > 0; i++) {
+		if(order[i] != M_NONE) {
+			statsRow(t_mnemonic[order[i]], mnemonic[order[i]], total);
+		}
+	}
+
+	statsTitle("Prefixes");
+	for(i = 0; i < 4; i++) {
+		statsRow(t_prefix[i], prefix[i], total);
+	}
+
+	statsTitle("Suffixes");
+	for(i = AM_SIS; i <= AM_LIL; i++) {
+		statsRow(t_am[i], stats.suffix[i], total);
+	}
+
+	statsTitle("eZ80 only");
+	for(i = 0; i < (int)sizeof(t_ez80); i++) {
+		ez80 += mnemonic[t_ez80[i]];
+		if(mnemonic[t_ez80[i]] > 0) {
+			statsRow(t_mnemonic[t_ez80[i]], mnemonic[t_ez80[i]], total);
+		}
+	}
+	statsRow("Total", ez80, total);
+
+	statsTitle("Operands");
+	statsRow("Byte", operand[0], total);
+	statsRow("Word (16-bit)", stats.word[0], total);
+	statsRow("Word (24-bit)", stats.word[1], total);
+	statsRow("Displacement", operand[1], total);
+	statsRow("Relative", operand[2], total);
+}
+
+// Order mnemonics by the number of instructions, most first, and then as they are in t_mnemonic
+// Parameters:
+// - a, b: Pointers to the mnemonics (M_*)
+// Returns:
+// - int: Less than, equal to or greater than 0
+//
+static int statsCompare(const void * a, const void * b) {
+	unsigned char	m1 = *(const unsigned char *)a;
+	unsigned char	m2 = *(const unsigned char *)b;
+
+	if(mnemonic[m1] != mnemonic[m2]) {
+		return mnemonic[m1] > mnemonic[m2] ? -1 : 1;
+	}
+	return m1 - m2;
+}
+
+// Write the title of a section of the report out, after a blank line
+// Parameters:
+// - title: The title
+//
+static void statsTitle(const char * title) {
+	outputString("\n");
+	outputString(title);
+	outputString("\n");
+}
+
+// Write a line of the report out: a name, a count, and the count as a percentage of a total
+// Parameters:
+// - name: The name
+// - count: The count
+// - total: The total, or 0 for no percentage
+//
+static void statsRow(const char * name, unsigned long count, unsigned long total) {
+	char *			s = outputReserve(FORMAT_LINE_MAX);
+	char *			t = s;
+	char			digits[24];
+	unsigned long	tenths;
+	int				n;
+
+	t = formatString(t, "  ");
+	t = formatString(t, name);
+	while(t - s < STATS_NAME + 2) {
+		*t++ = ' ';
+	}
+	n = statsNumber(digits, count) - digits;
+	while(n++ < STATS_COUNT) {
+		*t++ = ' ';
+	}
+	t = statsNumber(t, count);
+	if(total > 0) {
+		tenths = (count * 1000 + total / 2) / total;
+		t = formatString(t, tenths < 100 ? "    " : tenths < 1000 ? "   " : "  ");
+		t = statsNumber(t, tenths / 10);
+		*t++ = '.';
+		*t++ = '0' + tenths % 10;
+		*t++ = '%';
+	}
+	*t++ = '\n';
+	outputCommit(t - s);
+}
+
+// Write a number out in decimal
+// Parameters:
+// - t: Pointer to the text buffer
+// - value: The number
+// Returns:
+// - char *: Pointer to the end of the text
+//
+static char * statsNumber(char * t, unsigned long value) {
+	char	digits[24];
+	int		i = 0;
+
+	do {
+		digits[i++] = '0' + value % 10;
+		value /= 10;
+	} while(value > 0);
+	while(i > 0) {
+		*t++ = digits[--i];
+	}
+	return t;
+}
@@ -0,0 +1,33 @@
+/*
+ * Title:			Disassembler - Instruction Mix (host build)
+ * Author:			Dean Belfield
+ * Created:			17/10/2026
+ * Last Updated:	17/10/2026
+ *
+ * Modinfo:
+ */
+
+#ifndef STATS_H
+#define STATS_H
+
+#include "decode.h"
+
+// Counters for the instructions in a range of the image; everything else in the report is
+// worked out from these once the range has been counted
+//
+struct s_stats {
+	unsigned long	entry[T_COUNT * 256];	// Instructions, indexed as t_decode
+	unsigned long	suffix[AM_LIL + 1];		// Instructions with each addressing mode suffix, indexed by AM_*
+	unsigned long	word[2];				// Words fetched: 16-bit [0] and 24-bit [1]
+	unsigned long	invalid;				// Suffixes followed by another suffix
+	unsigned long	data;					// Bytes at the end of the range that aren't a whole instruction
+	unsigned long	bytes;					// Bytes counted
+};
+
+extern struct s_stats	stats;
+
+void	statsOpen(void);
+int		statsInstruction(unsigned char * ptr, long adlMode);
+void	statsWrite(long address, long end);
+
+#endif
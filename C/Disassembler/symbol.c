@@ -0,0 +1,315 @@
+/*
+ * Title:			Disassembler - Symbols (host build)
+ * Author:			Dean Belfield
+ * Created:			17/10/2026
+ * Last Updated:	17/10/2026
+ *
+ * Loads symbols from assembler include files (name EQU value), ZDS II linker maps and simple
+ * symbol files (name = value)
+ *
+ * Modinfo:
+ * 17/10/2026:		Clean with -Wextra
+ * 17/10/2026:		Added symbolPort; an equate below &100 can name an I/O port
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <ctype.h>
+
+#include "symbol.h"
+
+struct s_symbols	symbols;
+
+static int	symbolLine(char * line, int * map);
+static int	symbolAdd(char * name, long address, int port);
+static long	symbolIndex(long address);
+static int	symbolValue(char * s, long * value);
+static int	symbolHex(char * s, long * value);
+static int	symbolCompare(const void * a, const void * b);
+
+// Load a symbol file; the format is worked out line by line, so include files and symbol files
+// can be mixed
+// Parameters:
+// - filename: The file to load
+// Returns:
+// - 1: Loaded OK
+// - 0: Error reading the file
+//
+int symbolLoad(char * filename) {
+	FILE *	file;
+	char *	text;
+	char *	line;
+	char *	e;
+	long	length;
+	int		map = 0;
+	int		ok = 1;
+
+	file = fopen(filename, "rb");
+	if(file == NULL) {
+		return 0;
+	}
+	fseek(file, 0, SEEK_END);
+	length = ftell(file);
+	fseek(file, 0, SEEK_SET);
+	text = length < 0 ? NULL : malloc(length + 1);
+	if(text == NULL || fread(text, 1, length, file) != (size_t)length) {
+		free(text);
+		fclose(file);
+		return 0;
+	}
+	fclose(file);
+	text[length] = '\0';
+
+	for(line = text; ok && *line; line = e) {
+		e = line + strcspn(line, "\r\n");
+		if(*e) {
+			*e++ = '\0';
+		}
+		ok = symbolLine(line, &map);
+	}
+	free(text);
+	return ok;
+}
+
+// Sort the symbols by address, drop all but the first of any that share an address, and build
+// the filter
+//
+void symbolSort(void) {
+	long	i, a, n = 0;
+
+	if(symbols.count == 0) {
+		return;
+	}
+	qsort(symbols.symbol, symbols.count, sizeof(struct s_symbol), symbolCompare);
+	for(i = 0; i < symbols.count; i++) {
+		if(n == 0 || symbols.symbol[i].address != symbols.symbol[n - 1].address) {
+			symbols.symbol[n++] = symbols.symbol[i];
+		}
+	}
+	symbols.count = n;
+	symbols.filter = calloc(SYMBOL_FILTER / 8, 1);
+	if(symbols.filter == NULL) {
+		symbols.count = 0;
+		return;
+	}
+	for(i = 0; i < symbols.count; i++) {
+		a = symbols.symbol[i].address & (SYMBOL_FILTER - 1);
+		symbols.filter[a >> 3] |= 1 << (a & 7);
+	}
+}
+
+// Free the symbol table
+//
+void symbolClose(void) {
+	free(symbols.symbol);
+	free(symbols.names);
+	free(symbols.filter);
+	memset(&symbols, 0, sizeof(symbols));
+}
+
+// Search for the symbol for an address; symbolFind checks the filter first
+// Parameters:
+// - address: The address
+// Returns:
+// - const char *: The name, or NULL if there isn't one
+//
+const char * symbolSearch(long address) {
+	long	i = symbolIndex(address);
+
+	return i < 0 ? NULL : &symbols.names[symbols.symbol[i].name];
+}
+
+// Search for the symbol for an I/O port; only an equate below &100 names one, so ports are kept
+// apart from addresses and the symbols of a linker map
+// Parameters:
+// - port: The port
+// Returns:
+// - const char *: The name, or NULL if there isn't one
+//
+const char * symbolPort(long port) {
+	long	i;
+
+	if(port < 0 || port >= SYMBOL_PORTS || symbolFind(port) == NULL) {
+		return NULL;
+	}
+	i = symbolIndex(port);
+	return i < 0 || !symbols.symbol[i].port ? NULL : &symbols.names[symbols.symbol[i].name];
+}
+
+// Find a symbol in the table with a binary search
+// Parameters:
+// - address: The address
+// Returns:
+// - long: Index of the symbol, or -1 if there isn't one
+//
+static long symbolIndex(long address) {
+	long	lo = 0;
+	long	hi = symbols.count - 1;
+	long	mid;
+
+	while(lo <= hi) {
+		mid = (lo + hi) / 2;
+		if(symbols.symbol[mid].address < address) lo = mid + 1;
+		else if(symbols.symbol[mid].address > address) hi = mid - 1;
+		else return mid;
+	}
+	return -1;
+}
+
+// Parse a line of a symbol file; lines that don't define a symbol are ignored
+// - name EQU value, or name: EQU value
+// - name = value
+// - name address (in the EXTERNAL DEFINITIONS section of a ZDS II linker map, where the
+//   address can have a space prefix such as C:)
+// Parameters:
+// - line: The line, zero terminated
+// - map: Pointer to a flag that is set while in the linker map's symbol section
+// Returns:
+// - 1: OK
+// - 0: Out of memory
+//
+static int symbolLine(char * line, int * map) {
+	char *	token[3];
+	char *	s;
+	long	value;
+	int		count = 0;
+
+	if(strstr(line, "EXTERNAL DEFINITIONS")) {
+		*map = 1;
+		return 1;
+	}
+	if(*map && strstr(line, "DEFINITIONS")) {
+		*map = 0;
+	}
+	s = strchr(line, ';');
+	if(s) {
+		*s = '\0';						// Strip comments
+	}
+	for(s = strtok(line, " \t"); s && count < 3; s = strtok(NULL, " \t")) {
+		token[count++] = s;
+	}
+	if(count < 2 || !(isalpha((unsigned char)*token[0]) || *token[0] == '_' || *token[0] == '.')) {
+		return 1;
+	}
+	s = token[0] + strlen(token[0]) - 1;
+	if(*s == ':') {
+		*s = '\0';
+	}
+	if(count == 3 && (strcmp(token[1], "=") == 0 || strcasecmp(token[1], "EQU") == 0)) {
+		if(symbolValue(token[2], &value)) {
+			return symbolAdd(token[0], value, strcasecmp(token[1], "EQU") == 0 && value >= 0 && value < SYMBOL_PORTS);
+		}
+	}
+	else if(*map) {
+		s = token[1];
+		if(isalpha((unsigned char)s[0]) && s[1] == ':') {
+			s += 2;						// Address space prefix
+		}
+		if(symbolHex(s, &value)) {
+			return symbolAdd(token[0], value, 0);
+		}
+	}
+	return 1;
+}
+
+// Add a symbol to the table
+// Parameters:
+// - name: The name
+// - address: The value
+// - port: Set if it can name an I/O port
+// Returns:
+// - 1: OK
+// - 0: Out of memory
+//
+static int symbolAdd(char * name, long address, int port) {
+	struct s_symbol *	symbol;
+	char *				names;
+	long				max;
+	int					length = strlen(name);
+
+	if(length > SYMBOL_NAME_MAX) {
+		length = SYMBOL_NAME_MAX;
+	}
+	if(symbols.count == symbols.max) {
+		max = symbols.max ? symbols.max * 2 : 1024;
+		symbol = realloc(symbols.symbol, max * sizeof(struct s_symbol));
+		if(symbol == NULL) {
+			return 0;
+		}
+		symbols.symbol = symbol;
+		symbols.max = max;
+	}
+	if(symbols.namesLength + length + 1 > symbols.namesMax) {
+		max = symbols.namesMax ? symbols.namesMax * 2 : 16384;
+		names = realloc(symbols.names, max);
+		if(names == NULL) {
+			return 0;
+		}
+		symbols.names = names;
+		symbols.namesMax = max;
+	}
+	memcpy(&symbols.names[symbols.namesLength], name, length);
+	symbols.symbol[symbols.count].address = address;
+	symbols.symbol[symbols.count].name = symbols.namesLength;
+	symbols.symbol[symbols.count].order = symbols.count;
+	symbols.symbol[symbols.count].port = port;
+	symbols.count++;
+	symbols.namesLength += length;
+	symbols.names[symbols.namesLength++] = '\0';
+	return 1;
+}
+
+// Parse a value in any of the notations used by the assemblers: &FF, $FF, 0xFF, 0FFh or 255
+// Parameters:
+// - s: The value, zero terminated
+// - value: Pointer to the storage for the value
+// Returns:
+// - 1: Parsed OK
+// - 0: Not a number (an expression, for example)
+//
+static int symbolValue(char * s, long * value) {
+	char *	e;
+	int		length = strlen(s);
+
+	if(*s == '&' || *s == '$') {
+		return symbolHex(s + 1, value);
+	}
+	if(s[0] == '0' && (s[1] == 'x' || s[1] == 'X')) {
+		return symbolHex(s + 2, value);
+	}
+	if(length > 1 && (s[length - 1] == 'h' || s[length - 1] == 'H')) {
+		s[length - 1] = '\0';
+		return symbolHex(s, value);
+	}
+	*value = strtol(s, &e, 10);
+	return e != s && *e == '\0';
+}
+
+// Parse a hexadecimal number
+// Parameters:
+// - s: The digits, zero terminated
+// - value: Pointer to the storage for the value
+// Returns:
+// - 1: Parsed OK
+// - 0: Not a hexadecimal number
+//
+static int symbolHex(char * s, long * value) {
+	char *	e;
+
+	*value = strtol(s, &e, 16);
+	return e != s && *e == '\0';
+}
+
+// Order symbols by address, then by the order they were loaded in
+//
+static int symbolCompare(const void * a, const void * b) {
+	const struct s_symbol *	x = a;
+	const struct s_symbol *	y = b;
+
+	if(x->address != y->address) {
+		return x->address < y->address ? -1 : 1;
+	}
+	return x->order < y->order ? -1 : x->order > y->order;
+}
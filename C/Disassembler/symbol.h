@@ -0,0 +1,52 @@
+/*
+ * Title:			Disassembler - Symbols (host build)
+ * Author:			Dean Belfield
+ * Created:			17/10/2026
+ * Last Updated:	17/10/2026
+ *
+ * Modinfo:
+ * 17/10/2026:		Added symbolPort, to name I/O ports from equates below &100
+ */
+
+#ifndef SYMBOL_H
+#define SYMBOL_H
+
+#define SYMBOL_NAME_MAX	32			// Names are truncated to this many characters
+#define SYMBOL_PORTS	0x100		// Equates below this value can also name an I/O port
+#define SYMBOL_FILTER	0x1000000	// Number of bits in the filter; one per address in the eZ80's 24-bit address space
+
+// A symbol
+//
+struct s_symbol {
+	long			address;		// The value of the symbol
+	long			name;			// Offset of the name in the name pool
+	long			order;			// Order the symbols were loaded in; the first of several with the same value is used
+	int				port;			// Set if it is an equate below SYMBOL_PORTS, so can name an I/O port
+};
+
+// The symbol table; symbols are loaded in any order, then sorted by address so that they can
+// be looked up with a binary search
+//
+struct s_symbols {
+	struct s_symbol *	symbol;		// The symbols
+	long				count;		// Number of symbols
+	long				max;		// Space allocated for symbols
+	char *				names;		// The names, each zero terminated
+	long				namesLength;	// Size of the names in bytes
+	long				namesMax;	// Space allocated for names
+	unsigned char *		filter;		// Bit set for the bottom 24 bits of each symbol's address, so most misses don't need a search
+};
+
+extern struct s_symbols	symbols;
+
+int				symbolLoad(char * filename);
+void			symbolSort(void);
+void			symbolClose(void);
+const char *	symbolSearch(long address);
+const char *	symbolPort(long port);
+
+// Find the symbol for an address
+//
+#define symbolFind(a)	(symbols.filter && (symbols.filter[((a) & (SYMBOL_FILTER - 1)) >> 3] & (1 << ((a) & 7))) ? symbolSearch(a) : NULL)
+
+#endif
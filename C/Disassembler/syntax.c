@@ -0,0 +1,190 @@
+/*
+ * Title:			Disassembler - Assembler Syntax
+ * Author:			Dean Belfield
+ * Created:			17/10/2026
+ * Last Updated:	17/10/2026
+ *
+ * Builds the operand text and directives for the listing and for the assembler source syntaxes
+ *
+ * Modinfo:
+ * 17/10/2026:		The addresses in a pointer table (DL) are always written as they are
+ * 17/10/2026:		Clean with -Wextra
+ */
+
+#include <string.h>
+
+#include "decode.h"
+#include "syntax.h"
+
+// A syntax's directives and layout
+//
+struct s_dialect {
+	int				source;			// Set for assembler source
+	int				segment;		// Set if 16-bit words are written with the segment
+	int				hex;			// Default hex style (HEX_*)
+	const char *	assume;			// ADL mode directive, up to the mode
+	const char *	org;			// Origin directive
+	const char *	equ;			// Text between a symbol and its value
+	const char *	column;			// Text before a directive
+	const char *	labelColumn;	// Text before a label
+	unsigned char	amPre;			// Decode flags that put the suffix before the mnemonic
+};
+
+static const struct s_dialect	t_dialect[] = {		// Indexed by SYNTAX_*
+	{ 0, 1, HEX_AMPERSAND,	".ASSUME ADL = ",	"",			"",			"                                ",	"                                ",	D_AMPRE },
+	{ 1, 0, HEX_SUFFIX,		".ASSUME ADL = ",	"ORG ",		": EQU ",	"\t",	"",	0 },
+	{ 1, 0, HEX_DOLLAR,		".ASSUME ADL=",		".ORG ",	": EQU ",	"\t",	"",	0 },
+};
+
+static const char *	t_hexOpen[] = { "&", "$", "0x", "0" };	// Indexed by HEX_*
+static const char *	t_hexClose[] = { "", "", "", "h" };
+
+// The operands fetched from the code, from OP_N on: the text before the value, whether the value
+// is written in hex, and whether it is in brackets
+//
+static const char *			t_fetchOpen[] = { "", "(", "", "(", "", "(IX", "(IY", "IX", "IY" };
+static const unsigned char	t_fetchHex[] = { 1, 1, 1, 1, 1, 0, 0, 0, 0 };
+static const unsigned char	t_fetchBracket[] = { 0, 1, 0, 1, 0, 1, 1, 0, 0 };
+
+static const char	t_digits[] = "0123456789ABCDEF";
+
+struct s_syntax	syntax;
+
+static const char *	syntaxText(char ** p, const char * a, const char * b, const char * c);
+#ifdef HOST_BUILD
+static void			syntaxCanonical(void);
+#endif
+
+// Select the syntax to write instructions in
+// Parameters:
+// - type: SYNTAX_*
+// - hex: HEX_*, or HEX_DEFAULT for the syntax's own style
+// Returns:
+// - 1: OK
+// - 0: Unknown syntax or hex style
+//
+int syntaxSelect(int type, int hex) {
+	const struct s_dialect *	d;
+	const char *				open;
+	const char *				close;
+	char *						p = syntax.pool;
+	char						rst[3];
+	int							i, k;
+
+	if(type < SYNTAX_LISTING || type > SYNTAX_EZ80ASM || hex < HEX_DEFAULT || hex > HEX_SUFFIX) {
+		return 0;
+	}
+	d = &t_dialect[type];
+	if(hex == HEX_DEFAULT) {
+		hex = d->hex;
+	}
+	open = t_hexOpen[hex];
+	close = t_hexClose[hex];
+
+	syntax.type = type;
+	syntax.source = d->source;
+	syntax.segment = d->segment;
+	syntax.hex = open;
+	syntax.hexClose = close;
+	syntax.db = "DB ";
+	syntax.assume = d->assume;
+	syntax.org = d->org;
+	syntax.equ = d->equ;
+	syntax.column = d->column;
+	syntax.labelColumn = d->labelColumn;
+	syntax.amPre = d->amPre;
+
+	for(i = OP_NONE; i < OP_RST00; i++) {
+		syntax.operand[i] = t_operand[i];
+		syntax.close[i] = "";
+	}
+	for(i = OP_RST00; i <= OP_RST38; i++) {
+		rst[0] = t_digits[(i - OP_RST00) >> 1];
+		rst[1] = (i - OP_RST00) & 1 ? '8' : '0';
+		rst[2] = '\0';
+		syntax.operand[i] = syntaxText(&p, open, rst, close);
+		syntax.close[i] = "";
+	}
+	for(i = OP_N; i < OP_COUNT; i++) {
+		k = i - OP_N;
+		syntax.operand[i] = syntaxText(&p, t_fetchOpen[k], t_fetchHex[k] ? open : "", "");
+		syntax.close[i] = syntaxText(&p, t_fetchHex[k] ? close : "", t_fetchBracket[k] ? ")" : "", "");
+		syntax.label[i] = t_fetchBracket[k] ? "(" : "";
+		syntax.labelClose[i] = t_fetchBracket[k] ? ")" : "";
+	}
+#ifdef HOST_BUILD
+	if(syntax.source) {
+		syntaxCanonical();
+	}
+#endif
+	return 1;
+}
+
+// Check whether a decoded instruction can be written as an instruction in the selected syntax.
+// In the listing every instruction can; in source only those that reassemble to the same bytes
+// can, and the rest are written as data
+// Parameters:
+// - opcode: The decoded instruction
+// Returns:
+// - 1: It can
+// - 0: It can't
+//
+int syntaxValid(struct s_opcode * opcode) {
+#ifdef HOST_BUILD
+	const struct s_decode *	d = opcode->decode;
+	unsigned long			i = d - t_decode[0];
+
+	if(!syntax.source || d->mnemonic == M_DL) {
+		return 1;
+	}
+	if(i >= T_COUNT * 256 || !syntax.valid[i]) {
+		return 0;						// Not in the tables (a double suffix), or not the usual encoding
+	}
+	return opcode->addressMode == AM_NONE || (d->flags & (D_AM | D_AMPRE)) != 0;
+#else
+	(void)opcode;
+	return 1;
+#endif
+}
+
+// Concatenate up to three strings into the syntax's pool
+// Parameters:
+// - p: Pointer to the pool pointer
+// - a, b, c: The strings
+// Returns:
+// - const char *: The concatenated string
+//
+static const char * syntaxText(char ** p, const char * a, const char * b, const char * c) {
+	char *	s = *p;
+	char *	t = s;
+
+	while(*a) *t++ = *a++;
+	while(*b) *t++ = *b++;
+	while(*c) *t++ = *c++;
+	*t++ = '\0';
+	*p = t;
+	return s;
+}
+
+#ifdef HOST_BUILD
+// Work out which encodings can be written as instructions in source. Where several encodings
+// decode to the same text (the redundant DD and FD prefixes, the repeated ED opcodes), an
+// assembler only produces the first in table order, so the others are written as data; as are
+// the bytes that aren't instructions, and SLL and IM 0/1, which eZ80 assemblers don't accept
+//
+static void syntaxCanonical(void) {
+	const struct s_decode *	d = t_decode[0];
+	int						i, k;
+
+	for(i = 0; i < T_COUNT * 256; i++) {
+		syntax.valid[i] = !(d[i].flags & (D_PREFIX | D_SUFFIX)) &&
+			d[i].mnemonic != M_NONE && d[i].mnemonic != M_SLL &&
+			d[i].operand1 != OP_IM01;
+		for(k = 0; k < i && syntax.valid[i]; k++) {
+			if(d[k].mnemonic == d[i].mnemonic && d[k].operand1 == d[i].operand1 && d[k].operand2 == d[i].operand2) {
+				syntax.valid[i] = 0;
+			}
+		}
+	}
+}
+#endif
@@ -0,0 +1,58 @@
+/*
+ * Title:			Disassembler - Assembler Syntax
+ * Author:			Dean Belfield
+ * Created:			17/10/2026
+ * Last Updated:	17/10/2026
+ *
+ * Modinfo:
+ */
+
+#ifndef SYNTAX_H
+#define SYNTAX_H
+
+#include "decode.h"
+
+#define SYNTAX_LISTING	0			// The listing: address, opcode bytes, opcode chars and mnemonics
+#define SYNTAX_ZDS		1			// ZDS II assembler source
+#define SYNTAX_EZ80ASM	2			// ez80asm (and sjasmplus style) assembler source
+
+#define HEX_DEFAULT		-1			// The syntax's own style
+#define HEX_AMPERSAND	0			// &FF
+#define HEX_DOLLAR		1			// $FF
+#define HEX_C			2			// 0xFF
+#define HEX_SUFFIX		3			// 0FFh (always with a leading 0)
+
+#define SYNTAX_POOL		1024		// Space for the operand text built for the syntax
+
+// A syntax back end; the text for every operand is built once when the syntax is selected,
+// so that the formatter doesn't need to check the syntax or hex style as it goes
+//
+struct s_syntax {
+	int				type;				// SYNTAX_*
+	int				source;				// Set if the output is assembler source rather than a listing
+	int				segment;			// Set if 16-bit words are written with the segment, as 6 digits
+	const char *	operand[OP_COUNT];	// Operands, indexed by OP_*; for those fetched from the code this is the text before the value
+	const char *	close[OP_COUNT];	// Text after the value of an operand fetched from the code
+	const char *	label[OP_COUNT];	// Text before a label or symbol written in place of a value
+	const char *	labelClose[OP_COUNT];	// Text after a label or symbol
+	const char *	hex;				// Text before a hex byte in a DB
+	const char *	hexClose;			// Text after a hex byte in a DB
+	const char *	db;					// Data directive, with the space after it
+	const char *	assume;				// ADL mode directive, up to the mode
+	const char *	org;				// Origin directive, with the space after it
+	const char *	equ;				// Text between a symbol and its value
+	const char *	column;				// Text before a directive
+	const char *	labelColumn;		// Text before a label
+	unsigned char	amPre;				// Decode flags that put the addressing mode suffix before the mnemonic
+#ifdef HOST_BUILD
+	unsigned char	valid[T_COUNT * 256];	// Set for each encoding that is written as an instruction in source; indexed as t_decode
+#endif
+	char			pool[SYNTAX_POOL];	// Storage for the text built for the syntax
+};
+
+extern struct s_syntax	syntax;
+
+int		syntaxSelect(int type, int hex);
+int		syntaxValid(struct s_opcode * opcode);
+
+#endif
@@ -0,0 +1,2273 @@
+/*
+ * Title:			Disassembler - Decode Tables
+ * Author:			Dean Belfield
+ * Created:			17/10/2026
+ * Last Updated:	17/10/2026
+ *
+ * Based upon information in http://www.z80.info/decoding.htm
+ *
+ * Modinfo:
+ * 17/10/2026:		Fixed INC/DEC SP, the (IX+d) and (IY+d) operands, LEA IY, OUT (C),r and the eZ80 LD I,HL, LD HL,I, LD IX/IY,(HL) and MLT SP
+ * 17/10/2026:		Added DL
+ * 17/10/2026:		Added t_size, so that the length of most instructions is a single lookup
+ * 17/10/2026:		Added the block I/O instructions INIRX, OTIRX, INDRX and OTDRX (ED C2, C3, CA and CB)
+ * 17/10/2026:		Added t_sizePrefixed, so that the length of a prefixed instruction is a single lookup too
+ */
+
+#include "decode.h"
+
+// Mnemonics, indexed by M_*
+//
+const char * t_mnemonic[] = {
+	"", "NOP", "LD", "INC", "DEC", "RLCA", "EX", "ADD",
+	"RRCA", "DJNZ", "RLA", "JR", "RRA", "DAA", "CPL", "SCF",
+	"CCF", "HALT", "ADC", "SUB", "SBC", "AND", "XOR", "OR",
+	"CP", "RET", "POP", "JP", "CALL", "PUSH", "RST", "OUT",
+	"EXX", "IN", "DI", "EI", "RLC", "RRC", "RL", "RR",
+	"SLA", "SRA", "SLL", "SRL", "BIT", "RES", "SET", "IN0",
+	"OUT0", "LEA", "TST", "NEG", "RETN", "IM", "MLT", "RETI",
+	"PEA", "RRD", "LD MB,A", "LD A,MB", "RLD", "TSTIO", "SLP", "STMIX",
+	"RSMIX", "INIM", "OTIM", "INI2", "INDM", "OTDM", "IND2", "INIMR",
+	"OTIMR", "INI2R", "INDMR", "OTDMR", "IND2R", "LDI", "CPI", "INI",
+	"OUTI", "OUTI2", "LDD", "CPD", "IND", "OUTD", "OUTD2", "LDIR",
+	"CPIR", "INIR", "OTIR", "OTI2R", "LDDR", "CPDR", "INDR", "OTDR",
+	"OTD2R", "INIRX", "OTIRX", "INDRX", "OTDRX", "DB", "DL"
+};
+
+// Operands, indexed by OP_*; for those fetched from the code this is the text that precedes the value
+//
+const char * t_operand[] = {
+	"",
+	"B", "C", "D", "E", "H", "L", "A", "I", "R", "IXH", "IXL", "IYH", "IYL",
+	"BC", "DE", "HL", "SP", "AF", "AF'", "IX", "IY",
+	"(BC)", "(DE)", "(HL)", "(SP)", "(IX)", "(IY)", "(C)",
+	"NZ", "Z", "NC", "C", "PO", "PE", "P", "M",
+	"0", "1", "2", "3", "4", "5", "6", "7", "0/1",
+	"&00", "&08", "&10", "&18", "&20", "&28", "&30", "&38",
+	"&", "(&", "&", "(&", "&", "(IX", "(IY", "IX", "IY"
+};
+
+const char * t_am[] = { "", ".SIS", ".LIS", ".SIL", ".LIL" };
+
+// The decode tables, indexed by T_* and then the opcode byte
+//
+const struct s_decode t_decode[T_COUNT][256] = {
+	//
+	// Unprefixed opcodes
+	//
+	{
+		{ M_NOP,		OP_NONE,		OP_NONE,		0				},		// 00: NOP
+		{ M_LD,			OP_BC,			OP_NN,			D_AM			},		// 01: LD BC,nn
+		{ M_LD,			OP_IND_BC,		OP_A,			0				},		// 02: LD (BC),A
+		{ M_INC,		OP_BC,			OP_NONE,		D_AM			},		// 03: INC BC
+		{ M_INC,		OP_B,			OP_NONE,		0				},		// 04: INC B
+		{ M_DEC,		OP_B,			OP_NONE,		0				},		// 05: DEC B
+		{ M_LD,			OP_B,			OP_N,			0				},		// 06: LD B,n
+		{ M_RLCA,		OP_NONE,		OP_NONE,		0				},		// 07: RLCA
+		{ M_EX,			OP_AF,			OP_AF_,			0				},		// 08: EX AF,AF'
+		{ M_ADD,		OP_HL,			OP_BC,			D_AM			},		// 09: ADD HL,BC
+		{ M_LD,			OP_A,			OP_IND_BC,		0				},		// 0A: LD A,(BC)
+		{ M_DEC,		OP_BC,			OP_NONE,		D_AM			},		// 0B: DEC BC
+		{ M_INC,		OP_C,			OP_NONE,		0				},		// 0C: INC C
+		{ M_DEC,		OP_C,			OP_NONE,		0				},		// 0D: DEC C
+		{ M_LD,			OP_C,			OP_N,			0				},		// 0E: LD C,n
+		{ M_RRCA,		OP_NONE,		OP_NONE,		0				},		// 0F: RRCA
+		{ M_DJNZ,		OP_REL,			OP_NONE,		0				},		// 10: DJNZ e
+		{ M_LD,			OP_DE,			OP_NN,			D_AM			},		// 11: LD DE,nn
+		{ M_LD,			OP_IND_DE,		OP_A,			0				},		// 12: LD (DE),A
+		{ M_INC,		OP_DE,			OP_NONE,		D_AM			},		// 13: INC DE
+		{ M_INC,		OP_D,			OP_NONE,		0				},		// 14: INC D
+		{ M_DEC,		OP_D,			OP_NONE,		0				},		// 15: DEC D
+		{ M_LD,			OP_D,			OP_N,			0				},		// 16: LD D,n
+		{ M_RLA,		OP_NONE,		OP_NONE,		0				},		// 17: RLA
+		{ M_JR,			OP_REL,			OP_NONE,		0				},		// 18: JR e
+		{ M_ADD,		OP_HL,			OP_DE,			D_AM			},		// 19: ADD HL,DE
+		{ M_LD,			OP_A,			OP_IND_DE,		0				},		// 1A: LD A,(DE)
+		{ M_DEC,		OP_DE,			OP_NONE,		D_AM			},		// 1B: DEC DE
+		{ M_INC,		OP_E,			OP_NONE,		0				},		// 1C: INC E
+		{ M_DEC,		OP_E,			OP_NONE,		0				},		// 1D: DEC E
+		{ M_LD,			OP_E,			OP_N,			0				},		// 1E: LD E,n
+		{ M_RRA,		OP_NONE,		OP_NONE,		0				},		// 1F: RRA
+		{ M_JR,			OP_CC_NZ,		OP_REL,			0				},		// 20: JR NZ,e
+		{ M_LD,			OP_HL,			OP_NN,			D_AM			},		// 21: LD HL,nn
+		{ M_LD,			OP_INN,			OP_HL,			D_AM			},		// 22: LD (nn),HL
+		{ M_INC,		OP_HL,			OP_NONE,		D_AM			},		// 23: INC HL
+		{ M_INC,		OP_H,			OP_NONE,		0				},		// 24: INC H
+		{ M_DEC,		OP_H,			OP_NONE,		0				},		// 25: DEC H
+		{ M_LD,			OP_H,			OP_N,			0				},		// 26: LD H,n
+		{ M_DAA,		OP_NONE,		OP_NONE,		0				},		// 27: DAA
+		{ M_JR,			OP_CC_Z,		OP_REL,			0				},		// 28: JR Z,e
+		{ M_ADD,		OP_HL,			OP_HL,			D_AM			},		// 29: ADD HL,HL
+		{ M_LD,			OP_HL,			OP_INN,			D_AM			},		// 2A: LD HL,(nn)
+		{ M_DEC,		OP_HL,			OP_NONE,		D_AM			},		// 2B: DEC HL
+		{ M_INC,		OP_L,			OP_NONE,		0				},		// 2C: INC L
+		{ M_DEC,		OP_L,			OP_NONE,		0				},		// 2D: DEC L
+		{ M_LD,			OP_L,			OP_N,			0				},		// 2E: LD L,n
+		{ M_CPL,		OP_NONE,		OP_NONE,		0				},		// 2F: CPL
+		{ M_JR,			OP_CC_NC,		OP_REL,			0				},		// 30: JR NC,e
+		{ M_LD,			OP_SP,			OP_NN,			D_AM			},		// 31: LD SP,nn
+		{ M_LD,			OP_INN,			OP_A,			D_AM			},		// 32: LD (nn),A
+		{ M_INC,		OP_SP,			OP_NONE,		D_AM			},		// 33: INC SP
+		{ M_INC,		OP_IND_HL,		OP_NONE,		0				},		// 34: INC (HL)
+		{ M_DEC,		OP_IND_HL,		OP_NONE,		0				},		// 35: DEC (HL)
+		{ M_LD,			OP_IND_HL,		OP_N,			0				},		// 36: LD (HL),n
+		{ M_SCF,		OP_NONE,		OP_NONE,		0				},		// 37: SCF
+		{ M_JR,			OP_CC_C,		OP_REL,			0				},		// 38: JR C,e
+		{ M_ADD,		OP_HL,			OP_SP,			D_AM			},		// 39: ADD HL,SP
+		{ M_LD,			OP_A,			OP_INN,			D_AM			},		// 3A: LD A,(nn)
+		{ M_DEC,		OP_SP,			OP_NONE,		D_AM			},		// 3B: DEC SP
+		{ M_INC,		OP_A,			OP_NONE,		0				},		// 3C: INC A
+		{ M_DEC,		OP_A,			OP_NONE,		0				},		// 3D: DEC A
+		{ M_LD,			OP_A,			OP_N,			0				},		// 3E: LD A,n
+		{ M_CCF,		OP_NONE,		OP_NONE,		0				},		// 3F: CCF
+		{ M_NONE,		AM_SIS,			OP_NONE,		D_SUFFIX		},		// 40: .SIS suffix
+		{ M_LD,			OP_B,			OP_C,			D_AM			},		// 41: LD B,C
+		{ M_LD,			OP_B,			OP_D,			D_AM			},		// 42: LD B,D
+		{ M_LD,			OP_B,			OP_E,			D_AM			},		// 43: LD B,E
+		{ M_LD,			OP_B,			OP_H,			D_AM			},		// 44: LD B,H
+		{ M_LD,			OP_B,			OP_L,			D_AM			},		// 45: LD B,L
+		{ M_LD,			OP_B,			OP_IND_HL,		D_AM			},		// 46: LD B,(HL)
+		{ M_LD,			OP_B,			OP_A,			D_AM			},		// 47: LD B,A
+		{ M_LD,			OP_C,			OP_B,			D_AM			},		// 48: LD C,B
+		{ M_NONE,		AM_LIS,			OP_NONE,		D_SUFFIX		},		// 49: .LIS suffix
+		{ M_LD,			OP_C,			OP_D,			D_AM			},		// 4A: LD C,D
+		{ M_LD,			OP_C,			OP_E,			D_AM			},		// 4B: LD C,E
+		{ M_LD,			OP_C,			OP_H,			D_AM			},		// 4C: LD C,H
+		{ M_LD,			OP_C,			OP_L,			D_AM			},		// 4D: LD C,L
+		{ M_LD,			OP_C,			OP_IND_HL,		D_AM			},		// 4E: LD C,(HL)
+		{ M_LD,			OP_C,			OP_A,			D_AM			},		// 4F: LD C,A
+		{ M_LD,			OP_D,			OP_B,			D_AM			},		// 50: LD D,B
+		{ M_LD,			OP_D,			OP_C,			D_AM			},		// 51: LD D,C
+		{ M_NONE,		AM_SIL,			OP_NONE,		D_SUFFIX		},		// 52: .SIL suffix
+		{ M_LD,			OP_D,			OP_E,			D_AM			},		// 53: LD D,E
+		{ M_LD,			OP_D,			OP_H,			D_AM			},		// 54: LD D,H
+		{ M_LD,			OP_D,			OP_L,			D_AM			},		// 55: LD D,L
+		{ M_LD,			OP_D,			OP_IND_HL,		D_AM			},		// 56: LD D,(HL)
+		{ M_LD,			OP_D,			OP_A,			D_AM			},		// 57: LD D,A
+		{ M_LD,			OP_E,			OP_B,			D_AM			},		// 58: LD E,B
+		{ M_LD,			OP_E,			OP_C,			D_AM			},		// 59: LD E,C
+		{ M_LD,			OP_E,			OP_D,			D_AM			},		// 5A: LD E,D
+		{ M_NONE,		AM_LIL,			OP_NONE,		D_SUFFIX		},		// 5B: .LIL suffix
+		{ M_LD,			OP_E,			OP_H,			D_AM			},		// 5C: LD E,H
+		{ M_LD,			OP_E,			OP_L,			D_AM			},		// 5D: LD E,L
+		{ M_LD,			OP_E,			OP_IND_HL,		D_AM			},		// 5E: LD E,(HL)
+		{ M_LD,			OP_E,			OP_A,			D_AM			},		// 5F: LD E,A
+		{ M_LD,			OP_H,			OP_B,			D_AM			},		// 60: LD H,B
+		{ M_LD,			OP_H,			OP_C,			D_AM			},		// 61: LD H,C
+		{ M_LD,			OP_H,			OP_D,			D_AM			},		// 62: LD H,D
+		{ M_LD,			OP_H,			OP_E,			D_AM			},		// 63: LD H,E
+		{ M_LD,			OP_H,			OP_H,			D_AM			},		// 64: LD H,H
+		{ M_LD,			OP_H,			OP_L,			D_AM			},		// 65: LD H,L
+		{ M_LD,			OP_H,			OP_IND_HL,		D_AM			},		// 66: LD H,(HL)
+		{ M_LD,			OP_H,			OP_A,			D_AM			},		// 67: LD H,A
+		{ M_LD,			OP_L,			OP_B,			D_AM			},		// 68: LD L,B
+		{ M_LD,			OP_L,			OP_C,			D_AM			},		// 69: LD L,C
+		{ M_LD,			OP_L,			OP_D,			D_AM			},		// 6A: LD L,D
+		{ M_LD,			OP_L,			OP_E,			D_AM			},		// 6B: LD L,E
+		{ M_LD,			OP_L,			OP_H,			D_AM			},		// 6C: LD L,H
+		{ M_LD,			OP_L,			OP_L,			D_AM			},		// 6D: LD L,L
+		{ M_LD,			OP_L,			OP_IND_HL,		D_AM			},		// 6E: LD L,(HL)
+		{ M_LD,			OP_L,			OP_A,			D_AM			},		// 6F: LD L,A
+		{ M_LD,			OP_IND_HL,		OP_B,			D_AM			},		// 70: LD (HL),B
+		{ M_LD,			OP_IND_HL,		OP_C,			D_AM			},		// 71: LD (HL),C
+		{ M_LD,			OP_IND_HL,		OP_D,			D_AM			},		// 72: LD (HL),D
+		{ M_LD,			OP_IND_HL,		OP_E,			D_AM			},		// 73: LD (HL),E
+		{ M_LD,			OP_IND_HL,		OP_H,			D_AM			},		// 74: LD (HL),H
+		{ M_LD,			OP_IND_HL,		OP_L,			D_AM			},		// 75: LD (HL),L
+		{ M_HALT,		OP_NONE,		OP_NONE,		0				},		// 76: HALT
+		{ M_LD,			OP_IND_HL,		OP_A,			D_AM			},		// 77: LD (HL),A
+		{ M_LD,			OP_A,			OP_B,			D_AM			},		// 78: LD A,B
+		{ M_LD,			OP_A,			OP_C,			D_AM			},		// 79: LD A,C
+		{ M_LD,			OP_A,			OP_D,			D_AM			},		// 7A: LD A,D
+		{ M_LD,			OP_A,			OP_E,			D_AM			},		// 7B: LD A,E
+		{ M_LD,			OP_A,			OP_H,			D_AM			},		// 7C: LD A,H
+		{ M_LD,			OP_A,			OP_L,			D_AM			},		// 7D: LD A,L
+		{ M_LD,			OP_A,			OP_IND_HL,		D_AM			},		// 7E: LD A,(HL)
+		{ M_LD,			OP_A,			OP_A,			D_AM			},		// 7F: LD A,A
+		{ M_ADD,		OP_A,			OP_B,			0				},		// 80: ADD A,B
+		{ M_ADD,		OP_A,			OP_C,			0				},		// 81: ADD A,C
+		{ M_ADD,		OP_A,			OP_D,			0				},		// 82: ADD A,D
+		{ M_ADD,		OP_A,			OP_E,			0				},		// 83: ADD A,E
+		{ M_ADD,		OP_A,			OP_H,			0				},		// 84: ADD A,H
+		{ M_ADD,		OP_A,			OP_L,			0				},		// 85: ADD A,L
+		{ M_ADD,		OP_A,			OP_IND_HL,		0				},		// 86: ADD A,(HL)
+		{ M_ADD,		OP_A,			OP_A,			0				},		// 87: ADD A,A
+		{ M_ADC,		OP_A,			OP_B,			0				},		// 88: ADC A,B
+		{ M_ADC,		OP_A,			OP_C,			0				},		// 89: ADC A,C
+		{ M_ADC,		OP_A,			OP_D,			0				},		// 8A: ADC A,D
+		{ M_ADC,		OP_A,			OP_E,			0				},		// 8B: ADC A,E
+		{ M_ADC,		OP_A,			OP_H,			0				},		// 8C: ADC A,H
+		{ M_ADC,		OP_A,			OP_L,			0				},		// 8D: ADC A,L
+		{ M_ADC,		OP_A,			OP_IND_HL,		0				},		// 8E: ADC A,(HL)
+		{ M_ADC,		OP_A,			OP_A,			0				},		// 8F: ADC A,A
+		{ M_SUB,		OP_A,			OP_B,			0				},		// 90: SUB A,B
+		{ M_SUB,		OP_A,			OP_C,			0				},		// 91: SUB A,C
+		{ M_SUB,		OP_A,			OP_D,			0				},		// 92: SUB A,D
+		{ M_SUB,		OP_A,			OP_E,			0				},		// 93: SUB A,E
+		{ M_SUB,		OP_A,			OP_H,			0				},		// 94: SUB A,H
+		{ M_SUB,		OP_A,			OP_L,			0				},		// 95: SUB A,L
+		{ M_SUB,		OP_A,			OP_IND_HL,		0				},		// 96: SUB A,(HL)
+		{ M_SUB,		OP_A,			OP_A,			0				},		// 97: SUB A,A
+		{ M_SBC,		OP_A,			OP_B,			0				},		// 98: SBC A,B
+		{ M_SBC,		OP_A,			OP_C,			0				},		// 99: SBC A,C
+		{ M_SBC,		OP_A,			OP_D,			0				},		// 9A: SBC A,D
+		{ M_SBC,		OP_A,			OP_E,			0				},		// 9B: SBC A,E
+		{ M_SBC,		OP_A,			OP_H,			0				},		// 9C: SBC A,H
+		{ M_SBC,		OP_A,			OP_L,			0				},		// 9D: SBC A,L
+		{ M_SBC,		OP_A,			OP_IND_HL,		0				},		// 9E: SBC A,(HL)
+		{ M_SBC,		OP_A,			OP_A,			0				},		// 9F: SBC A,A
+		{ M_AND,		OP_A,			OP_B,			0				},		// A0: AND A,B
+		{ M_AND,		OP_A,			OP_C,			0				},		// A1: AND A,C
+		{ M_AND,		OP_A,			OP_D,			0				},		// A2: AND A,D
+		{ M_AND,		OP_A,			OP_E,			0				},		// A3: AND A,E
+		{ M_AND,		OP_A,			OP_H,			0				},		// A4: AND A,H
+		{ M_AND,		OP_A,			OP_L,			0				},		// A5: AND A,L
+		{ M_AND,		OP_A,			OP_IND_HL,		0				},		// A6: AND A,(HL)
+		{ M_AND,		OP_A,			OP_A,			0				},		// A7: AND A,A
+		{ M_XOR,		OP_A,			OP_B,			0				},		// A8: XOR A,B
+		{ M_XOR,		OP_A,			OP_C,			0				},		// A9: XOR A,C
+		{ M_XOR,		OP_A,			OP_D,			0				},		// AA: XOR A,D
+		{ M_XOR,		OP_A,			OP_E,			0				},		// AB: XOR A,E
+		{ M_XOR,		OP_A,			OP_H,			0				},		// AC: XOR A,H
+		{ M_XOR,		OP_A,			OP_L,			0				},		// AD: XOR A,L
+		{ M_XOR,		OP_A,			OP_IND_HL,		0				},		// AE: XOR A,(HL)
+		{ M_XOR,		OP_A,			OP_A,			0				},		// AF: XOR A,A
+		{ M_OR,			OP_A,			OP_B,			0				},		// B0: OR A,B
+		{ M_OR,			OP_A,			OP_C,			0				},		// B1: OR A,C
+		{ M_OR,			OP_A,			OP_D,			0				},		// B2: OR A,D
+		{ M_OR,			OP_A,			OP_E,			0				},		// B3: OR A,E
+		{ M_OR,			OP_A,			OP_H,			0				},		// B4: OR A,H
+		{ M_OR,			OP_A,			OP_L,			0				},		// B5: OR A,L
+		{ M_OR,			OP_A,			OP_IND_HL,		0				},		// B6: OR A,(HL)
+		{ M_OR,			OP_A,			OP_A,			0				},		// B7: OR A,A
+		{ M_CP,			OP_A,			OP_B,			0				},		// B8: CP A,B
+		{ M_CP,			OP_A,			OP_C,			0				},		// B9: CP A,C
+		{ M_CP,			OP_A,			OP_D,			0				},		// BA: CP A,D
+		{ M_CP,			OP_A,			OP_E,			0				},		// BB: CP A,E
+		{ M_CP,			OP_A,			OP_H,			0				},		// BC: CP A,H
+		{ M_CP,			OP_A,			OP_L,			0				},		// BD: CP A,L
+		{ M_CP,			OP_A,			OP_IND_HL,		0				},		// BE: CP A,(HL)
+		{ M_CP,			OP_A,			OP_A,			0				},		// BF: CP A,A
+		{ M_RET,		OP_CC_NZ,		OP_NONE,		D_AM			},		// C0: RET NZ
+		{ M_POP,		OP_BC,			OP_NONE,		D_AM			},		// C1: POP BC
+		{ M_JP,			OP_CC_NZ,		OP_NN,			D_AM			},		// C2: JP NZ,nn
+		{ M_JP,			OP_NN,			OP_NONE,		D_AM			},		// C3: JP nn
+		{ M_CALL,		OP_CC_NZ,		OP_NN,			D_AM			},		// C4: CALL NZ,nn
+		{ M_PUSH,		OP_BC,			OP_NONE,		D_AM			},		// C5: PUSH BC
+		{ M_ADD,		OP_A,			OP_N,			0				},		// C6: ADD A,n
+		{ M_RST,		OP_RST00,		OP_NONE,		D_AM			},		// C7: RST &00
+		{ M_RET,		OP_CC_Z,		OP_NONE,		D_AM			},		// C8: RET Z
+		{ M_RET,		OP_NONE,		OP_NONE,		D_AM			},		// C9: RET
+		{ M_JP,			OP_CC_Z,		OP_NN,			D_AM			},		// CA: JP Z,nn
+		{ M_NONE,		T_CB,			OP_NONE,		D_PREFIX		},		// CB: CB prefix
+		{ M_CALL,		OP_CC_Z,		OP_NN,			D_AM			},		// CC: CALL Z,nn
+		{ M_CALL,		OP_NN,			OP_NONE,		D_AM			},		// CD: CALL nn
+		{ M_ADC,		OP_A,			OP_N,			0				},		// CE: ADC A,n
+		{ M_RST,		OP_RST08,		OP_NONE,		D_AM			},		// CF: RST &08
+		{ M_RET,		OP_CC_NC,		OP_NONE,		D_AM			},		// D0: RET NC
+		{ M_POP,		OP_DE,			OP_NONE,		D_AM			},		// D1: POP DE
+		{ M_JP,			OP_CC_NC,		OP_NN,			D_AM			},		// D2: JP NC,nn
+		{ M_OUT,		OP_PORT,		OP_A,			0				},		// D3: OUT (n),A
+		{ M_CALL,		OP_CC_NC,		OP_NN,			D_AM			},		// D4: CALL NC,nn
+		{ M_PUSH,		OP_DE,			OP_NONE,		D_AM			},		// D5: PUSH DE
+		{ M_SUB,		OP_A,			OP_N,			0				},		// D6: SUB A,n
+		{ M_RST,		OP_RST10,		OP_NONE,		D_AM			},		// D7: RST &10
+		{ M_RET,		OP_CC_C,		OP_NONE,		D_AM			},		// D8: RET C
+		{ M_EXX,		OP_NONE,		OP_NONE,		0				},		// D9: EXX
+		{ M_JP,			OP_CC_C,		OP_NN,			D_AM			},		// DA: JP C,nn
+		{ M_IN,			OP_PORT,		OP_A,			0				},		// DB: IN (n),A
+		{ M_CALL,		OP_CC_C,		OP_NN,			D_AM			},		// DC: CALL C,nn
+		{ M_NONE,		T_DD,			OP_NONE,		D_PREFIX		},		// DD: DD prefix
+		{ M_SBC,		OP_A,			OP_N,			0				},		// DE: SBC A,n
+		{ M_RST,		OP_RST18,		OP_NONE,		D_AM			},		// DF: RST &18
+		{ M_RET,		OP_CC_PO,		OP_NONE,		D_AM			},		// E0: RET PO
+		{ M_POP,		OP_HL,			OP_NONE,		D_AM			},		// E1: POP HL
+		{ M_JP,			OP_CC_PO,		OP_NN,			D_AM			},		// E2: JP PO,nn
+		{ M_EX,			OP_IND_SP,		OP_HL,			0				},		// E3: EX (SP),HL
+		{ M_CALL,		OP_CC_PO,		OP_NN,			D_AM			},		// E4: CALL PO,nn
+		{ M_PUSH,		OP_HL,			OP_NONE,		D_AM			},		// E5: PUSH HL
+		{ M_AND,		OP_A,			OP_N,			0				},		// E6: AND A,n
+		{ M_RST,		OP_RST20,		OP_NONE,		D_AM			},		// E7: RST &20
+		{ M_RET,		OP_CC_PE,		OP_NONE,		D_AM			},		// E8: RET PE
+		{ M_JP,			OP_IND_HL,		OP_NONE,		D_AM			},		// E9: JP (HL)
+		{ M_JP,			OP_CC_PE,		OP_NN,			D_AM			},		// EA: JP PE,nn
+		{ M_EX,			OP_DE,			OP_HL,			0				},		// EB: EX DE,HL
+		{ M_CALL,		OP_CC_PE,		OP_NN,			D_AM			},		// EC: CALL PE,nn
+		{ M_NONE,		T_ED,			OP_NONE,		D_PREFIX		},		// ED: ED prefix
+		{ M_XOR,		OP_A,			OP_N,			0				},		// EE: XOR A,n
+		{ M_RST,		OP_RST28,		OP_NONE,		D_AM			},		// EF: RST &28
+		{ M_RET,		OP_CC_P,		OP_NONE,		D_AM			},		// F0: RET P
+		{ M_POP,		OP_AF,			OP_NONE,		D_AM			},		// F1: POP AF
+		{ M_JP,			OP_CC_P,		OP_NN,			D_AM			},		// F2: JP P,nn
+		{ M_DI,			OP_NONE,		OP_NONE,		0				},		// F3: DI
+		{ M_CALL,		OP_CC_P,		OP_NN,			D_AM			},		// F4: CALL P,nn
+		{ M_PUSH,		OP_AF,			OP_NONE,		D_AM			},		// F5: PUSH AF
+		{ M_OR,			OP_A,			OP_N,			0				},		// F6: OR A,n
+		{ M_RST,		OP_RST30,		OP_NONE,		D_AM			},		// F7: RST &30
+		{ M_RET,		OP_CC_M,		OP_NONE,		D_AM			},		// F8: RET M
+		{ M_LD,			OP_SP,			OP_HL,			D_AM			},		// F9: LD SP,HL
+		{ M_JP,			OP_CC_M,		OP_NN,			D_AM			},		// FA: JP M,nn
+		{ M_EI,			OP_NONE,		OP_NONE,		0				},		// FB: EI
+		{ M_CALL,		OP_CC_M,		OP_NN,			D_AM			},		// FC: CALL M,nn
+		{ M_NONE,		T_FD,			OP_NONE,		D_PREFIX		},		// FD: FD prefix
+		{ M_CP,			OP_A,			OP_N,			0				},		// FE: CP A,n
+		{ M_RST,		OP_RST38,		OP_NONE,		D_AM			} 		// FF: RST &38
+	},
+	//
+	// CB prefixed opcodes (rotates, shifts and bit operations)
+	//
+	{
+		{ M_RLC,		OP_B,			OP_NONE,		0				},		// 00: RLC B
+		{ M_RLC,		OP_C,			OP_NONE,		0				},		// 01: RLC C
+		{ M_RLC,		OP_D,			OP_NONE,		0				},		// 02: RLC D
+		{ M_RLC,		OP_E,			OP_NONE,		0				},		// 03: RLC E
+		{ M_RLC,		OP_H,			OP_NONE,		0				},		// 04: RLC H
+		{ M_RLC,		OP_L,			OP_NONE,		0				},		// 05: RLC L
+		{ M_RLC,		OP_IND_HL,		OP_NONE,		0				},		// 06: RLC (HL)
+		{ M_RLC,		OP_A,			OP_NONE,		0				},		// 07: RLC A
+		{ M_RRC,		OP_B,			OP_NONE,		0				},		// 08: RRC B
+		{ M_RRC,		OP_C,			OP_NONE,		0				},		// 09: RRC C
+		{ M_RRC,		OP_D,			OP_NONE,		0				},		// 0A: RRC D
+		{ M_RRC,		OP_E,			OP_NONE,		0				},		// 0B: RRC E
+		{ M_RRC,		OP_H,			OP_NONE,		0				},		// 0C: RRC H
+		{ M_RRC,		OP_L,			OP_NONE,		0				},		// 0D: RRC L
+		{ M_RRC,		OP_IND_HL,		OP_NONE,		0				},		// 0E: RRC (HL)
+		{ M_RRC,		OP_A,			OP_NONE,		0				},		// 0F: RRC A
+		{ M_RL,			OP_B,			OP_NONE,		0				},		// 10: RL B
+		{ M_RL,			OP_C,			OP_NONE,		0				},		// 11: RL C
+		{ M_RL,			OP_D,			OP_NONE,		0				},		// 12: RL D
+		{ M_RL,			OP_E,			OP_NONE,		0				},		// 13: RL E
+		{ M_RL,			OP_H,			OP_NONE,		0				},		// 14: RL H
+		{ M_RL,			OP_L,			OP_NONE,		0				},		// 15: RL L
+		{ M_RL,			OP_IND_HL,		OP_NONE,		0				},		// 16: RL (HL)
+		{ M_RL,			OP_A,			OP_NONE,		0				},		// 17: RL A
+		{ M_RR,			OP_B,			OP_NONE,		0				},		// 18: RR B
+		{ M_RR,			OP_C,			OP_NONE,		0				},		// 19: RR C
+		{ M_RR,			OP_D,			OP_NONE,		0				},		// 1A: RR D
+		{ M_RR,			OP_E,			OP_NONE,		0				},		// 1B: RR E
+		{ M_RR,			OP_H,			OP_NONE,		0				},		// 1C: RR H
+		{ M_RR,			OP_L,			OP_NONE,		0				},		// 1D: RR L
+		{ M_RR,			OP_IND_HL,		OP_NONE,		0				},		// 1E: RR (HL)
+		{ M_RR,			OP_A,			OP_NONE,		0				},		// 1F: RR A
+		{ M_SLA,		OP_B,			OP_NONE,		0				},		// 20: SLA B
+		{ M_SLA,		OP_C,			OP_NONE,		0				},		// 21: SLA C
+		{ M_SLA,		OP_D,			OP_NONE,		0				},		// 22: SLA D
+		{ M_SLA,		OP_E,			OP_NONE,		0				},		// 23: SLA E
+		{ M_SLA,		OP_H,			OP_NONE,		0				},		// 24: SLA H
+		{ M_SLA,		OP_L,			OP_NONE,		0				},		// 25: SLA L
+		{ M_SLA,		OP_IND_HL,		OP_NONE,		0				},		// 26: SLA (HL)
+		{ M_SLA,		OP_A,			OP_NONE,		0				},		// 27: SLA A
+		{ M_SRA,		OP_B,			OP_NONE,		0				},		// 28: SRA B
+		{ M_SRA,		OP_C,			OP_NONE,		0				},		// 29: SRA C
+		{ M_SRA,		OP_D,			OP_NONE,		0				},		// 2A: SRA D
+		{ M_SRA,		OP_E,			OP_NONE,		0				},		// 2B: SRA E
+		{ M_SRA,		OP_H,			OP_NONE,		0				},		// 2C: SRA H
+		{ M_SRA,		OP_L,			OP_NONE,		0				},		// 2D: SRA L
+		{ M_SRA,		OP_IND_HL,		OP_NONE,		0				},		// 2E: SRA (HL)
+		{ M_SRA,		OP_A,			OP_NONE,		0				},		// 2F: SRA A
+		{ M_SLL,		OP_B,			OP_NONE,		0				},		// 30: SLL B
+		{ M_SLL,		OP_C,			OP_NONE,		0				},		// 31: SLL C
+		{ M_SLL,		OP_D,			OP_NONE,		0				},		// 32: SLL D
+		{ M_SLL,		OP_E,			OP_NONE,		0				},		// 33: SLL E
+		{ M_SLL,		OP_H,			OP_NONE,		0				},		// 34: SLL H
+		{ M_SLL,		OP_L,			OP_NONE,		0				},		// 35: SLL L
+		{ M_SLL,		OP_IND_HL,		OP_NONE,		0				},		// 36: SLL (HL)
+		{ M_SLL,		OP_A,			OP_NONE,		0				},		// 37: SLL A
+		{ M_SRL,		OP_B,			OP_NONE,		0				},		// 38: SRL B
+		{ M_SRL,		OP_C,			OP_NONE,		0				},		// 39: SRL C
+		{ M_SRL,		OP_D,			OP_NONE,		0				},		// 3A: SRL D
+		{ M_SRL,		OP_E,			OP_NONE,		0				},		// 3B: SRL E
+		{ M_SRL,		OP_H,			OP_NONE,		0				},		// 3C: SRL H
+		{ M_SRL,		OP_L,			OP_NONE,		0				},		// 3D: SRL L
+		{ M_SRL,		OP_IND_HL,		OP_NONE,		0				},		// 3E: SRL (HL)
+		{ M_SRL,		OP_A,			OP_NONE,		0				},		// 3F: SRL A
+		{ M_BIT,		OP_0,			OP_B,			0				},		// 40: BIT 0,B
+		{ M_BIT,		OP_0,			OP_C,			0				},		// 41: BIT 0,C
+		{ M_BIT,		OP_0,			OP_D,			0				},		// 42: BIT 0,D
+		{ M_BIT,		OP_0,			OP_E,			0				},		// 43: BIT 0,E
+		{ M_BIT,		OP_0,			OP_H,			0				},		// 44: BIT 0,H
+		{ M_BIT,		OP_0,			OP_L,			0				},		// 45: BIT 0,L
+		{ M_BIT,		OP_0,			OP_IND_HL,		0				},		// 46: BIT 0,(HL)
+		{ M_BIT,		OP_0,			OP_A,			0				},		// 47: BIT 0,A
+		{ M_BIT,		OP_1,			OP_B,			0				},		// 48: BIT 1,B
+		{ M_BIT,		OP_1,			OP_C,			0				},		// 49: BIT 1,C
+		{ M_BIT,		OP_1,			OP_D,			0				},		// 4A: BIT 1,D
+		{ M_BIT,		OP_1,			OP_E,			0				},		// 4B: BIT 1,E
+		{ M_BIT,		OP_1,			OP_H,			0				},		// 4C: BIT 1,H
+		{ M_BIT,		OP_1,			OP_L,			0				},		// 4D: BIT 1,L
+		{ M_BIT,		OP_1,			OP_IND_HL,		0				},		// 4E: BIT 1,(HL)
+		{ M_BIT,		OP_1,			OP_A,			0				},		// 4F: BIT 1,A
+		{ M_BIT,		OP_2,			OP_B,			0				},		// 50: BIT 2,B
+		{ M_BIT,		OP_2,			OP_C,			0				},		// 51: BIT 2,C
+		{ M_BIT,		OP_2,			OP_D,			0				},		// 52: BIT 2,D
+		{ M_BIT,		OP_2,			OP_E,			0				},		// 53: BIT 2,E
+		{ M_BIT,		OP_2,			OP_H,			0				},		// 54: BIT 2,H
+		{ M_BIT,		OP_2,			OP_L,			0				},		// 55: BIT 2,L
+		{ M_BIT,		OP_2,			OP_IND_HL,		0				},		// 56: BIT 2,(HL)
+		{ M_BIT,		OP_2,			OP_A,			0				},		// 57: BIT 2,A
+		{ M_BIT,		OP_3,			OP_B,			0				},		// 58: BIT 3,B
+		{ M_BIT,		OP_3,			OP_C,			0				},		// 59: BIT 3,C
+		{ M_BIT,		OP_3,			OP_D,			0				},		// 5A: BIT 3,D
+		{ M_BIT,		OP_3,			OP_E,			0				},		// 5B: BIT 3,E
+		{ M_BIT,		OP_3,			OP_H,			0				},		// 5C: BIT 3,H
+		{ M_BIT,		OP_3,			OP_L,			0				},		// 5D: BIT 3,L
+		{ M_BIT,		OP_3,			OP_IND_HL,		0				},		// 5E: BIT 3,(HL)
+		{ M_BIT,		OP_3,			OP_A,			0				},		// 5F: BIT 3,A
+		{ M_BIT,		OP_4,			OP_B,			0				},		// 60: BIT 4,B
+		{ M_BIT,		OP_4,			OP_C,			0				},		// 61: BIT 4,C
+		{ M_BIT,		OP_4,			OP_D,			0				},		// 62: BIT 4,D
+		{ M_BIT,		OP_4,			OP_E,			0				},		// 63: BIT 4,E
+		{ M_BIT,		OP_4,			OP_H,			0				},		// 64: BIT 4,H
+		{ M_BIT,		OP_4,			OP_L,			0				},		// 65: BIT 4,L
+		{ M_BIT,		OP_4,			OP_IND_HL,		0				},		// 66: BIT 4,(HL)
+		{ M_BIT,		OP_4,			OP_A,			0				},		// 67: BIT 4,A
+		{ M_BIT,		OP_5,			OP_B,			0				},		// 68: BIT 5,B
+		{ M_BIT,		OP_5,			OP_C,			0				},		// 69: BIT 5,C
+		{ M_BIT,		OP_5,			OP_D,			0				},		// 6A: BIT 5,D
+		{ M_BIT,		OP_5,			OP_E,			0				},		// 6B: BIT 5,E
+		{ M_BIT,		OP_5,			OP_H,			0				},		// 6C: BIT 5,H
+		{ M_BIT,		OP_5,			OP_L,			0				},		// 6D: BIT 5,L
+		{ M_BIT,		OP_5,			OP_IND_HL,		0				},		// 6E: BIT 5,(HL)
+		{ M_BIT,		OP_5,			OP_A,			0				},		// 6F: BIT 5,A
+		{ M_BIT,		OP_6,			OP_B,			0				},		// 70: BIT 6,B
+		{ M_BIT,		OP_6,			OP_C,			0				},		// 71: BIT 6,C
+		{ M_BIT,		OP_6,			OP_D,			0				},		// 72: BIT 6,D
+		{ M_BIT,		OP_6,			OP_E,			0				},		// 73: BIT 6,E
+		{ M_BIT,		OP_6,			OP_H,			0				},		// 74: BIT 6,H
+		{ M_BIT,		OP_6,			OP_L,			0				},		// 75: BIT 6,L
+		{ M_BIT,		OP_6,			OP_IND_HL,		0				},		// 76: BIT 6,(HL)
+		{ M_BIT,		OP_6,			OP_A,			0				},		// 77: BIT 6,A
+		{ M_BIT,		OP_7,			OP_B,			0				},		// 78: BIT 7,B
+		{ M_BIT,		OP_7,			OP_C,			0				},		// 79: BIT 7,C
+		{ M_BIT,		OP_7,			OP_D,			0				},		// 7A: BIT 7,D
+		{ M_BIT,		OP_7,			OP_E,			0				},		// 7B: BIT 7,E
+		{ M_BIT,		OP_7,			OP_H,			0				},		// 7C: BIT 7,H
+		{ M_BIT,		OP_7,			OP_L,			0				},		// 7D: BIT 7,L
+		{ M_BIT,		OP_7,			OP_IND_HL,		0				},		// 7E: BIT 7,(HL)
+		{ M_BIT,		OP_7,			OP_A,			0				},		// 7F: BIT 7,A
+		{ M_RES,		OP_0,			OP_B,			0				},		// 80: RES 0,B
+		{ M_RES,		OP_0,			OP_C,			0				},		// 81: RES 0,C
+		{ M_RES,		OP_0,			OP_D,			0				},		// 82: RES 0,D
+		{ M_RES,		OP_0,			OP_E,			0				},		// 83: RES 0,E
+		{ M_RES,		OP_0,			OP_H,			0				},		// 84: RES 0,H
+		{ M_RES,		OP_0,			OP_L,			0				},		// 85: RES 0,L
+		{ M_RES,		OP_0,			OP_IND_HL,		0				},		// 86: RES 0,(HL)
+		{ M_RES,		OP_0,			OP_A,			0				},		// 87: RES 0,A
+		{ M_RES,		OP_1,			OP_B,			0				},		// 88: RES 1,B
+		{ M_RES,		OP_1,			OP_C,			0				},		// 89: RES 1,C
+		{ M_RES,		OP_1,			OP_D,			0				},		// 8A: RES 1,D
+		{ M_RES,		OP_1,			OP_E,			0				},		// 8B: RES 1,E
+		{ M_RES,		OP_1,			OP_H,			0				},		// 8C: RES 1,H
+		{ M_RES,		OP_1,			OP_L,			0				},		// 8D: RES 1,L
+		{ M_RES,		OP_1,			OP_IND_HL,		0				},		// 8E: RES 1,(HL)
+		{ M_RES,		OP_1,			OP_A,			0				},		// 8F: RES 1,A
+		{ M_RES,		OP_2,			OP_B,			0				},		// 90: RES 2,B
+		{ M_RES,		OP_2,			OP_C,			0				},		// 91: RES 2,C
+		{ M_RES,		OP_2,			OP_D,			0				},		// 92: RES 2,D
+		{ M_RES,		OP_2,			OP_E,			0				},		// 93: RES 2,E
+		{ M_RES,		OP_2,			OP_H,			0				},		// 94: RES 2,H
+		{ M_RES,		OP_2,			OP_L,			0				},		// 95: RES 2,L
+		{ M_RES,		OP_2,			OP_IND_HL,		0				},		// 96: RES 2,(HL)
+		{ M_RES,		OP_2,			OP_A,			0				},		// 97: RES 2,A
+		{ M_RES,		OP_3,			OP_B,			0				},		// 98: RES 3,B
+		{ M_RES,		OP_3,			OP_C,			0				},		// 99: RES 3,C
+		{ M_RES,		OP_3,			OP_D,			0				},		// 9A: RES 3,D
+		{ M_RES,		OP_3,			OP_E,			0				},		// 9B: RES 3,E
+		{ M_RES,		OP_3,			OP_H,			0				},		// 9C: RES 3,H
+		{ M_RES,		OP_3,			OP_L,			0				},		// 9D: RES 3,L
+		{ M_RES,		OP_3,			OP_IND_HL,		0				},		// 9E: RES 3,(HL)
+		{ M_RES,		OP_3,			OP_A,			0				},		// 9F: RES 3,A
+		{ M_RES,		OP_4,			OP_B,			0				},		// A0: RES 4,B
+		{ M_RES,		OP_4,			OP_C,			0				},		// A1: RES 4,C
+		{ M_RES,		OP_4,			OP_D,			0				},		// A2: RES 4,D
+		{ M_RES,		OP_4,			OP_E,			0				},		// A3: RES 4,E
+		{ M_RES,		OP_4,			OP_H,			0				},		// A4: RES 4,H
+		{ M_RES,		OP_4,			OP_L,			0				},		// A5: RES 4,L
+		{ M_RES,		OP_4,			OP_IND_HL,		0				},		// A6: RES 4,(HL)
+		{ M_RES,		OP_4,			OP_A,			0				},		// A7: RES 4,A
+		{ M_RES,		OP_5,			OP_B,			0				},		// A8: RES 5,B
+		{ M_RES,		OP_5,			OP_C,			0				},		// A9: RES 5,C
+		{ M_RES,		OP_5,			OP_D,			0				},		// AA: RES 5,D
+		{ M_RES,		OP_5,			OP_E,			0				},		// AB: RES 5,E
+		{ M_RES,		OP_5,			OP_H,			0				},		// AC: RES 5,H
+		{ M_RES,		OP_5,			OP_L,			0				},		// AD: RES 5,L
+		{ M_RES,		OP_5,			OP_IND_HL,		0				},		// AE: RES 5,(HL)
+		{ M_RES,		OP_5,			OP_A,			0				},		// AF: RES 5,A
+		{ M_RES,		OP_6,			OP_B,			0				},		// B0: RES 6,B
+		{ M_RES,		OP_6,			OP_C,			0				},		// B1: RES 6,C
+		{ M_RES,		OP_6,			OP_D,			0				},		// B2: RES 6,D
+		{ M_RES,		OP_6,			OP_E,			0				},		// B3: RES 6,E
+		{ M_RES,		OP_6,			OP_H,			0				},		// B4: RES 6,H
+		{ M_RES,		OP_6,			OP_L,			0				},		// B5: RES 6,L
+		{ M_RES,		OP_6,			OP_IND_HL,		0				},		// B6: RES 6,(HL)
+		{ M_RES,		OP_6,			OP_A,			0				},		// B7: RES 6,A
+		{ M_RES,		OP_7,			OP_B,			0				},		// B8: RES 7,B
+		{ M_RES,		OP_7,			OP_C,			0				},		// B9: RES 7,C
+		{ M_RES,		OP_7,			OP_D,			0				},		// BA: RES 7,D
+		{ M_RES,		OP_7,			OP_E,			0				},		// BB: RES 7,E
+		{ M_RES,		OP_7,			OP_H,			0				},		// BC: RES 7,H
+		{ M_RES,		OP_7,			OP_L,			0				},		// BD: RES 7,L
+		{ M_RES,		OP_7,			OP_IND_HL,		0				},		// BE: RES 7,(HL)
+		{ M_RES,		OP_7,			OP_A,			0				},		// BF: RES 7,A
+		{ M_SET,		OP_0,			OP_B,			0				},		// C0: SET 0,B
+		{ M_SET,		OP_0,			OP_C,			0				},		// C1: SET 0,C
+		{ M_SET,		OP_0,			OP_D,			0				},		// C2: SET 0,D
+		{ M_SET,		OP_0,			OP_E,			0				},		// C3: SET 0,E
+		{ M_SET,		OP_0,			OP_H,			0				},		// C4: SET 0,H
+		{ M_SET,		OP_0,			OP_L,			0				},		// C5: SET 0,L
+		{ M_SET,		OP_0,			OP_IND_HL,		0				},		// C6: SET 0,(HL)
+		{ M_SET,		OP_0,			OP_A,			0				},		// C7: SET 0,A
+		{ M_SET,		OP_1,			OP_B,			0				},		// C8: SET 1,B
+		{ M_SET,		OP_1,			OP_C,			0				},		// C9: SET 1,C
+		{ M_SET,		OP_1,			OP_D,			0				},		// CA: SET 1,D
+		{ M_SET,		OP_1,			OP_E,			0				},		// CB: SET 1,E
+		{ M_SET,		OP_1,			OP_H,			0				},		// CC: SET 1,H
+		{ M_SET,		OP_1,			OP_L,			0				},		// CD: SET 1,L
+		{ M_SET,		OP_1,			OP_IND_HL,		0				},		// CE: SET 1,(HL)
+		{ M_SET,		OP_1,			OP_A,			0				},		// CF: SET 1,A
+		{ M_SET,		OP_2,			OP_B,			0				},		// D0: SET 2,B
+		{ M_SET,		OP_2,			OP_C,			0				},		// D1: SET 2,C
+		{ M_SET,		OP_2,			OP_D,			0				},		// D2: SET 2,D
+		{ M_SET,		OP_2,			OP_E,			0				},		// D3: SET 2,E
+		{ M_SET,		OP_2,			OP_H,			0				},		// D4: SET 2,H
+		{ M_SET,		OP_2,			OP_L,			0				},		// D5: SET 2,L
+		{ M_SET,		OP_2,			OP_IND_HL,		0				},		// D6: SET 2,(HL)
+		{ M_SET,		OP_2,			OP_A,			0				},		// D7: SET 2,A
+		{ M_SET,		OP_3,			OP_B,			0				},		// D8: SET 3,B
+		{ M_SET,		OP_3,			OP_C,			0				},		// D9: SET 3,C
+		{ M_SET,		OP_3,			OP_D,			0				},		// DA: SET 3,D
+		{ M_SET,		OP_3,			OP_E,			0				},		// DB: SET 3,E
+		{ M_SET,		OP_3,			OP_H,			0				},		// DC: SET 3,H
+		{ M_SET,		OP_3,			OP_L,			0				},		// DD: SET 3,L
+		{ M_SET,		OP_3,			OP_IND_HL,		0				},		// DE: SET 3,(HL)
+		{ M_SET,		OP_3,			OP_A,			0				},		// DF: SET 3,A
+		{ M_SET,		OP_4,			OP_B,			0				},		// E0: SET 4,B
+		{ M_SET,		OP_4,			OP_C,			0				},		// E1: SET 4,C
+		{ M_SET,		OP_4,			OP_D,			0				},		// E2: SET 4,D
+		{ M_SET,		OP_4,			OP_E,			0				},		// E3: SET 4,E
+		{ M_SET,		OP_4,			OP_H,			0				},		// E4: SET 4,H
+		{ M_SET,		OP_4,			OP_L,			0				},		// E5: SET 4,L
+		{ M_SET,		OP_4,			OP_IND_HL,		0				},		// E6: SET 4,(HL)
+		{ M_SET,		OP_4,			OP_A,			0				},		// E7: SET 4,A
+		{ M_SET,		OP_5,			OP_B,			0				},		// E8: SET 5,B
+		{ M_SET,		OP_5,			OP_C,			0				},		// E9: SET 5,C
+		{ M_SET,		OP_5,			OP_D,			0				},		// EA: SET 5,D
+		{ M_SET,		OP_5,			OP_E,			0				},		// EB: SET 5,E
+		{ M_SET,		OP_5,			OP_H,			0				},		// EC: SET 5,H
+		{ M_SET,		OP_5,			OP_L,			0				},		// ED: SET 5,L
+		{ M_SET,		OP_5,			OP_IND_HL,		0				},		// EE: SET 5,(HL)
+		{ M_SET,		OP_5,			OP_A,			0				},		// EF: SET 5,A
+		{ M_SET,		OP_6,			OP_B,			0				},		// F0: SET 6,B
+		{ M_SET,		OP_6,			OP_C,			0				},		// F1: SET 6,C
+		{ M_SET,		OP_6,			OP_D,			0				},		// F2: SET 6,D
+		{ M_SET,		OP_6,			OP_E,			0				},		// F3: SET 6,E
+		{ M_SET,		OP_6,			OP_H,			0				},		// F4: SET 6,H
+		{ M_SET,		OP_6,			OP_L,			0				},		// F5: SET 6,L
+		{ M_SET,		OP_6,			OP_IND_HL,		0				},		// F6: SET 6,(HL)
+		{ M_SET,		OP_6,			OP_A,			0				},		// F7: SET 6,A
+		{ M_SET,		OP_7,			OP_B,			0				},		// F8: SET 7,B
+		{ M_SET,		OP_7,			OP_C,			0				},		// F9: SET 7,C
+		{ M_SET,		OP_7,			OP_D,			0				},		// FA: SET 7,D
+		{ M_SET,		OP_7,			OP_E,			0				},		// FB: SET 7,E
+		{ M_SET,		OP_7,			OP_H,			0				},		// FC: SET 7,H
+		{ M_SET,		OP_7,			OP_L,			0				},		// FD: SET 7,L
+		{ M_SET,		OP_7,			OP_IND_HL,		0				},		// FE: SET 7,(HL)
+		{ M_SET,		OP_7,			OP_A,			0				} 		// FF: SET 7,A
+	},
+	//
+	// ED prefixed opcodes (miscellaneous and eZ80 extensions)
+	//
+	{
+		{ M_IN0,		OP_B,			OP_PORT,		0				},		// 00: IN0 B,(n)
+		{ M_OUT0,		OP_PORT,		OP_B,			0				},		// 01: OUT0 (n),B
+		{ M_LEA,		OP_BC,			OP_IXO,			0				},		// 02: LEA BC,IX+d
+		{ M_LEA,		OP_BC,			OP_IYO,			0				},		// 03: LEA BC,IY+d
+		{ M_TST,		OP_A,			OP_B,			0				},		// 04: TST A,B
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 05: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 06: -
+		{ M_LD,			OP_BC,			OP_IND_HL,		0				},		// 07: LD BC,(HL)
+		{ M_IN0,		OP_C,			OP_PORT,		0				},		// 08: IN0 C,(n)
+		{ M_OUT0,		OP_PORT,		OP_C,			0				},		// 09: OUT0 (n),C
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 0A: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 0B: -
+		{ M_TST,		OP_A,			OP_C,			0				},		// 0C: TST A,C
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 0D: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 0E: -
+		{ M_LD,			OP_IND_HL,		OP_BC,			0				},		// 0F: LD (HL),BC
+		{ M_IN0,		OP_D,			OP_PORT,		0				},		// 10: IN0 D,(n)
+		{ M_OUT0,		OP_PORT,		OP_D,			0				},		// 11: OUT0 (n),D
+		{ M_LEA,		OP_DE,			OP_IXO,			0				},		// 12: LEA DE,IX+d
+		{ M_LEA,		OP_DE,			OP_IYO,			0				},		// 13: LEA DE,IY+d
+		{ M_TST,		OP_A,			OP_D,			0				},		// 14: TST A,D
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 15: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 16: -
+		{ M_LD,			OP_DE,			OP_IND_HL,		0				},		// 17: LD DE,(HL)
+		{ M_IN0,		OP_E,			OP_PORT,		0				},		// 18: IN0 E,(n)
+		{ M_OUT0,		OP_PORT,		OP_E,			0				},		// 19: OUT0 (n),E
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 1A: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 1B: -
+		{ M_TST,		OP_A,			OP_E,			0				},		// 1C: TST A,E
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 1D: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 1E: -
+		{ M_LD,			OP_IND_HL,		OP_DE,			0				},		// 1F: LD (HL),DE
+		{ M_IN0,		OP_H,			OP_PORT,		0				},		// 20: IN0 H,(n)
+		{ M_OUT0,		OP_PORT,		OP_H,			0				},		// 21: OUT0 (n),H
+		{ M_LEA,		OP_HL,			OP_IXO,			0				},		// 22: LEA HL,IX+d
+		{ M_LEA,		OP_HL,			OP_IYO,			0				},		// 23: LEA HL,IY+d
+		{ M_TST,		OP_A,			OP_H,			0				},		// 24: TST A,H
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 25: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 26: -
+		{ M_LD,			OP_HL,			OP_IND_HL,		0				},		// 27: LD HL,(HL)
+		{ M_IN0,		OP_L,			OP_PORT,		0				},		// 28: IN0 L,(n)
+		{ M_OUT0,		OP_PORT,		OP_L,			0				},		// 29: OUT0 (n),L
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 2A: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 2B: -
+		{ M_TST,		OP_A,			OP_L,			0				},		// 2C: TST A,L
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 2D: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 2E: -
+		{ M_LD,			OP_IND_HL,		OP_HL,			0				},		// 2F: LD (HL),HL
+		{ M_IN0,		OP_IND_HL,		OP_PORT,		0				},		// 30: IN0 (HL),(n)
+		{ M_LD,			OP_IY,			OP_IND_HL,		0				},		// 31: LD IY,(HL)
+		{ M_LEA,		OP_IX,			OP_IXO,			0				},		// 32: LEA IX,IX+d
+		{ M_LEA,		OP_IY,			OP_IYO,			0				},		// 33: LEA IY,IY+d
+		{ M_TST,		OP_A,			OP_IND_HL,		0				},		// 34: TST A,(HL)
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 35: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 36: -
+		{ M_LD,			OP_IX,			OP_IND_HL,		0				},		// 37: LD IX,(HL)
+		{ M_IN0,		OP_A,			OP_PORT,		0				},		// 38: IN0 A,(n)
+		{ M_OUT0,		OP_PORT,		OP_A,			0				},		// 39: OUT0 (n),A
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 3A: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 3B: -
+		{ M_TST,		OP_A,			OP_A,			0				},		// 3C: TST A,A
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 3D: -
+		{ M_LD,			OP_IND_HL,		OP_IY,			0				},		// 3E: LD (HL),IY
+		{ M_LD,			OP_IND_HL,		OP_IX,			0				},		// 3F: LD (HL),IX
+		{ M_IN,			OP_B,			OP_IND_C,		0				},		// 40: IN B,(C)
+		{ M_OUT,		OP_IND_C,		OP_B,			0				},		// 41: OUT (C),B
+		{ M_SBC,		OP_HL,			OP_BC,			0				},		// 42: SBC HL,BC
+		{ M_LD,			OP_INN,			OP_BC,			0				},		// 43: LD (nn),BC
+		{ M_NEG,		OP_NONE,		OP_NONE,		0				},		// 44: NEG
+		{ M_RETN,		OP_NONE,		OP_NONE,		D_AM			},		// 45: RETN
+		{ M_IM,			OP_0,			OP_NONE,		0				},		// 46: IM 0
+		{ M_LD,			OP_I,			OP_A,			0				},		// 47: LD I,A
+		{ M_IN,			OP_C,			OP_IND_C,		0				},		// 48: IN C,(C)
+		{ M_OUT,		OP_IND_C,		OP_C,			0				},		// 49: OUT (C),C
+		{ M_ADC,		OP_HL,			OP_BC,			0				},		// 4A: ADC HL,BC
+		{ M_LD,			OP_BC,			OP_INN,			0				},		// 4B: LD BC,(nn)
+		{ M_MLT,		OP_BC,			OP_NONE,		0				},		// 4C: MLT BC
+		{ M_RETI,		OP_NONE,		OP_NONE,		D_AM			},		// 4D: RETI
+		{ M_IM,			OP_IM01,		OP_NONE,		0				},		// 4E: IM 0/1
+		{ M_LD,			OP_R,			OP_A,			0				},		// 4F: LD R,A
+		{ M_IN,			OP_D,			OP_IND_C,		0				},		// 50: IN D,(C)
+		{ M_OUT,		OP_IND_C,		OP_D,			0				},		// 51: OUT (C),D
+		{ M_SBC,		OP_HL,			OP_DE,			0				},		// 52: SBC HL,DE
+		{ M_LD,			OP_INN,			OP_DE,			0				},		// 53: LD (nn),DE
+		{ M_LEA,		OP_IX,			OP_IYO,			0				},		// 54: LEA IX,IY+d
+		{ M_LEA,		OP_IY,			OP_IXO,			0				},		// 55: LEA IY,IX+d
+		{ M_IM,			OP_1,			OP_NONE,		0				},		// 56: IM 1
+		{ M_LD,			OP_A,			OP_I,			0				},		// 57: LD A,I
+		{ M_IN,			OP_E,			OP_IND_C,		0				},		// 58: IN E,(C)
+		{ M_OUT,		OP_IND_C,		OP_E,			0				},		// 59: OUT (C),E
+		{ M_ADC,		OP_HL,			OP_DE,			0				},		// 5A: ADC HL,DE
+		{ M_LD,			OP_DE,			OP_INN,			0				},		// 5B: LD DE,(nn)
+		{ M_MLT,		OP_DE,			OP_NONE,		0				},		// 5C: MLT DE
+		{ M_RETN,		OP_NONE,		OP_NONE,		D_AM			},		// 5D: RETN
+		{ M_IM,			OP_2,			OP_NONE,		0				},		// 5E: IM 2
+		{ M_LD,			OP_A,			OP_R,			0				},		// 5F: LD A,R
+		{ M_IN,			OP_H,			OP_IND_C,		0				},		// 60: IN H,(C)
+		{ M_OUT,		OP_IND_C,		OP_H,			0				},		// 61: OUT (C),H
+		{ M_SBC,		OP_HL,			OP_HL,			0				},		// 62: SBC HL,HL
+		{ M_LD,			OP_INN,			OP_HL,			0				},		// 63: LD (nn),HL
+		{ M_TST,		OP_A,			OP_N,			0				},		// 64: TST A,n
+		{ M_PEA,		OP_IXO,			OP_NONE,		0				},		// 65: PEA IX+d
+		{ M_PEA,		OP_IYO,			OP_NONE,		0				},		// 66: PEA IY+d
+		{ M_RRD,		OP_NONE,		OP_NONE,		0				},		// 67: RRD
+		{ M_IN,			OP_L,			OP_IND_C,		0				},		// 68: IN L,(C)
+		{ M_OUT,		OP_IND_C,		OP_L,			0				},		// 69: OUT (C),L
+		{ M_ADC,		OP_HL,			OP_HL,			0				},		// 6A: ADC HL,HL
+		{ M_LD,			OP_HL,			OP_INN,			0				},		// 6B: LD HL,(nn)
+		{ M_MLT,		OP_HL,			OP_NONE,		0				},		// 6C: MLT HL
+		{ M_LDMBA,		OP_NONE,		OP_NONE,		0				},		// 6D: LD MB,A
+		{ M_LDAMB,		OP_NONE,		OP_NONE,		0				},		// 6E: LD A,MB
+		{ M_RLD,		OP_NONE,		OP_NONE,		0				},		// 6F: RLD
+		{ M_IN,			OP_IND_C,		OP_NONE,		0				},		// 70: IN (C)
+		{ M_OUT,		OP_IND_C,		OP_NONE,		0				},		// 71: OUT (C)
+		{ M_SBC,		OP_HL,			OP_SP,			0				},		// 72: SBC HL,SP
+		{ M_LD,			OP_INN,			OP_SP,			0				},		// 73: LD (nn),SP
+		{ M_TSTIO,		OP_N,			OP_NONE,		0				},		// 74: TSTIO n
+		{ M_RETN,		OP_NONE,		OP_NONE,		D_AM			},		// 75: RETN
+		{ M_SLP,		OP_NONE,		OP_NONE,		0				},		// 76: SLP
+		{ M_NOP,		OP_NONE,		OP_NONE,		0				},		// 77: NOP
+		{ M_IN,			OP_A,			OP_IND_C,		0				},		// 78: IN A,(C)
+		{ M_OUT,		OP_IND_C,		OP_A,			0				},		// 79: OUT (C),A
+		{ M_ADC,		OP_HL,			OP_SP,			0				},		// 7A: ADC HL,SP
+		{ M_LD,			OP_SP,			OP_INN,			0				},		// 7B: LD SP,(nn)
+		{ M_MLT,		OP_SP,			OP_NONE,		0				},		// 7C: MLT SP
+		{ M_STMIX,		OP_NONE,		OP_NONE,		0				},		// 7D: STMIX
+		{ M_RSMIX,		OP_NONE,		OP_NONE,		0				},		// 7E: RSMIX
+		{ M_NOP,		OP_NONE,		OP_NONE,		0				},		// 7F: NOP
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 80: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 81: -
+		{ M_INIM,		OP_NONE,		OP_NONE,		D_AMPRE			},		// 82: INIM
+		{ M_OTIM,		OP_NONE,		OP_NONE,		D_AMPRE			},		// 83: OTIM
+		{ M_INI2,		OP_NONE,		OP_NONE,		D_AMPRE			},		// 84: INI2
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 85: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 86: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 87: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 88: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 89: -
+		{ M_INDM,		OP_NONE,		OP_NONE,		D_AMPRE			},		// 8A: INDM
+		{ M_OTDM,		OP_NONE,		OP_NONE,		D_AMPRE			},		// 8B: OTDM
+		{ M_IND2,		OP_NONE,		OP_NONE,		D_AMPRE			},		// 8C: IND2
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 8D: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 8E: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 8F: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 90: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 91: -
+		{ M_INIMR,		OP_NONE,		OP_NONE,		D_AMPRE			},		// 92: INIMR
+		{ M_OTIMR,		OP_NONE,		OP_NONE,		D_AMPRE			},		// 93: OTIMR
+		{ M_INI2R,		OP_NONE,		OP_NONE,		D_AMPRE			},		// 94: INI2R
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 95: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 96: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 97: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 98: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 99: -
+		{ M_INDMR,		OP_NONE,		OP_NONE,		D_AMPRE			},		// 9A: INDMR
+		{ M_OTDMR,		OP_NONE,		OP_NONE,		D_AMPRE			},		// 9B: OTDMR
+		{ M_IND2R,		OP_NONE,		OP_NONE,		D_AMPRE			},		// 9C: IND2R
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 9D: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 9E: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 9F: -
+		{ M_LDI,		OP_NONE,		OP_NONE,		D_AMPRE			},		// A0: LDI
+		{ M_CPI,		OP_NONE,		OP_NONE,		D_AMPRE			},		// A1: CPI
+		{ M_INI,		OP_NONE,		OP_NONE,		D_AMPRE			},		// A2: INI
+		{ M_OUTI,		OP_NONE,		OP_NONE,		D_AMPRE			},		// A3: OUTI
+		{ M_OUTI2,		OP_NONE,		OP_NONE,		D_AMPRE			},		// A4: OUTI2
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// A5: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// A6: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// A7: -
+		{ M_LDD,		OP_NONE,		OP_NONE,		D_AMPRE			},		// A8: LDD
+		{ M_CPD,		OP_NONE,		OP_NONE,		D_AMPRE			},		// A9: CPD
+		{ M_IND,		OP_NONE,		OP_NONE,		D_AMPRE			},		// AA: IND
+		{ M_OUTD,		OP_NONE,		OP_NONE,		D_AMPRE			},		// AB: OUTD
+		{ M_OUTD2,		OP_NONE,		OP_NONE,		D_AMPRE			},		// AC: OUTD2
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// AD: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// AE: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// AF: -
+		{ M_LDIR,		OP_NONE,		OP_NONE,		D_AMPRE			},		// B0: LDIR
+		{ M_CPIR,		OP_NONE,		OP_NONE,		D_AMPRE			},		// B1: CPIR
+		{ M_INIR,		OP_NONE,		OP_NONE,		D_AMPRE			},		// B2: INIR
+		{ M_OTIR,		OP_NONE,		OP_NONE,		D_AMPRE			},		// B3: OTIR
+		{ M_OTI2R,		OP_NONE,		OP_NONE,		D_AMPRE			},		// B4: OTI2R
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// B5: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// B6: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// B7: -
+		{ M_LDDR,		OP_NONE,		OP_NONE,		D_AMPRE			},		// B8: LDDR
+		{ M_CPDR,		OP_NONE,		OP_NONE,		D_AMPRE			},		// B9: CPDR
+		{ M_INDR,		OP_NONE,		OP_NONE,		D_AMPRE			},		// BA: INDR
+		{ M_OTDR,		OP_NONE,		OP_NONE,		D_AMPRE			},		// BB: OTDR
+		{ M_OTD2R,		OP_NONE,		OP_NONE,		D_AMPRE			},		// BC: OTD2R
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// BD: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// BE: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// BF: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// C0: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// C1: -
+		{ M_INIRX,		OP_NONE,		OP_NONE,		D_AMPRE			},		// C2: INIRX
+		{ M_OTIRX,		OP_NONE,		OP_NONE,		D_AMPRE			},		// C3: OTIRX
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// C4: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// C5: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// C6: -
+		{ M_LD,			OP_I,			OP_HL,			0				},		// C7: LD I,HL
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// C8: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// C9: -
+		{ M_INDRX,		OP_NONE,		OP_NONE,		D_AMPRE			},		// CA: INDRX
+		{ M_OTDRX,		OP_NONE,		OP_NONE,		D_AMPRE			},		// CB: OTDRX
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// CC: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// CD: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// CE: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// CF: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// D0: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// D1: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// D2: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// D3: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// D4: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// D5: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// D6: -
+		{ M_LD,			OP_HL,			OP_I,			0				},		// D7: LD HL,I
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// D8: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// D9: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// DA: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// DB: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// DC: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// DD: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// DE: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// DF: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// E0: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// E1: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// E2: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// E3: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// E4: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// E5: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// E6: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// E7: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// E8: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// E9: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// EA: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// EB: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// EC: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// ED: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// EE: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// EF: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// F0: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// F1: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// F2: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// F3: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// F4: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// F5: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// F6: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// F7: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// F8: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// F9: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// FA: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// FB: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// FC: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// FD: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// FE: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				} 		// FF: -
+	},
+	//
+	// DD prefixed opcodes (IX)
+	//
+	{
+		{ M_NOP,		OP_NONE,		OP_NONE,		0				},		// 00: NOP
+		{ M_LD,			OP_BC,			OP_NN,			D_AM			},		// 01: LD BC,nn
+		{ M_LD,			OP_IND_BC,		OP_A,			0				},		// 02: LD (BC),A
+		{ M_INC,		OP_BC,			OP_NONE,		D_AM			},		// 03: INC BC
+		{ M_INC,		OP_B,			OP_NONE,		0				},		// 04: INC B
+		{ M_DEC,		OP_B,			OP_NONE,		0				},		// 05: DEC B
+		{ M_LD,			OP_B,			OP_N,			0				},		// 06: LD B,n
+		{ M_LD,			OP_BC,			OP_IXD,			0				},		// 07: LD BC,(IX+d)
+		{ M_EX,			OP_AF,			OP_AF_,			0				},		// 08: EX AF,AF'
+		{ M_ADD,		OP_IX,			OP_BC,			D_AM			},		// 09: ADD IX,BC
+		{ M_LD,			OP_A,			OP_IND_BC,		0				},		// 0A: LD A,(BC)
+		{ M_DEC,		OP_BC,			OP_NONE,		D_AM			},		// 0B: DEC BC
+		{ M_INC,		OP_C,			OP_NONE,		0				},		// 0C: INC C
+		{ M_DEC,		OP_C,			OP_NONE,		0				},		// 0D: DEC C
+		{ M_LD,			OP_C,			OP_N,			0				},		// 0E: LD C,n
+		{ M_LD,			OP_IXD,			OP_BC,			0				},		// 0F: LD (IX+d),BC
+		{ M_DJNZ,		OP_REL,			OP_NONE,		0				},		// 10: DJNZ e
+		{ M_LD,			OP_DE,			OP_NN,			D_AM			},		// 11: LD DE,nn
+		{ M_LD,			OP_IND_DE,		OP_A,			0				},		// 12: LD (DE),A
+		{ M_INC,		OP_DE,			OP_NONE,		D_AM			},		// 13: INC DE
+		{ M_INC,		OP_D,			OP_NONE,		0				},		// 14: INC D
+		{ M_DEC,		OP_D,			OP_NONE,		0				},		// 15: DEC D
+		{ M_LD,			OP_D,			OP_N,			0				},		// 16: LD D,n
+		{ M_LD,			OP_DE,			OP_IXD,			0				},		// 17: LD DE,(IX+d)
+		{ M_JR,			OP_REL,			OP_NONE,		0				},		// 18: JR e
+		{ M_ADD,		OP_IX,			OP_DE,			D_AM			},		// 19: ADD IX,DE
+		{ M_LD,			OP_A,			OP_IND_DE,		0				},		// 1A: LD A,(DE)
+		{ M_DEC,		OP_DE,			OP_NONE,		D_AM			},		// 1B: DEC DE
+		{ M_INC,		OP_E,			OP_NONE,		0				},		// 1C: INC E
+		{ M_DEC,		OP_E,			OP_NONE,		0				},		// 1D: DEC E
+		{ M_LD,			OP_E,			OP_N,			0				},		// 1E: LD E,n
+		{ M_LD,			OP_IXD,			OP_DE,			0				},		// 1F: LD (IX+d),DE
+		{ M_JR,			OP_CC_NZ,		OP_REL,			0				},		// 20: JR NZ,e
+		{ M_LD,			OP_IX,			OP_NN,			D_AM			},		// 21: LD IX,nn
+		{ M_LD,			OP_INN,			OP_IX,			D_AM			},		// 22: LD (nn),IX
+		{ M_INC,		OP_IX,			OP_NONE,		D_AM			},		// 23: INC IX
+		{ M_INC,		OP_IXH,			OP_NONE,		0				},		// 24: INC IXH
+		{ M_DEC,		OP_IXH,			OP_NONE,		0				},		// 25: DEC IXH
+		{ M_LD,			OP_IXH,			OP_N,			0				},		// 26: LD IXH,n
+		{ M_LD,			OP_HL,			OP_IXD,			0				},		// 27: LD HL,(IX+d)
+		{ M_JR,			OP_CC_Z,		OP_REL,			0				},		// 28: JR Z,e
+		{ M_ADD,		OP_IX,			OP_IX,			D_AM			},		// 29: ADD IX,IX
+		{ M_LD,			OP_IX,			OP_INN,			D_AM			},		// 2A: LD IX,(nn)
+		{ M_DEC,		OP_IX,			OP_NONE,		D_AM			},		// 2B: DEC IX
+		{ M_INC,		OP_IXL,			OP_NONE,		0				},		// 2C: INC IXL
+		{ M_DEC,		OP_IXL,			OP_NONE,		0				},		// 2D: DEC IXL
+		{ M_LD,			OP_IXL,			OP_N,			0				},		// 2E: LD IXL,n
+		{ M_LD,			OP_IXD,			OP_HL,			0				},		// 2F: LD (IX+d),HL
+		{ M_JR,			OP_CC_NC,		OP_REL,			0				},		// 30: JR NC,e
+		{ M_LD,			OP_IY,			OP_IXD,			0				},		// 31: LD IY,(IX+d)
+		{ M_LD,			OP_INN,			OP_A,			D_AM			},		// 32: LD (nn),A
+		{ M_INC,		OP_SP,			OP_NONE,		D_AM			},		// 33: INC SP
+		{ M_INC,		OP_IXD,			OP_NONE,		0				},		// 34: INC (IX+d)
+		{ M_DEC,		OP_IXD,			OP_NONE,		0				},		// 35: DEC (IX+d)
+		{ M_LD,			OP_IXD,			OP_N,			0				},		// 36: LD (IX+d),n
+		{ M_LD,			OP_IX,			OP_IXD,			0				},		// 37: LD IX,(IX+d)
+		{ M_JR,			OP_CC_C,		OP_REL,			0				},		// 38: JR C,e
+		{ M_ADD,		OP_IX,			OP_SP,			D_AM			},		// 39: ADD IX,SP
+		{ M_LD,			OP_A,			OP_INN,			D_AM			},		// 3A: LD A,(nn)
+		{ M_DEC,		OP_SP,			OP_NONE,		D_AM			},		// 3B: DEC SP
+		{ M_INC,		OP_A,			OP_NONE,		0				},		// 3C: INC A
+		{ M_DEC,		OP_A,			OP_NONE,		0				},		// 3D: DEC A
+		{ M_LD,			OP_IXD,			OP_IY,			0				},		// 3E: LD (IX+d),IY
+		{ M_LD,			OP_IXD,			OP_IX,			0				},		// 3F: LD (IX+d),IX
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 40: -
+		{ M_LD,			OP_B,			OP_C,			D_AM			},		// 41: LD B,C
+		{ M_LD,			OP_B,			OP_D,			D_AM			},		// 42: LD B,D
+		{ M_LD,			OP_B,			OP_E,			D_AM			},		// 43: LD B,E
+		{ M_LD,			OP_B,			OP_IXH,			D_AM			},		// 44: LD B,IXH
+		{ M_LD,			OP_B,			OP_IXL,			D_AM			},		// 45: LD B,IXL
+		{ M_LD,			OP_B,			OP_IXD,			D_AM			},		// 46: LD B,(IX+d)
+		{ M_LD,			OP_B,			OP_A,			D_AM			},		// 47: LD B,A
+		{ M_LD,			OP_C,			OP_B,			D_AM			},		// 48: LD C,B
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 49: -
+		{ M_LD,			OP_C,			OP_D,			D_AM			},		// 4A: LD C,D
+		{ M_LD,			OP_C,			OP_E,			D_AM			},		// 4B: LD C,E
+		{ M_LD,			OP_C,			OP_IXH,			D_AM			},		// 4C: LD C,IXH
+		{ M_LD,			OP_C,			OP_IXL,			D_AM			},		// 4D: LD C,IXL
+		{ M_LD,			OP_C,			OP_IXD,			D_AM			},		// 4E: LD C,(IX+d)
+		{ M_LD,			OP_C,			OP_A,			D_AM			},		// 4F: LD C,A
+		{ M_LD,			OP_D,			OP_B,			D_AM			},		// 50: LD D,B
+		{ M_LD,			OP_D,			OP_C,			D_AM			},		// 51: LD D,C
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 52: -
+		{ M_LD,			OP_D,			OP_E,			D_AM			},		// 53: LD D,E
+		{ M_LD,			OP_D,			OP_IXH,			D_AM			},		// 54: LD D,IXH
+		{ M_LD,			OP_D,			OP_IXL,			D_AM			},		// 55: LD D,IXL
+		{ M_LD,			OP_D,			OP_IXD,			D_AM			},		// 56: LD D,(IX+d)
+		{ M_LD,			OP_D,			OP_A,			D_AM			},		// 57: LD D,A
+		{ M_LD,			OP_E,			OP_B,			D_AM			},		// 58: LD E,B
+		{ M_LD,			OP_E,			OP_C,			D_AM			},		// 59: LD E,C
+		{ M_LD,			OP_E,			OP_D,			D_AM			},		// 5A: LD E,D
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 5B: -
+		{ M_LD,			OP_E,			OP_IXH,			D_AM			},		// 5C: LD E,IXH
+		{ M_LD,			OP_E,			OP_IXL,			D_AM			},		// 5D: LD E,IXL
+		{ M_LD,			OP_E,			OP_IXD,			D_AM			},		// 5E: LD E,(IX+d)
+		{ M_LD,			OP_E,			OP_A,			D_AM			},		// 5F: LD E,A
+		{ M_LD,			OP_IXH,			OP_B,			D_AM			},		// 60: LD IXH,B
+		{ M_LD,			OP_IXH,			OP_C,			D_AM			},		// 61: LD IXH,C
+		{ M_LD,			OP_IXH,			OP_D,			D_AM			},		// 62: LD IXH,D
+		{ M_LD,			OP_IXH,			OP_E,			D_AM			},		// 63: LD IXH,E
+		{ M_LD,			OP_IXH,			OP_IXH,			D_AM			},		// 64: LD IXH,IXH
+		{ M_LD,			OP_IXH,			OP_IXL,			D_AM			},		// 65: LD IXH,IXL
+		{ M_LD,			OP_H,			OP_IXD,			D_AM			},		// 66: LD H,(IX+d)
+		{ M_LD,			OP_IXH,			OP_A,			D_AM			},		// 67: LD IXH,A
+		{ M_LD,			OP_IXL,			OP_B,			D_AM			},		// 68: LD IXL,B
+		{ M_LD,			OP_IXL,			OP_C,			D_AM			},		// 69: LD IXL,C
+		{ M_LD,			OP_IXL,			OP_D,			D_AM			},		// 6A: LD IXL,D
+		{ M_LD,			OP_IXL,			OP_E,			D_AM			},		// 6B: LD IXL,E
+		{ M_LD,			OP_IXL,			OP_IXH,			D_AM			},		// 6C: LD IXL,IXH
+		{ M_LD,			OP_IXL,			OP_IXL,			D_AM			},		// 6D: LD IXL,IXL
+		{ M_LD,			OP_L,			OP_IXD,			D_AM			},		// 6E: LD L,(IX+d)
+		{ M_LD,			OP_IXL,			OP_A,			D_AM			},		// 6F: LD IXL,A
+		{ M_LD,			OP_IXD,			OP_B,			D_AM			},		// 70: LD (IX+d),B
+		{ M_LD,			OP_IXD,			OP_C,			D_AM			},		// 71: LD (IX+d),C
+		{ M_LD,			OP_IXD,			OP_D,			D_AM			},		// 72: LD (IX+d),D
+		{ M_LD,			OP_IXD,			OP_E,			D_AM			},		// 73: LD (IX+d),E
+		{ M_LD,			OP_IXD,			OP_H,			D_AM			},		// 74: LD (IX+d),H
+		{ M_LD,			OP_IXD,			OP_L,			D_AM			},		// 75: LD (IX+d),L
+		{ M_HALT,		OP_NONE,		OP_NONE,		0				},		// 76: HALT
+		{ M_LD,			OP_IXD,			OP_A,			D_AM			},		// 77: LD (IX+d),A
+		{ M_LD,			OP_A,			OP_B,			D_AM			},		// 78: LD A,B
+		{ M_LD,			OP_A,			OP_C,			D_AM			},		// 79: LD A,C
+		{ M_LD,			OP_A,			OP_D,			D_AM			},		// 7A: LD A,D
+		{ M_LD,			OP_A,			OP_E,			D_AM			},		// 7B: LD A,E
+		{ M_LD,			OP_A,			OP_IXH,			D_AM			},		// 7C: LD A,IXH
+		{ M_LD,			OP_A,			OP_IXL,			D_AM			},		// 7D: LD A,IXL
+		{ M_LD,			OP_A,			OP_IXD,			D_AM			},		// 7E: LD A,(IX+d)
+		{ M_LD,			OP_A,			OP_A,			D_AM			},		// 7F: LD A,A
+		{ M_ADD,		OP_A,			OP_B,			0				},		// 80: ADD A,B
+		{ M_ADD,		OP_A,			OP_C,			0				},		// 81: ADD A,C
+		{ M_ADD,		OP_A,			OP_D,			0				},		// 82: ADD A,D
+		{ M_ADD,		OP_A,			OP_E,			0				},		// 83: ADD A,E
+		{ M_ADD,		OP_A,			OP_IXH,			0				},		// 84: ADD A,IXH
+		{ M_ADD,		OP_A,			OP_IXL,			0				},		// 85: ADD A,IXL
+		{ M_ADD,		OP_A,			OP_IXD,			0				},		// 86: ADD A,(IX+d)
+		{ M_ADD,		OP_A,			OP_A,			0				},		// 87: ADD A,A
+		{ M_ADC,		OP_A,			OP_B,			0				},		// 88: ADC A,B
+		{ M_ADC,		OP_A,			OP_C,			0				},		// 89: ADC A,C
+		{ M_ADC,		OP_A,			OP_D,			0				},		// 8A: ADC A,D
+		{ M_ADC,		OP_A,			OP_E,			0				},		// 8B: ADC A,E
+		{ M_ADC,		OP_A,			OP_IXH,			0				},		// 8C: ADC A,IXH
+		{ M_ADC,		OP_A,			OP_IXL,			0				},		// 8D: ADC A,IXL
+		{ M_ADC,		OP_A,			OP_IXD,			0				},		// 8E: ADC A,(IX+d)
+		{ M_ADC,		OP_A,			OP_A,			0				},		// 8F: ADC A,A
+		{ M_SUB,		OP_A,			OP_B,			0				},		// 90: SUB A,B
+		{ M_SUB,		OP_A,			OP_C,			0				},		// 91: SUB A,C
+		{ M_SUB,		OP_A,			OP_D,			0				},		// 92: SUB A,D
+		{ M_SUB,		OP_A,			OP_E,			0				},		// 93: SUB A,E
+		{ M_SUB,		OP_A,			OP_IXH,			0				},		// 94: SUB A,IXH
+		{ M_SUB,		OP_A,			OP_IXL,			0				},		// 95: SUB A,IXL
+		{ M_SUB,		OP_A,			OP_IXD,			0				},		// 96: SUB A,(IX+d)
+		{ M_SUB,		OP_A,			OP_A,			0				},		// 97: SUB A,A
+		{ M_SBC,		OP_A,			OP_B,			0				},		// 98: SBC A,B
+		{ M_SBC,		OP_A,			OP_C,			0				},		// 99: SBC A,C
+		{ M_SBC,		OP_A,			OP_D,			0				},		// 9A: SBC A,D
+		{ M_SBC,		OP_A,			OP_E,			0				},		// 9B: SBC A,E
+		{ M_SBC,		OP_A,			OP_IXH,			0				},		// 9C: SBC A,IXH
+		{ M_SBC,		OP_A,			OP_IXL,			0				},		// 9D: SBC A,IXL
+		{ M_SBC,		OP_A,			OP_IXD,			0				},		// 9E: SBC A,(IX+d)
+		{ M_SBC,		OP_A,			OP_A,			0				},		// 9F: SBC A,A
+		{ M_AND,		OP_A,			OP_B,			0				},		// A0: AND A,B
+		{ M_AND,		OP_A,			OP_C,			0				},		// A1: AND A,C
+		{ M_AND,		OP_A,			OP_D,			0				},		// A2: AND A,D
+		{ M_AND,		OP_A,			OP_E,			0				},		// A3: AND A,E
+		{ M_AND,		OP_A,			OP_IXH,			0				},		// A4: AND A,IXH
+		{ M_AND,		OP_A,			OP_IXL,			0				},		// A5: AND A,IXL
+		{ M_AND,		OP_A,			OP_IXD,			0				},		// A6: AND A,(IX+d)
+		{ M_AND,		OP_A,			OP_A,			0				},		// A7: AND A,A
+		{ M_XOR,		OP_A,			OP_B,			0				},		// A8: XOR A,B
+		{ M_XOR,		OP_A,			OP_C,			0				},		// A9: XOR A,C
+		{ M_XOR,		OP_A,			OP_D,			0				},		// AA: XOR A,D
+		{ M_XOR,		OP_A,			OP_E,			0				},		// AB: XOR A,E
+		{ M_XOR,		OP_A,			OP_IXH,			0				},		// AC: XOR A,IXH
+		{ M_XOR,		OP_A,			OP_IXL,			0				},		// AD: XOR A,IXL
+		{ M_XOR,		OP_A,			OP_IXD,			0				},		// AE: XOR A,(IX+d)
+		{ M_XOR,		OP_A,			OP_A,			0				},		// AF: XOR A,A
+		{ M_OR,			OP_A,			OP_B,			0				},		// B0: OR A,B
+		{ M_OR,			OP_A,			OP_C,			0				},		// B1: OR A,C
+		{ M_OR,			OP_A,			OP_D,			0				},		// B2: OR A,D
+		{ M_OR,			OP_A,			OP_E,			0				},		// B3: OR A,E
+		{ M_OR,			OP_A,			OP_IXH,			0				},		// B4: OR A,IXH
+		{ M_OR,			OP_A,			OP_IXL,			0				},		// B5: OR A,IXL
+		{ M_OR,			OP_A,			OP_IXD,			0				},		// B6: OR A,(IX+d)
+		{ M_OR,			OP_A,			OP_A,			0				},		// B7: OR A,A
+		{ M_CP,			OP_A,			OP_B,			0				},		// B8: CP A,B
+		{ M_CP,			OP_A,			OP_C,			0				},		// B9: CP A,C
+		{ M_CP,			OP_A,			OP_D,			0				},		// BA: CP A,D
+		{ M_CP,			OP_A,			OP_E,			0				},		// BB: CP A,E
+		{ M_CP,			OP_A,			OP_IXH,			0				},		// BC: CP A,IXH
+		{ M_CP,			OP_A,			OP_IXL,			0				},		// BD: CP A,IXL
+		{ M_CP,			OP_A,			OP_IXD,			0				},		// BE: CP A,(IX+d)
+		{ M_CP,			OP_A,			OP_A,			0				},		// BF: CP A,A
+		{ M_RET,		OP_CC_NZ,		OP_NONE,		D_AM			},		// C0: RET NZ
+		{ M_POP,		OP_BC,			OP_NONE,		D_AM			},		// C1: POP BC
+		{ M_JP,			OP_CC_NZ,		OP_NN,			D_AM			},		// C2: JP NZ,nn
+		{ M_JP,			OP_NN,			OP_NONE,		D_AM			},		// C3: JP nn
+		{ M_CALL,		OP_CC_NZ,		OP_NN,			D_AM			},		// C4: CALL NZ,nn
+		{ M_PUSH,		OP_BC,			OP_NONE,		D_AM			},		// C5: PUSH BC
+		{ M_ADD,		OP_A,			OP_N,			0				},		// C6: ADD A,n
+		{ M_RST,		OP_RST00,		OP_NONE,		D_AM			},		// C7: RST &00
+		{ M_RET,		OP_CC_Z,		OP_NONE,		D_AM			},		// C8: RET Z
+		{ M_RET,		OP_NONE,		OP_NONE,		D_AM			},		// C9: RET
+		{ M_JP,			OP_CC_Z,		OP_NN,			D_AM			},		// CA: JP Z,nn
+		{ M_NONE,		T_DDCB,			OP_NONE,		D_PREFIX		},		// CB: DDCB prefix
+		{ M_CALL,		OP_CC_Z,		OP_NN,			D_AM			},		// CC: CALL Z,nn
+		{ M_CALL,		OP_NN,			OP_NONE,		D_AM			},		// CD: CALL nn
+		{ M_ADC,		OP_A,			OP_N,			0				},		// CE: ADC A,n
+		{ M_RST,		OP_RST08,		OP_NONE,		D_AM			},		// CF: RST &08
+		{ M_RET,		OP_CC_NC,		OP_NONE,		D_AM			},		// D0: RET NC
+		{ M_POP,		OP_DE,			OP_NONE,		D_AM			},		// D1: POP DE
+		{ M_JP,			OP_CC_NC,		OP_NN,			D_AM			},		// D2: JP NC,nn
+		{ M_OUT,		OP_PORT,		OP_A,			0				},		// D3: OUT (n),A
+		{ M_CALL,		OP_CC_NC,		OP_NN,			D_AM			},		// D4: CALL NC,nn
+		{ M_PUSH,		OP_DE,			OP_NONE,		D_AM			},		// D5: PUSH DE
+		{ M_SUB,		OP_A,			OP_N,			0				},		// D6: SUB A,n
+		{ M_RST,		OP_RST10,		OP_NONE,		D_AM			},		// D7: RST &10
+		{ M_RET,		OP_CC_C,		OP_NONE,		D_AM			},		// D8: RET C
+		{ M_EXX,		OP_NONE,		OP_NONE,		0				},		// D9: EXX
+		{ M_JP,			OP_CC_C,		OP_NN,			D_AM			},		// DA: JP C,nn
+		{ M_IN,			OP_PORT,		OP_A,			0				},		// DB: IN (n),A
+		{ M_CALL,		OP_CC_C,		OP_NN,			D_AM			},		// DC: CALL C,nn
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// DD: -
+		{ M_SBC,		OP_A,			OP_N,			0				},		// DE: SBC A,n
+		{ M_RST,		OP_RST18,		OP_NONE,		D_AM			},		// DF: RST &18
+		{ M_RET,		OP_CC_PO,		OP_NONE,		D_AM			},		// E0: RET PO
+		{ M_POP,		OP_IX,			OP_NONE,		D_AM			},		// E1: POP IX
+		{ M_JP,			OP_CC_PO,		OP_NN,			D_AM			},		// E2: JP PO,nn
+		{ M_EX,			OP_IND_SP,		OP_IX,			0				},		// E3: EX (SP),IX
+		{ M_CALL,		OP_CC_PO,		OP_NN,			D_AM			},		// E4: CALL PO,nn
+		{ M_PUSH,		OP_IX,			OP_NONE,		D_AM			},		// E5: PUSH IX
+		{ M_AND,		OP_A,			OP_N,			0				},		// E6: AND A,n
+		{ M_RST,		OP_RST20,		OP_NONE,		D_AM			},		// E7: RST &20
+		{ M_RET,		OP_CC_PE,		OP_NONE,		D_AM			},		// E8: RET PE
+		{ M_JP,			OP_IND_IX,		OP_NONE,		D_AM			},		// E9: JP (IX)
+		{ M_JP,			OP_CC_PE,		OP_NN,			D_AM			},		// EA: JP PE,nn
+		{ M_EX,			OP_DE,			OP_HL,			0				},		// EB: EX DE,HL
+		{ M_CALL,		OP_CC_PE,		OP_NN,			D_AM			},		// EC: CALL PE,nn
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// ED: -
+		{ M_XOR,		OP_A,			OP_N,			0				},		// EE: XOR A,n
+		{ M_RST,		OP_RST28,		OP_NONE,		D_AM			},		// EF: RST &28
+		{ M_RET,		OP_CC_P,		OP_NONE,		D_AM			},		// F0: RET P
+		{ M_POP,		OP_AF,			OP_NONE,		D_AM			},		// F1: POP AF
+		{ M_JP,			OP_CC_P,		OP_NN,			D_AM			},		// F2: JP P,nn
+		{ M_DI,			OP_NONE,		OP_NONE,		0				},		// F3: DI
+		{ M_CALL,		OP_CC_P,		OP_NN,			D_AM			},		// F4: CALL P,nn
+		{ M_PUSH,		OP_AF,			OP_NONE,		D_AM			},		// F5: PUSH AF
+		{ M_OR,			OP_A,			OP_N,			0				},		// F6: OR A,n
+		{ M_RST,		OP_RST30,		OP_NONE,		D_AM			},		// F7: RST &30
+		{ M_RET,		OP_CC_M,		OP_NONE,		D_AM			},		// F8: RET M
+		{ M_LD,			OP_SP,			OP_IX,			D_AM			},		// F9: LD SP,IX
+		{ M_JP,			OP_CC_M,		OP_NN,			D_AM			},		// FA: JP M,nn
+		{ M_EI,			OP_NONE,		OP_NONE,		0				},		// FB: EI
+		{ M_CALL,		OP_CC_M,		OP_NN,			D_AM			},		// FC: CALL M,nn
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// FD: -
+		{ M_CP,			OP_A,			OP_N,			0				},		// FE: CP A,n
+		{ M_RST,		OP_RST38,		OP_NONE,		D_AM			} 		// FF: RST &38
+	},
+	//
+	// FD prefixed opcodes (IY)
+	//
+	{
+		{ M_NOP,		OP_NONE,		OP_NONE,		0				},		// 00: NOP
+		{ M_LD,			OP_BC,			OP_NN,			D_AM			},		// 01: LD BC,nn
+		{ M_LD,			OP_IND_BC,		OP_A,			0				},		// 02: LD (BC),A
+		{ M_INC,		OP_BC,			OP_NONE,		D_AM			},		// 03: INC BC
+		{ M_INC,		OP_B,			OP_NONE,		0				},		// 04: INC B
+		{ M_DEC,		OP_B,			OP_NONE,		0				},		// 05: DEC B
+		{ M_LD,			OP_B,			OP_N,			0				},		// 06: LD B,n
+		{ M_LD,			OP_BC,			OP_IYD,			0				},		// 07: LD BC,(IY+d)
+		{ M_EX,			OP_AF,			OP_AF_,			0				},		// 08: EX AF,AF'
+		{ M_ADD,		OP_IY,			OP_BC,			D_AM			},		// 09: ADD IY,BC
+		{ M_LD,			OP_A,			OP_IND_BC,		0				},		// 0A: LD A,(BC)
+		{ M_DEC,		OP_BC,			OP_NONE,		D_AM			},		// 0B: DEC BC
+		{ M_INC,		OP_C,			OP_NONE,		0				},		// 0C: INC C
+		{ M_DEC,		OP_C,			OP_NONE,		0				},		// 0D: DEC C
+		{ M_LD,			OP_C,			OP_N,			0				},		// 0E: LD C,n
+		{ M_LD,			OP_IYD,			OP_BC,			0				},		// 0F: LD (IY+d),BC
+		{ M_DJNZ,		OP_REL,			OP_NONE,		0				},		// 10: DJNZ e
+		{ M_LD,			OP_DE,			OP_NN,			D_AM			},		// 11: LD DE,nn
+		{ M_LD,			OP_IND_DE,		OP_A,			0				},		// 12: LD (DE),A
+		{ M_INC,		OP_DE,			OP_NONE,		D_AM			},		// 13: INC DE
+		{ M_INC,		OP_D,			OP_NONE,		0				},		// 14: INC D
+		{ M_DEC,		OP_D,			OP_NONE,		0				},		// 15: DEC D
+		{ M_LD,			OP_D,			OP_N,			0				},		// 16: LD D,n
+		{ M_LD,			OP_DE,			OP_IYD,			0				},		// 17: LD DE,(IY+d)
+		{ M_JR,			OP_REL,			OP_NONE,		0				},		// 18: JR e
+		{ M_ADD,		OP_IY,			OP_DE,			D_AM			},		// 19: ADD IY,DE
+		{ M_LD,			OP_A,			OP_IND_DE,		0				},		// 1A: LD A,(DE)
+		{ M_DEC,		OP_DE,			OP_NONE,		D_AM			},		// 1B: DEC DE
+		{ M_INC,		OP_E,			OP_NONE,		0				},		// 1C: INC E
+		{ M_DEC,		OP_E,			OP_NONE,		0				},		// 1D: DEC E
+		{ M_LD,			OP_E,			OP_N,			0				},		// 1E: LD E,n
+		{ M_LD,			OP_IYD,			OP_DE,			0				},		// 1F: LD (IY+d),DE
+		{ M_JR,			OP_CC_NZ,		OP_REL,			0				},		// 20: JR NZ,e
+		{ M_LD,			OP_IY,			OP_NN,			D_AM			},		// 21: LD IY,nn
+		{ M_LD,			OP_INN,			OP_IY,			D_AM			},		// 22: LD (nn),IY
+		{ M_INC,		OP_IY,			OP_NONE,		D_AM			},		// 23: INC IY
+		{ M_INC,		OP_IYH,			OP_NONE,		0				},		// 24: INC IYH
+		{ M_DEC,		OP_IYH,			OP_NONE,		0				},		// 25: DEC IYH
+		{ M_LD,			OP_IYH,			OP_N,			0				},		// 26: LD IYH,n
+		{ M_LD,			OP_HL,			OP_IYD,			0				},		// 27: LD HL,(IY+d)
+		{ M_JR,			OP_CC_Z,		OP_REL,			0				},		// 28: JR Z,e
+		{ M_ADD,		OP_IY,			OP_IY,			D_AM			},		// 29: ADD IY,IY
+		{ M_LD,			OP_IY,			OP_INN,			D_AM			},		// 2A: LD IY,(nn)
+		{ M_DEC,		OP_IY,			OP_NONE,		D_AM			},		// 2B: DEC IY
+		{ M_INC,		OP_IYL,			OP_NONE,		0				},		// 2C: INC IYL
+		{ M_DEC,		OP_IYL,			OP_NONE,		0				},		// 2D: DEC IYL
+		{ M_LD,			OP_IYL,			OP_N,			0				},		// 2E: LD IYL,n
+		{ M_LD,			OP_IYD,			OP_HL,			0				},		// 2F: LD (IY+d),HL
+		{ M_JR,			OP_CC_NC,		OP_REL,			0				},		// 30: JR NC,e
+		{ M_LD,			OP_IX,			OP_IYD,			0				},		// 31: LD IX,(IY+d)
+		{ M_LD,			OP_INN,			OP_A,			D_AM			},		// 32: LD (nn),A
+		{ M_INC,		OP_SP,			OP_NONE,		D_AM			},		// 33: INC SP
+		{ M_INC,		OP_IYD,			OP_NONE,		0				},		// 34: INC (IY+d)
+		{ M_DEC,		OP_IYD,			OP_NONE,		0				},		// 35: DEC (IY+d)
+		{ M_LD,			OP_IYD,			OP_N,			0				},		// 36: LD (IY+d),n
+		{ M_LD,			OP_IY,			OP_IYD,			0				},		// 37: LD IY,(IY+d)
+		{ M_JR,			OP_CC_C,		OP_REL,			0				},		// 38: JR C,e
+		{ M_ADD,		OP_IY,			OP_SP,			D_AM			},		// 39: ADD IY,SP
+		{ M_LD,			OP_A,			OP_INN,			D_AM			},		// 3A: LD A,(nn)
+		{ M_DEC,		OP_SP,			OP_NONE,		D_AM			},		// 3B: DEC SP
+		{ M_INC,		OP_A,			OP_NONE,		0				},		// 3C: INC A
+		{ M_DEC,		OP_A,			OP_NONE,		0				},		// 3D: DEC A
+		{ M_LD,			OP_IYD,			OP_IX,			0				},		// 3E: LD (IY+d),IX
+		{ M_LD,			OP_IYD,			OP_IY,			0				},		// 3F: LD (IY+d),IY
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 40: -
+		{ M_LD,			OP_B,			OP_C,			D_AM			},		// 41: LD B,C
+		{ M_LD,			OP_B,			OP_D,			D_AM			},		// 42: LD B,D
+		{ M_LD,			OP_B,			OP_E,			D_AM			},		// 43: LD B,E
+		{ M_LD,			OP_B,			OP_IYH,			D_AM			},		// 44: LD B,IYH
+		{ M_LD,			OP_B,			OP_IYL,			D_AM			},		// 45: LD B,IYL
+		{ M_LD,			OP_B,			OP_IYD,			D_AM			},		// 46: LD B,(IY+d)
+		{ M_LD,			OP_B,			OP_A,			D_AM			},		// 47: LD B,A
+		{ M_LD,			OP_C,			OP_B,			D_AM			},		// 48: LD C,B
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 49: -
+		{ M_LD,			OP_C,			OP_D,			D_AM			},		// 4A: LD C,D
+		{ M_LD,			OP_C,			OP_E,			D_AM			},		// 4B: LD C,E
+		{ M_LD,			OP_C,			OP_IYH,			D_AM			},		// 4C: LD C,IYH
+		{ M_LD,			OP_C,			OP_IYL,			D_AM			},		// 4D: LD C,IYL
+		{ M_LD,			OP_C,			OP_IYD,			D_AM			},		// 4E: LD C,(IY+d)
+		{ M_LD,			OP_C,			OP_A,			D_AM			},		// 4F: LD C,A
+		{ M_LD,			OP_D,			OP_B,			D_AM			},		// 50: LD D,B
+		{ M_LD,			OP_D,			OP_C,			D_AM			},		// 51: LD D,C
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 52: -
+		{ M_LD,			OP_D,			OP_E,			D_AM			},		// 53: LD D,E
+		{ M_LD,			OP_D,			OP_IYH,			D_AM			},		// 54: LD D,IYH
+		{ M_LD,			OP_D,			OP_IYL,			D_AM			},		// 55: LD D,IYL
+		{ M_LD,			OP_D,			OP_IYD,			D_AM			},		// 56: LD D,(IY+d)
+		{ M_LD,			OP_D,			OP_A,			D_AM			},		// 57: LD D,A
+		{ M_LD,			OP_E,			OP_B,			D_AM			},		// 58: LD E,B
+		{ M_LD,			OP_E,			OP_C,			D_AM			},		// 59: LD E,C
+		{ M_LD,			OP_E,			OP_D,			D_AM			},		// 5A: LD E,D
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 5B: -
+		{ M_LD,			OP_E,			OP_IYH,			D_AM			},		// 5C: LD E,IYH
+		{ M_LD,			OP_E,			OP_IYL,			D_AM			},		// 5D: LD E,IYL
+		{ M_LD,			OP_E,			OP_IYD,			D_AM			},		// 5E: LD E,(IY+d)
+		{ M_LD,			OP_E,			OP_A,			D_AM			},		// 5F: LD E,A
+		{ M_LD,			OP_IYH,			OP_B,			D_AM			},		// 60: LD IYH,B
+		{ M_LD,			OP_IYH,			OP_C,			D_AM			},		// 61: LD IYH,C
+		{ M_LD,			OP_IYH,			OP_D,			D_AM			},		// 62: LD IYH,D
+		{ M_LD,			OP_IYH,			OP_E,			D_AM			},		// 63: LD IYH,E
+		{ M_LD,			OP_IYH,			OP_IYH,			D_AM			},		// 64: LD IYH,IYH
+		{ M_LD,			OP_IYH,			OP_IYL,			D_AM			},		// 65: LD IYH,IYL
+		{ M_LD,			OP_H,			OP_IYD,			D_AM			},		// 66: LD H,(IY+d)
+		{ M_LD,			OP_IYH,			OP_A,			D_AM			},		// 67: LD IYH,A
+		{ M_LD,			OP_IYL,			OP_B,			D_AM			},		// 68: LD IYL,B
+		{ M_LD,			OP_IYL,			OP_C,			D_AM			},		// 69: LD IYL,C
+		{ M_LD,			OP_IYL,			OP_D,			D_AM			},		// 6A: LD IYL,D
+		{ M_LD,			OP_IYL,			OP_E,			D_AM			},		// 6B: LD IYL,E
+		{ M_LD,			OP_IYL,			OP_IYH,			D_AM			},		// 6C: LD IYL,IYH
+		{ M_LD,			OP_IYL,			OP_IYL,			D_AM			},		// 6D: LD IYL,IYL
+		{ M_LD,			OP_L,			OP_IYD,			D_AM			},		// 6E: LD L,(IY+d)
+		{ M_LD,			OP_IYL,			OP_A,			D_AM			},		// 6F: LD IYL,A
+		{ M_LD,			OP_IYD,			OP_B,			D_AM			},		// 70: LD (IY+d),B
+		{ M_LD,			OP_IYD,			OP_C,			D_AM			},		// 71: LD (IY+d),C
+		{ M_LD,			OP_IYD,			OP_D,			D_AM			},		// 72: LD (IY+d),D
+		{ M_LD,			OP_IYD,			OP_E,			D_AM			},		// 73: LD (IY+d),E
+		{ M_LD,			OP_IYD,			OP_H,			D_AM			},		// 74: LD (IY+d),H
+		{ M_LD,			OP_IYD,			OP_L,			D_AM			},		// 75: LD (IY+d),L
+		{ M_HALT,		OP_NONE,		OP_NONE,		0				},		// 76: HALT
+		{ M_LD,			OP_IYD,			OP_A,			D_AM			},		// 77: LD (IY+d),A
+		{ M_LD,			OP_A,			OP_B,			D_AM			},		// 78: LD A,B
+		{ M_LD,			OP_A,			OP_C,			D_AM			},		// 79: LD A,C
+		{ M_LD,			OP_A,			OP_D,			D_AM			},		// 7A: LD A,D
+		{ M_LD,			OP_A,			OP_E,			D_AM			},		// 7B: LD A,E
+		{ M_LD,			OP_A,			OP_IYH,			D_AM			},		// 7C: LD A,IYH
+		{ M_LD,			OP_A,			OP_IYL,			D_AM			},		// 7D: LD A,IYL
+		{ M_LD,			OP_A,			OP_IYD,			D_AM			},		// 7E: LD A,(IY+d)
+		{ M_LD,			OP_A,			OP_A,			D_AM			},		// 7F: LD A,A
+		{ M_ADD,		OP_A,			OP_B,			0				},		// 80: ADD A,B
+		{ M_ADD,		OP_A,			OP_C,			0				},		// 81: ADD A,C
+		{ M_ADD,		OP_A,			OP_D,			0				},		// 82: ADD A,D
+		{ M_ADD,		OP_A,			OP_E,			0				},		// 83: ADD A,E
+		{ M_ADD,		OP_A,			OP_IYH,			0				},		// 84: ADD A,IYH
+		{ M_ADD,		OP_A,			OP_IYL,			0				},		// 85: ADD A,IYL
+		{ M_ADD,		OP_A,			OP_IYD,			0				},		// 86: ADD A,(IY+d)
+		{ M_ADD,		OP_A,			OP_A,			0				},		// 87: ADD A,A
+		{ M_ADC,		OP_A,			OP_B,			0				},		// 88: ADC A,B
+		{ M_ADC,		OP_A,			OP_C,			0				},		// 89: ADC A,C
+		{ M_ADC,		OP_A,			OP_D,			0				},		// 8A: ADC A,D
+		{ M_ADC,		OP_A,			OP_E,			0				},		// 8B: ADC A,E
+		{ M_ADC,		OP_A,			OP_IYH,			0				},		// 8C: ADC A,IYH
+		{ M_ADC,		OP_A,			OP_IYL,			0				},		// 8D: ADC A,IYL
+		{ M_ADC,		OP_A,			OP_IYD,			0				},		// 8E: ADC A,(IY+d)
+		{ M_ADC,		OP_A,			OP_A,			0				},		// 8F: ADC A,A
+		{ M_SUB,		OP_A,			OP_B,			0				},		// 90: SUB A,B
+		{ M_SUB,		OP_A,			OP_C,			0				},		// 91: SUB A,C
+		{ M_SUB,		OP_A,			OP_D,			0				},		// 92: SUB A,D
+		{ M_SUB,		OP_A,			OP_E,			0				},		// 93: SUB A,E
+		{ M_SUB,		OP_A,			OP_IYH,			0				},		// 94: SUB A,IYH
+		{ M_SUB,		OP_A,			OP_IYL,			0				},		// 95: SUB A,IYL
+		{ M_SUB,		OP_A,			OP_IYD,			0				},		// 96: SUB A,(IY+d)
+		{ M_SUB,		OP_A,			OP_A,			0				},		// 97: SUB A,A
+		{ M_SBC,		OP_A,			OP_B,			0				},		// 98: SBC A,B
+		{ M_SBC,		OP_A,			OP_C,			0				},		// 99: SBC A,C
+		{ M_SBC,		OP_A,			OP_D,			0				},		// 9A: SBC A,D
+		{ M_SBC,		OP_A,			OP_E,			0				},		// 9B: SBC A,E
+		{ M_SBC,		OP_A,			OP_IYH,			0				},		// 9C: SBC A,IYH
+		{ M_SBC,		OP_A,			OP_IYL,			0				},		// 9D: SBC A,IYL
+		{ M_SBC,		OP_A,			OP_IYD,			0				},		// 9E: SBC A,(IY+d)
+		{ M_SBC,		OP_A,			OP_A,			0				},		// 9F: SBC A,A
+		{ M_AND,		OP_A,			OP_B,			0				},		// A0: AND A,B
+		{ M_AND,		OP_A,			OP_C,			0				},		// A1: AND A,C
+		{ M_AND,		OP_A,			OP_D,			0				},		// A2: AND A,D
+		{ M_AND,		OP_A,			OP_E,			0				},		// A3: AND A,E
+		{ M_AND,		OP_A,			OP_IYH,			0				},		// A4: AND A,IYH
+		{ M_AND,		OP_A,			OP_IYL,			0				},		// A5: AND A,IYL
+		{ M_AND,		OP_A,			OP_IYD,			0				},		// A6: AND A,(IY+d)
+		{ M_AND,		OP_A,			OP_A,			0				},		// A7: AND A,A
+		{ M_XOR,		OP_A,			OP_B,			0				},		// A8: XOR A,B
+		{ M_XOR,		OP_A,			OP_C,			0				},		// A9: XOR A,C
+		{ M_XOR,		OP_A,			OP_D,			0				},		// AA: XOR A,D
+		{ M_XOR,		OP_A,			OP_E,			0				},		// AB: XOR A,E
+		{ M_XOR,		OP_A,			OP_IYH,			0				},		// AC: XOR A,IYH
+		{ M_XOR,		OP_A,			OP_IYL,			0				},		// AD: XOR A,IYL
+		{ M_XOR,		OP_A,			OP_IYD,			0				},		// AE: XOR A,(IY+d)
+		{ M_XOR,		OP_A,			OP_A,			0				},		// AF: XOR A,A
+		{ M_OR,			OP_A,			OP_B,			0				},		// B0: OR A,B
+		{ M_OR,			OP_A,			OP_C,			0				},		// B1: OR A,C
+		{ M_OR,			OP_A,			OP_D,			0				},		// B2: OR A,D
+		{ M_OR,			OP_A,			OP_E,			0				},		// B3: OR A,E
+		{ M_OR,			OP_A,			OP_IYH,			0				},		// B4: OR A,IYH
+		{ M_OR,			OP_A,			OP_IYL,			0				},		// B5: OR A,IYL
+		{ M_OR,			OP_A,			OP_IYD,			0				},		// B6: OR A,(IY+d)
+		{ M_OR,			OP_A,			OP_A,			0				},		// B7: OR A,A
+		{ M_CP,			OP_A,			OP_B,			0				},		// B8: CP A,B
+		{ M_CP,			OP_A,			OP_C,			0				},		// B9: CP A,C
+		{ M_CP,			OP_A,			OP_D,			0				},		// BA: CP A,D
+		{ M_CP,			OP_A,			OP_E,			0				},		// BB: CP A,E
+		{ M_CP,			OP_A,			OP_IYH,			0				},		// BC: CP A,IYH
+		{ M_CP,			OP_A,			OP_IYL,			0				},		// BD: CP A,IYL
+		{ M_CP,			OP_A,			OP_IYD,			0				},		// BE: CP A,(IY+d)
+		{ M_CP,			OP_A,			OP_A,			0				},		// BF: CP A,A
+		{ M_RET,		OP_CC_NZ,		OP_NONE,		D_AM			},		// C0: RET NZ
+		{ M_POP,		OP_BC,			OP_NONE,		D_AM			},		// C1: POP BC
+		{ M_JP,			OP_CC_NZ,		OP_NN,			D_AM			},		// C2: JP NZ,nn
+		{ M_JP,			OP_NN,			OP_NONE,		D_AM			},		// C3: JP nn
+		{ M_CALL,		OP_CC_NZ,		OP_NN,			D_AM			},		// C4: CALL NZ,nn
+		{ M_PUSH,		OP_BC,			OP_NONE,		D_AM			},		// C5: PUSH BC
+		{ M_ADD,		OP_A,			OP_N,			0				},		// C6: ADD A,n
+		{ M_RST,		OP_RST00,		OP_NONE,		D_AM			},		// C7: RST &00
+		{ M_RET,		OP_CC_Z,		OP_NONE,		D_AM			},		// C8: RET Z
+		{ M_RET,		OP_NONE,		OP_NONE,		D_AM			},		// C9: RET
+		{ M_JP,			OP_CC_Z,		OP_NN,			D_AM			},		// CA: JP Z,nn
+		{ M_NONE,		T_FDCB,			OP_NONE,		D_PREFIX		},		// CB: FDCB prefix
+		{ M_CALL,		OP_CC_Z,		OP_NN,			D_AM			},		// CC: CALL Z,nn
+		{ M_CALL,		OP_NN,			OP_NONE,		D_AM			},		// CD: CALL nn
+		{ M_ADC,		OP_A,			OP_N,			0				},		// CE: ADC A,n
+		{ M_RST,		OP_RST08,		OP_NONE,		D_AM			},		// CF: RST &08
+		{ M_RET,		OP_CC_NC,		OP_NONE,		D_AM			},		// D0: RET NC
+		{ M_POP,		OP_DE,			OP_NONE,		D_AM			},		// D1: POP DE
+		{ M_JP,			OP_CC_NC,		OP_NN,			D_AM			},		// D2: JP NC,nn
+		{ M_OUT,		OP_PORT,		OP_A,			0				},		// D3: OUT (n),A
+		{ M_CALL,		OP_CC_NC,		OP_NN,			D_AM			},		// D4: CALL NC,nn
+		{ M_PUSH,		OP_DE,			OP_NONE,		D_AM			},		// D5: PUSH DE
+		{ M_SUB,		OP_A,			OP_N,			0				},		// D6: SUB A,n
+		{ M_RST,		OP_RST10,		OP_NONE,		D_AM			},		// D7: RST &10
+		{ M_RET,		OP_CC_C,		OP_NONE,		D_AM			},		// D8: RET C
+		{ M_EXX,		OP_NONE,		OP_NONE,		0				},		// D9: EXX
+		{ M_JP,			OP_CC_C,		OP_NN,			D_AM			},		// DA: JP C,nn
+		{ M_IN,			OP_PORT,		OP_A,			0				},		// DB: IN (n),A
+		{ M_CALL,		OP_CC_C,		OP_NN,			D_AM			},		// DC: CALL C,nn
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// DD: -
+		{ M_SBC,		OP_A,			OP_N,			0				},		// DE: SBC A,n
+		{ M_RST,		OP_RST18,		OP_NONE,		D_AM			},		// DF: RST &18
+		{ M_RET,		OP_CC_PO,		OP_NONE,		D_AM			},		// E0: RET PO
+		{ M_POP,		OP_IY,			OP_NONE,		D_AM			},		// E1: POP IY
+		{ M_JP,			OP_CC_PO,		OP_NN,			D_AM			},		// E2: JP PO,nn
+		{ M_EX,			OP_IND_SP,		OP_IY,			0				},		// E3: EX (SP),IY
+		{ M_CALL,		OP_CC_PO,		OP_NN,			D_AM			},		// E4: CALL PO,nn
+		{ M_PUSH,		OP_IY,			OP_NONE,		D_AM			},		// E5: PUSH IY
+		{ M_AND,		OP_A,			OP_N,			0				},		// E6: AND A,n
+		{ M_RST,		OP_RST20,		OP_NONE,		D_AM			},		// E7: RST &20
+		{ M_RET,		OP_CC_PE,		OP_NONE,		D_AM			},		// E8: RET PE
+		{ M_JP,			OP_IND_IY,		OP_NONE,		D_AM			},		// E9: JP (IY)
+		{ M_JP,			OP_CC_PE,		OP_NN,			D_AM			},		// EA: JP PE,nn
+		{ M_EX,			OP_DE,			OP_HL,			0				},		// EB: EX DE,HL
+		{ M_CALL,		OP_CC_PE,		OP_NN,			D_AM			},		// EC: CALL PE,nn
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// ED: -
+		{ M_XOR,		OP_A,			OP_N,			0				},		// EE: XOR A,n
+		{ M_RST,		OP_RST28,		OP_NONE,		D_AM			},		// EF: RST &28
+		{ M_RET,		OP_CC_P,		OP_NONE,		D_AM			},		// F0: RET P
+		{ M_POP,		OP_AF,			OP_NONE,		D_AM			},		// F1: POP AF
+		{ M_JP,			OP_CC_P,		OP_NN,			D_AM			},		// F2: JP P,nn
+		{ M_DI,			OP_NONE,		OP_NONE,		0				},		// F3: DI
+		{ M_CALL,		OP_CC_P,		OP_NN,			D_AM			},		// F4: CALL P,nn
+		{ M_PUSH,		OP_AF,			OP_NONE,		D_AM			},		// F5: PUSH AF
+		{ M_OR,			OP_A,			OP_N,			0				},		// F6: OR A,n
+		{ M_RST,		OP_RST30,		OP_NONE,		D_AM			},		// F7: RST &30
+		{ M_RET,		OP_CC_M,		OP_NONE,		D_AM			},		// F8: RET M
+		{ M_LD,			OP_SP,			OP_IY,			D_AM			},		// F9: LD SP,IY
+		{ M_JP,			OP_CC_M,		OP_NN,			D_AM			},		// FA: JP M,nn
+		{ M_EI,			OP_NONE,		OP_NONE,		0				},		// FB: EI
+		{ M_CALL,		OP_CC_M,		OP_NN,			D_AM			},		// FC: CALL M,nn
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// FD: -
+		{ M_CP,			OP_A,			OP_N,			0				},		// FE: CP A,n
+		{ M_RST,		OP_RST38,		OP_NONE,		D_AM			} 		// FF: RST &38
+	},
+	//
+	// DD CB d prefixed opcodes (rotates, shifts and bit operations on (IX+d))
+	//
+	{
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 00: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 01: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 02: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 03: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 04: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 05: -
+		{ M_RLC,		OP_IXD,			OP_NONE,		D_DISP			},		// 06: RLC (IX+d)
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 07: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 08: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 09: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 0A: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 0B: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 0C: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 0D: -
+		{ M_RRC,		OP_IXD,			OP_NONE,		D_DISP			},		// 0E: RRC (IX+d)
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 0F: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 10: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 11: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 12: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 13: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 14: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 15: -
+		{ M_RL,			OP_IXD,			OP_NONE,		D_DISP			},		// 16: RL (IX+d)
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 17: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 18: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 19: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 1A: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 1B: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 1C: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 1D: -
+		{ M_RR,			OP_IXD,			OP_NONE,		D_DISP			},		// 1E: RR (IX+d)
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 1F: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 20: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 21: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 22: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 23: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 24: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 25: -
+		{ M_SLA,		OP_IXD,			OP_NONE,		D_DISP			},		// 26: SLA (IX+d)
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 27: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 28: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 29: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 2A: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 2B: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 2C: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 2D: -
+		{ M_SRA,		OP_IXD,			OP_NONE,		D_DISP			},		// 2E: SRA (IX+d)
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 2F: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 30: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 31: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 32: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 33: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 34: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 35: -
+		{ M_SLL,		OP_IXD,			OP_NONE,		D_DISP			},		// 36: SLL (IX+d)
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 37: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 38: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 39: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 3A: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 3B: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 3C: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 3D: -
+		{ M_SRL,		OP_IXD,			OP_NONE,		D_DISP			},		// 3E: SRL (IX+d)
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 3F: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 40: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 41: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 42: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 43: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 44: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 45: -
+		{ M_BIT,		OP_0,			OP_IXD,			D_DISP			},		// 46: BIT 0,(IX+d)
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 47: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 48: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 49: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 4A: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 4B: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 4C: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 4D: -
+		{ M_BIT,		OP_1,			OP_IXD,			D_DISP			},		// 4E: BIT 1,(IX+d)
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 4F: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 50: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 51: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 52: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 53: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 54: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 55: -
+		{ M_BIT,		OP_2,			OP_IXD,			D_DISP			},		// 56: BIT 2,(IX+d)
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 57: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 58: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 59: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 5A: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 5B: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 5C: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 5D: -
+		{ M_BIT,		OP_3,			OP_IXD,			D_DISP			},		// 5E: BIT 3,(IX+d)
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 5F: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 60: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 61: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 62: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 63: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 64: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 65: -
+		{ M_BIT,		OP_4,			OP_IXD,			D_DISP			},		// 66: BIT 4,(IX+d)
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 67: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 68: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 69: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 6A: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 6B: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 6C: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 6D: -
+		{ M_BIT,		OP_5,			OP_IXD,			D_DISP			},		// 6E: BIT 5,(IX+d)
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 6F: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 70: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 71: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 72: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 73: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 74: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 75: -
+		{ M_BIT,		OP_6,			OP_IXD,			D_DISP			},		// 76: BIT 6,(IX+d)
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 77: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 78: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 79: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 7A: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 7B: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 7C: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 7D: -
+		{ M_BIT,		OP_7,			OP_IXD,			D_DISP			},		// 7E: BIT 7,(IX+d)
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 7F: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 80: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 81: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 82: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 83: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 84: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 85: -
+		{ M_RES,		OP_0,			OP_IXD,			D_DISP			},		// 86: RES 0,(IX+d)
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 87: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 88: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 89: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 8A: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 8B: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 8C: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 8D: -
+		{ M_RES,		OP_1,			OP_IXD,			D_DISP			},		// 8E: RES 1,(IX+d)
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 8F: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 90: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 91: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 92: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 93: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 94: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 95: -
+		{ M_RES,		OP_2,			OP_IXD,			D_DISP			},		// 96: RES 2,(IX+d)
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 97: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 98: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 99: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 9A: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 9B: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 9C: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 9D: -
+		{ M_RES,		OP_3,			OP_IXD,			D_DISP			},		// 9E: RES 3,(IX+d)
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 9F: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// A0: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// A1: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// A2: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// A3: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// A4: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// A5: -
+		{ M_RES,		OP_4,			OP_IXD,			D_DISP			},		// A6: RES 4,(IX+d)
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// A7: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// A8: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// A9: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// AA: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// AB: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// AC: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// AD: -
+		{ M_RES,		OP_5,			OP_IXD,			D_DISP			},		// AE: RES 5,(IX+d)
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// AF: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// B0: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// B1: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// B2: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// B3: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// B4: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// B5: -
+		{ M_RES,		OP_6,			OP_IXD,			D_DISP			},		// B6: RES 6,(IX+d)
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// B7: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// B8: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// B9: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// BA: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// BB: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// BC: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// BD: -
+		{ M_RES,		OP_7,			OP_IXD,			D_DISP			},		// BE: RES 7,(IX+d)
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// BF: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// C0: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// C1: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// C2: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// C3: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// C4: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// C5: -
+		{ M_SET,		OP_0,			OP_IXD,			D_DISP			},		// C6: SET 0,(IX+d)
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// C7: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// C8: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// C9: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// CA: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// CB: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// CC: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// CD: -
+		{ M_SET,		OP_1,			OP_IXD,			D_DISP			},		// CE: SET 1,(IX+d)
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// CF: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// D0: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// D1: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// D2: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// D3: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// D4: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// D5: -
+		{ M_SET,		OP_2,			OP_IXD,			D_DISP			},		// D6: SET 2,(IX+d)
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// D7: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// D8: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// D9: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// DA: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// DB: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// DC: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// DD: -
+		{ M_SET,		OP_3,			OP_IXD,			D_DISP			},		// DE: SET 3,(IX+d)
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// DF: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// E0: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// E1: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// E2: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// E3: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// E4: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// E5: -
+		{ M_SET,		OP_4,			OP_IXD,			D_DISP			},		// E6: SET 4,(IX+d)
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// E7: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// E8: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// E9: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// EA: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// EB: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// EC: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// ED: -
+		{ M_SET,		OP_5,			OP_IXD,			D_DISP			},		// EE: SET 5,(IX+d)
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// EF: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// F0: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// F1: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// F2: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// F3: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// F4: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// F5: -
+		{ M_SET,		OP_6,			OP_IXD,			D_DISP			},		// F6: SET 6,(IX+d)
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// F7: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// F8: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// F9: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// FA: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// FB: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// FC: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// FD: -
+		{ M_SET,		OP_7,			OP_IXD,			D_DISP			},		// FE: SET 7,(IX+d)
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				} 		// FF: -
+	},
+	//
+	// FD CB d prefixed opcodes (rotates, shifts and bit operations on (IY+d))
+	//
+	{
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 00: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 01: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 02: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 03: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 04: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 05: -
+		{ M_RLC,		OP_IYD,			OP_NONE,		D_DISP			},		// 06: RLC (IY+d)
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 07: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 08: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 09: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 0A: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 0B: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 0C: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 0D: -
+		{ M_RRC,		OP_IYD,			OP_NONE,		D_DISP			},		// 0E: RRC (IY+d)
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 0F: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 10: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 11: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 12: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 13: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 14: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 15: -
+		{ M_RL,			OP_IYD,			OP_NONE,		D_DISP			},		// 16: RL (IY+d)
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 17: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 18: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 19: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 1A: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 1B: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 1C: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 1D: -
+		{ M_RR,			OP_IYD,			OP_NONE,		D_DISP			},		// 1E: RR (IY+d)
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 1F: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 20: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 21: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 22: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 23: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 24: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 25: -
+		{ M_SLA,		OP_IYD,			OP_NONE,		D_DISP			},		// 26: SLA (IY+d)
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 27: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 28: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 29: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 2A: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 2B: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 2C: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 2D: -
+		{ M_SRA,		OP_IYD,			OP_NONE,		D_DISP			},		// 2E: SRA (IY+d)
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 2F: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 30: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 31: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 32: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 33: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 34: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 35: -
+		{ M_SLL,		OP_IYD,			OP_NONE,		D_DISP			},		// 36: SLL (IY+d)
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 37: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 38: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 39: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 3A: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 3B: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 3C: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 3D: -
+		{ M_SRL,		OP_IYD,			OP_NONE,		D_DISP			},		// 3E: SRL (IY+d)
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 3F: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 40: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 41: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 42: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 43: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 44: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 45: -
+		{ M_BIT,		OP_0,			OP_IYD,			D_DISP			},		// 46: BIT 0,(IY+d)
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 47: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 48: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 49: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 4A: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 4B: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 4C: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 4D: -
+		{ M_BIT,		OP_1,			OP_IYD,			D_DISP			},		// 4E: BIT 1,(IY+d)
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 4F: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 50: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 51: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 52: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 53: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 54: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 55: -
+		{ M_BIT,		OP_2,			OP_IYD,			D_DISP			},		// 56: BIT 2,(IY+d)
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 57: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 58: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 59: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 5A: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 5B: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 5C: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 5D: -
+		{ M_BIT,		OP_3,			OP_IYD,			D_DISP			},		// 5E: BIT 3,(IY+d)
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 5F: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 60: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 61: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 62: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 63: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 64: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 65: -
+		{ M_BIT,		OP_4,			OP_IYD,			D_DISP			},		// 66: BIT 4,(IY+d)
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 67: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 68: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 69: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 6A: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 6B: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 6C: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 6D: -
+		{ M_BIT,		OP_5,			OP_IYD,			D_DISP			},		// 6E: BIT 5,(IY+d)
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 6F: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 70: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 71: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 72: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 73: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 74: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 75: -
+		{ M_BIT,		OP_6,			OP_IYD,			D_DISP			},		// 76: BIT 6,(IY+d)
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 77: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 78: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 79: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 7A: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 7B: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 7C: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 7D: -
+		{ M_BIT,		OP_7,			OP_IYD,			D_DISP			},		// 7E: BIT 7,(IY+d)
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 7F: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 80: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 81: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 82: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 83: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 84: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 85: -
+		{ M_RES,		OP_0,			OP_IYD,			D_DISP			},		// 86: RES 0,(IY+d)
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 87: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 88: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 89: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 8A: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 8B: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 8C: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 8D: -
+		{ M_RES,		OP_1,			OP_IYD,			D_DISP			},		// 8E: RES 1,(IY+d)
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 8F: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 90: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 91: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 92: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 93: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 94: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 95: -
+		{ M_RES,		OP_2,			OP_IYD,			D_DISP			},		// 96: RES 2,(IY+d)
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 97: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 98: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 99: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 9A: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 9B: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 9C: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 9D: -
+		{ M_RES,		OP_3,			OP_IYD,			D_DISP			},		// 9E: RES 3,(IY+d)
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// 9F: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// A0: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// A1: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// A2: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// A3: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// A4: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// A5: -
+		{ M_RES,		OP_4,			OP_IYD,			D_DISP			},		// A6: RES 4,(IY+d)
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// A7: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// A8: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// A9: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// AA: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// AB: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// AC: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// AD: -
+		{ M_RES,		OP_5,			OP_IYD,			D_DISP			},		// AE: RES 5,(IY+d)
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// AF: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// B0: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// B1: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// B2: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// B3: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// B4: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// B5: -
+		{ M_RES,		OP_6,			OP_IYD,			D_DISP			},		// B6: RES 6,(IY+d)
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// B7: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// B8: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// B9: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// BA: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// BB: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// BC: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// BD: -
+		{ M_RES,		OP_7,			OP_IYD,			D_DISP			},		// BE: RES 7,(IY+d)
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// BF: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// C0: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// C1: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// C2: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// C3: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// C4: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// C5: -
+		{ M_SET,		OP_0,			OP_IYD,			D_DISP			},		// C6: SET 0,(IY+d)
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// C7: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// C8: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// C9: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// CA: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// CB: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// CC: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// CD: -
+		{ M_SET,		OP_1,			OP_IYD,			D_DISP			},		// CE: SET 1,(IY+d)
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// CF: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// D0: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// D1: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// D2: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// D3: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// D4: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// D5: -
+		{ M_SET,		OP_2,			OP_IYD,			D_DISP			},		// D6: SET 2,(IY+d)
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// D7: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// D8: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// D9: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// DA: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// DB: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// DC: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// DD: -
+		{ M_SET,		OP_3,			OP_IYD,			D_DISP			},		// DE: SET 3,(IY+d)
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// DF: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// E0: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// E1: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// E2: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// E3: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// E4: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// E5: -
+		{ M_SET,		OP_4,			OP_IYD,			D_DISP			},		// E6: SET 4,(IY+d)
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// E7: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// E8: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// E9: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// EA: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// EB: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// EC: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// ED: -
+		{ M_SET,		OP_5,			OP_IYD,			D_DISP			},		// EE: SET 5,(IY+d)
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// EF: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// F0: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// F1: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// F2: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// F3: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// F4: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// F5: -
+		{ M_SET,		OP_6,			OP_IYD,			D_DISP			},		// F6: SET 6,(IY+d)
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// F7: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// F8: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// F9: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// FA: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// FB: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// FC: -
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				},		// FD: -
+		{ M_SET,		OP_7,			OP_IYD,			D_DISP			},		// FE: SET 7,(IY+d)
+		{ M_NONE,		OP_NONE,		OP_NONE,		0				} 		// FF: -
+	}
+};
+
+// The instruction length tables, indexed by T_* and then the opcode byte (see L_* in decode.h)
+//
+#define LW		L_WORD
+#define SIS		(L_SUFFIX | (AM_SIS << 5))
+#define LIS		(L_SUFFIX | (AM_LIS << 5))
+#define SIL		(L_SUFFIX | (AM_SIL << 5))
+#define LIL		(L_SUFFIX | (AM_LIL << 5))
+#define PCB		(L_PREFIX | (T_CB << 5))
+#define PED		(L_PREFIX | (T_ED << 5))
+#define PDD		(L_PREFIX | (T_DD << 5))
+#define PFD		(L_PREFIX | (T_FD << 5))
+#define PXC		(L_PREFIX | (T_DDCB << 5))
+#define PYC		(L_PREFIX | (T_FDCB << 5))
+
+const unsigned char t_length[T_COUNT][256] = {
+	//
+	// Unprefixed opcodes
+	//
+	{
+		0,   LW,  0,   0,   0,   0,   1,   0,   0,   0,   0,   0,   0,   0,   1,   0,	// 00-0F
+		1,   LW,  0,   0,   0,   0,   1,   0,   1,   0,   0,   0,   0,   0,   1,   0,	// 10-1F
+		1,   LW,  LW,  0,   0,   0,   1,   0,   1,   0,   LW,  0,   0,   0,   1,   0,	// 20-2F
+		1,   LW,  LW,  0,   0,   0,   1,   0,   1,   0,   LW,  0,   0,   0,   1,   0,	// 30-3F
+		SIS, 0,   0,   0,   0,   0,   0,   0,   0,   LIS, 0,   0,   0,   0,   0,   0,	// 40-4F
+		0,   0,   SIL, 0,   0,   0,   0,   0,   0,   0,   0,   LIL, 0,   0,   0,   0,	// 50-5F
+		0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,	// 60-6F
+		0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,	// 70-7F
+		0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,	// 80-8F
+		0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,	// 90-9F
+		0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,	// A0-AF
+		0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,	// B0-BF
+		0,   0,   LW,  LW,  LW,  0,   1,   0,   0,   0,   LW,  PCB, LW,  LW,  1,   0,	// C0-CF
+		0,   0,   LW,  1,   LW,  0,   1,   0,   0,   0,   LW,  1,   LW,  PDD, 1,   0,	// D0-DF
+		0,   0,   LW,  0,   LW,  0,   1,   0,   0,   0,   LW,  0,   LW,  PED, 1,   0,	// E0-EF
+		0,   0,   LW,  0,   LW,  0,   1,   0,   0,   0,   LW,  0,   LW,  PFD, 1,   0	// F0-FF
+	},
+	//
+	// CB prefixed opcodes (rotates, shifts and bit operations)
+	//
+	{
+		0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,	// 00-0F
+		0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,	// 10-1F
+		0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,	// 20-2F
+		0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,	// 30-3F
+		0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,	// 40-4F
+		0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,	// 50-5F
+		0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,	// 60-6F
+		0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,	// 70-7F
+		0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,	// 80-8F
+		0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,	// 90-9F
+		0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,	// A0-AF
+		0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,	// B0-BF
+		0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,	// C0-CF
+		0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,	// D0-DF
+		0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,	// E0-EF
+		0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0	// F0-FF
+	},
+	//
+	// ED prefixed opcodes (miscellaneous and eZ80 extensions)
+	//
+	{
+		1,   1,   1,   1,   0,   0,   0,   0,   1,   1,   0,   0,   0,   0,   0,   0,	// 00-0F
+		1,   1,   1,   1,   0,   0,   0,   0,   1,   1,   0,   0,   0,   0,   0,   0,	// 10-1F
+		1,   1,   1,   1,   0,   0,   0,   0,   1,   1,   0,   0,   0,   0,   0,   0,	// 20-2F
+		1,   0,   1,   1,   0,   0,   0,   0,   1,   1,   0,   0,   0,   0,   0,   0,	// 30-3F
+		0,   0,   0,   LW,  0,   0,   0,   0,   0,   0,   0,   LW,  0,   0,   0,   0,	// 40-4F
+		0,   0,   0,   LW,  1,   1,   0,   0,   0,   0,   0,   LW,  0,   0,   0,   0,	// 50-5F
+		0,   0,   0,   LW,  1,   1,   1,   0,   0,   0,   0,   LW,  0,   0,   0,   0,	// 60-6F
+		0,   0,   0,   LW,  1,   0,   0,   0,   0,   0,   0,   LW,  0,   0,   0,   0,	// 70-7F
+		0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,	// 80-8F
+		0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,	// 90-9F
+		0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,	// A0-AF
+		0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,	// B0-BF
+		0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,	// C0-CF
+		0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,	// D0-DF
+		0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,	// E0-EF
+		0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0	// F0-FF
+	},
+	//
+	// DD prefixed opcodes (IX)
+	//
+	{
+		0,   LW,  0,   0,   0,   0,   1,   1,   0,   0,   0,   0,   0,   0,   1,   1,	// 00-0F
+		1,   LW,  0,   0,   0,   0,   1,   1,   1,   0,   0,   0,   0,   0,   1,   1,	// 10-1F
+		1,   LW,  LW,  0,   0,   0,   1,   1,   1,   0,   LW,  0,   0,   0,   1,   1,	// 20-2F
+		1,   1,   LW,  0,   1,   1,   2,   1,   1,   0,   LW,  0,   0,   0,   1,   1,	// 30-3F
+		0,   0,   0,   0,   0,   0,   1,   0,   0,   0,   0,   0,   0,   0,   1,   0,	// 40-4F
+		0,   0,   0,   0,   0,   0,   1,   0,   0,   0,   0,   0,   0,   0,   1,   0,	// 50-5F
+		0,   0,   0,   0,   0,   0,   1,   0,   0,   0,   0,   0,   0,   0,   1,   0,	// 60-6F
+		1,   1,   1,   1,   1,   1,   0,   1,   0,   0,   0,   0,   0,   0,   1,   0,	// 70-7F
+		0,   0,   0,   0,   0,   0,   1,   0,   0,   0,   0,   0,   0,   0,   1,   0,	// 80-8F
+		0,   0,   0,   0,   0,   0,   1,   0,   0,   0,   0,   0,   0,   0,   1,   0,	// 90-9F
+		0,   0,   0,   0,   0,   0,   1,   0,   0,   0,   0,   0,   0,   0,   1,   0,	// A0-AF
+		0,   0,   0,   0,   0,   0,   1,   0,   0,   0,   0,   0,   0,   0,   1,   0,	// B0-BF
+		0,   0,   LW,  LW,  LW,  0,   1,   0,   0,   0,   LW,  PXC, LW,  LW,  1,   0,	// C0-CF
+		0,   0,   LW,  1,   LW,  0,   1,   0,   0,   0,   LW,  1,   LW,  0,   1,   0,	// D0-DF
+		0,   0,   LW,  0,   LW,  0,   1,   0,   0,   0,   LW,  0,   LW,  0,   1,   0,	// E0-EF
+		0,   0,   LW,  0,   LW,  0,   1,   0,   0,   0,   LW,  0,   LW,  0,   1,   0	// F0-FF
+	},
+	//
+	// FD prefixed opcodes (IY)
+	//
+	{
+		0,   LW,  0,   0,   0,   0,   1,   1,   0,   0,   0,   0,   0,   0,   1,   1,	// 00-0F
+		1,   LW,  0,   0,   0,   0,   1,   1,   1,   0,   0,   0,   0,   0,   1,   1,	// 10-1F
+		1,   LW,  LW,  0,   0,   0,   1,   1,   1,   0,   LW,  0,   0,   0,   1,   1,	// 20-2F
+		1,   1,   LW,  0,   1,   1,   2,   1,   1,   0,   LW,  0,   0,   0,   1,   1,	// 30-3F
+		0,   0,   0,   0,   0,   0,   1,   0,   0,   0,   0,   0,   0,   0,   1,   0,	// 40-4F
+		0,   0,   0,   0,   0,   0,   1,   0,   0,   0,   0,   0,   0,   0,   1,   0,	// 50-5F
+		0,   0,   0,   0,   0,   0,   1,   0,   0,   0,   0,   0,   0,   0,   1,   0,	// 60-6F
+		1,   1,   1,   1,   1,   1,   0,   1,   0,   0,   0,   0,   0,   0,   1,   0,	// 70-7F
+		0,   0,   0,   0,   0,   0,   1,   0,   0,   0,   0,   0,   0,   0,   1,   0,	// 80-8F
+		0,   0,   0,   0,   0,   0,   1,   0,   0,   0,   0,   0,   0,   0,   1,   0,	// 90-9F
+		0,   0,   0,   0,   0,   0,   1,   0,   0,   0,   0,   0,   0,   0,   1,   0,	// A0-AF
+		0,   0,   0,   0,   0,   0,   1,   0,   0,   0,   0,   0,   0,   0,   1,   0,	// B0-BF
+		0,   0,   LW,  LW,  LW,  0,   1,   0,   0,   0,   LW,  PYC, LW,  LW,  1,   0,	// C0-CF
+		0,   0,   LW,  1,   LW,  0,   1,   0,   0,   0,   LW,  1,   LW,  0,   1,   0,	// D0-DF
+		0,   0,   LW,  0,   LW,  0,   1,   0,   0,   0,   LW,  0,   LW,  0,   1,   0,	// E0-EF
+		0,   0,   LW,  0,   LW,  0,   1,   0,   0,   0,   LW,  0,   LW,  0,   1,   0	// F0-FF
+	},
+	//
+	// DD CB d prefixed opcodes (rotates, shifts and bit operations on (IX+d))
+	//
+	{
+		0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,	// 00-0F
+		0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,	// 10-1F
+		0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,	// 20-2F
+		0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,	// 30-3F
+		0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,	// 40-4F
+		0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,	// 50-5F
+		0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,	// 60-6F
+		0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,	// 70-7F
+		0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,	// 80-8F
+		0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,	// 90-9F
+		0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,	// A0-AF
+		0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,	// B0-BF
+		0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,	// C0-CF
+		0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,	// D0-DF
+		0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,	// E0-EF
+		0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0	// F0-FF
+	},
+	//
+	// FD CB d prefixed opcodes (rotates, shifts and bit operations on (IY+d))
+	//
+	{
+		0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,	// 00-0F
+		0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,	// 10-1F
+		0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,	// 20-2F
+		0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,	// 30-3F
+		0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,	// 40-4F
+		0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,	// 50-5F
+		0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,	// 60-6F
+		0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,	// 70-7F
+		0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,	// 80-8F
+		0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,	// 90-9F
+		0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,	// A0-AF
+		0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,	// B0-BF
+		0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,	// C0-CF
+		0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,	// D0-DF
+		0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,	// E0-EF
+		0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0	// F0-FF
+	}
+};
+
+// The size of each unprefixed instruction in Z80 mode [0] and ADL mode [1], for the lengths that
+// follow from the first byte alone; 0 for a prefix or suffix, which needs t_length
+//
+const unsigned char t_size[2][256] = {
+	//
+	// Z80 mode
+	//
+	{
+		1,   3,   1,   1,   1,   1,   2,   1,   1,   1,   1,   1,   1,   1,   2,   1,	// 00-0F
+		2,   3,   1,   1,   1,   1,   2,   1,   2,   1,   1,   1,   1,   1,   2,   1,	// 10-1F
+		2,   3,   3,   1,   1,   1,   2,   1,   2,   1,   3,   1,   1,   1,   2,   1,	// 20-2F
+		2,   3,   3,   1,   1,   1,   2,   1,   2,   1,   3,   1,   1,   1,   2,   1,	// 30-3F
+		0,   1,   1,   1,   1,   1,   1,   1,   1,   0,   1,   1,   1,   1,   1,   1,	// 40-4F
+		1,   1,   0,   1,   1,   1,   1,   1,   1,   1,   1,   0,   1,   1,   1,   1,	// 50-5F
+		1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,	// 60-6F
+		1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,	// 70-7F
+		1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,	// 80-8F
+		1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,	// 90-9F
+		1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,	// A0-AF
+		1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,	// B0-BF
+		1,   1,   3,   3,   3,   1,   2,   1,   1,   1,   3,   0,   3,   3,   2,   1,	// C0-CF
+		1,   1,   3,   2,   3,   1,   2,   1,   1,   1,   3,   2,   3,   0,   2,   1,	// D0-DF
+		1,   1,   3,   1,   3,   1,   2,   1,   1,   1,   3,   1,   3,   0,   2,   1,	// E0-EF
+		1,   1,   3,   1,   3,   1,   2,   1,   1,   1,   3,   1,   3,   0,   2,   1	// F0-FF
+	},
+	//
+	// ADL mode
+	//
+	{
+		1,   4,   1,   1,   1,   1,   2,   1,   1,   1,   1,   1,   1,   1,   2,   1,	// 00-0F
+		2,   4,   1,   1,   1,   1,   2,   1,   2,   1,   1,   1,   1,   1,   2,   1,	// 10-1F
+		2,   4,   4,   1,   1,   1,   2,   1,   2,   1,   4,   1,   1,   1,   2,   1,	// 20-2F
+		2,   4,   4,   1,   1,   1,   2,   1,   2,   1,   4,   1,   1,   1,   2,   1,	// 30-3F
+		0,   1,   1,   1,   1,   1,   1,   1,   1,   0,   1,   1,   1,   1,   1,   1,	// 40-4F
+		1,   1,   0,   1,   1,   1,   1,   1,   1,   1,   1,   0,   1,   1,   1,   1,	// 50-5F
+		1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,	// 60-6F
+		1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,	// 70-7F
+		1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,	// 80-8F
+		1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,	// 90-9F
+		1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,	// A0-AF
+		1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,	// B0-BF
+		1,   1,   4,   4,   4,   1,   2,   1,   1,   1,   4,   0,   4,   4,   2,   1,	// C0-CF
+		1,   1,   4,   2,   4,   1,   2,   1,   1,   1,   4,   2,   4,   0,   2,   1,	// D0-DF
+		1,   1,   4,   1,   4,   1,   2,   1,   1,   1,   4,   1,   4,   0,   2,   1,	// E0-EF
+		1,   1,   4,   1,   4,   1,   2,   1,   1,   1,   4,   1,   4,   0,   2,   1	// F0-FF
+	}
+};
+
+// The size of each instruction after a CB, ED, DD or FD prefix, including the prefix, for words of
+// 2 bytes [0] and 3 bytes [1], then indexed by the prefix's table less T_CB and the opcode byte;
+// DD CB d op and FD CB d op are 4 bytes
+//
+const unsigned char t_sizePrefixed[2][4][256] = {
+	{
+		//
+		// CB, 2 byte words
+		//
+		{
+			2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,	// 00-0F
+			2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,	// 10-1F
+			2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,	// 20-2F
+			2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,	// 30-3F
+			2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,	// 40-4F
+			2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,	// 50-5F
+			2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,	// 60-6F
+			2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,	// 70-7F
+			2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,	// 80-8F
+			2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,	// 90-9F
+			2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,	// A0-AF
+			2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,	// B0-BF
+			2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,	// C0-CF
+			2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,	// D0-DF
+			2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,	// E0-EF
+			2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2	// F0-FF
+		},
+		//
+		// ED, 2 byte words
+		//
+		{
+			3,   3,   3,   3,   2,   2,   2,   2,   3,   3,   2,   2,   2,   2,   2,   2,	// 00-0F
+			3,   3,   3,   3,   2,   2,   2,   2,   3,   3,   2,   2,   2,   2,   2,   2,	// 10-1F
+			3,   3,   3,   3,   2,   2,   2,   2,   3,   3,   2,   2,   2,   2,   2,   2,	// 20-2F
+			3,   2,   3,   3,   2,   2,   2,   2,   3,   3,   2,   2,   2,   2,   2,   2,	// 30-3F
+			2,   2,   2,   4,   2,   2,   2,   2,   2,   2,   2,   4,   2,   2,   2,   2,	// 40-4F
+			2,   2,   2,   4,   3,   3,   2,   2,   2,   2,   2,   4,   2,   2,   2,   2,	// 50-5F
+			2,   2,   2,   4,   3,   3,   3,   2,   2,   2,   2,   4,   2,   2,   2,   2,	// 60-6F
+			2,   2,   2,   4,   3,   2,   2,   2,   2,   2,   2,   4,   2,   2,   2,   2,	// 70-7F
+			2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,	// 80-8F
+			2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,	// 90-9F
+			2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,	// A0-AF
+			2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,	// B0-BF
+			2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,	// C0-CF
+			2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,	// D0-DF
+			2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,	// E0-EF
+			2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2	// F0-FF
+		},
+		//
+		// DD, 2 byte words
+		//
+		{
+			2,   4,   2,   2,   2,   2,   3,   3,   2,   2,   2,   2,   2,   2,   3,   3,	// 00-0F
+			3,   4,   2,   2,   2,   2,   3,   3,   3,   2,   2,   2,   2,   2,   3,   3,	// 10-1F
+			3,   4,   4,   2,   2,   2,   3,   3,   3,   2,   4,   2,   2,   2,   3,   3,	// 20-2F
+			3,   3,   4,   2,   3,   3,   4,   3,   3,   2,   4,   2,   2,   2,   3,   3,	// 30-3F
+			2,   2,   2,   2,   2,   2,   3,   2,   2,   2,   2,   2,   2,   2,   3,   2,	// 40-4F
+			2,   2,   2,   2,   2,   2,   3,   2,   2,   2,   2,   2,   2,   2,   3,   2,	// 50-5F
+			2,   2,   2,   2,   2,   2,   3,   2,   2,   2,   2,   2,   2,   2,   3,   2,	// 60-6F
+			3,   3,   3,   3,   3,   3,   2,   3,   2,   2,   2,   2,   2,   2,   3,   2,	// 70-7F
+			2,   2,   2,   2,   2,   2,   3,   2,   2,   2,   2,   2,   2,   2,   3,   2,	// 80-8F
+			2,   2,   2,   2,   2,   2,   3,   2,   2,   2,   2,   2,   2,   2,   3,   2,	// 90-9F
+			2,   2,   2,   2,   2,   2,   3,   2,   2,   2,   2,   2,   2,   2,   3,   2,	// A0-AF
+			2,   2,   2,   2,   2,   2,   3,   2,   2,   2,   2,   2,   2,   2,   3,   2,	// B0-BF
+			2,   2,   4,   4,   4,   2,   3,   2,   2,   2,   4,   4,   4,   4,   3,   2,	// C0-CF
+			2,   2,   4,   3,   4,   2,   3,   2,   2,   2,   4,   3,   4,   2,   3,   2,	// D0-DF
+			2,   2,   4,   2,   4,   2,   3,   2,   2,   2,   4,   2,   4,   2,   3,   2,	// E0-EF
+			2,   2,   4,   2,   4,   2,   3,   2,   2,   2,   4,   2,   4,   2,   3,   2	// F0-FF
+		},
+		//
+		// FD, 2 byte words
+		//
+		{
+			2,   4,   2,   2,   2,   2,   3,   3,   2,   2,   2,   2,   2,   2,   3,   3,	// 00-0F
+			3,   4,   2,   2,   2,   2,   3,   3,   3,   2,   2,   2,   2,   2,   3,   3,	// 10-1F
+			3,   4,   4,   2,   2,   2,   3,   3,   3,   2,   4,   2,   2,   2,   3,   3,	// 20-2F
+			3,   3,   4,   2,   3,   3,   4,   3,   3,   2,   4,   2,   2,   2,   3,   3,	// 30-3F
+			2,   2,   2,   2,   2,   2,   3,   2,   2,   2,   2,   2,   2,   2,   3,   2,	// 40-4F
+			2,   2,   2,   2,   2,   2,   3,   2,   2,   2,   2,   2,   2,   2,   3,   2,	// 50-5F
+			2,   2,   2,   2,   2,   2,   3,   2,   2,   2,   2,   2,   2,   2,   3,   2,	// 60-6F
+			3,   3,   3,   3,   3,   3,   2,   3,   2,   2,   2,   2,   2,   2,   3,   2,	// 70-7F
+			2,   2,   2,   2,   2,   2,   3,   2,   2,   2,   2,   2,   2,   2,   3,   2,	// 80-8F
+			2,   2,   2,   2,   2,   2,   3,   2,   2,   2,   2,   2,   2,   2,   3,   2,	// 90-9F
+			2,   2,   2,   2,   2,   2,   3,   2,   2,   2,   2,   2,   2,   2,   3,   2,	// A0-AF
+			2,   2,   2,   2,   2,   2,   3,   2,   2,   2,   2,   2,   2,   2,   3,   2,	// B0-BF
+			2,   2,   4,   4,   4,   2,   3,   2,   2,   2,   4,   4,   4,   4,   3,   2,	// C0-CF
+			2,   2,   4,   3,   4,   2,   3,   2,   2,   2,   4,   3,   4,   2,   3,   2,	// D0-DF
+			2,   2,   4,   2,   4,   2,   3,   2,   2,   2,   4,   2,   4,   2,   3,   2,	// E0-EF
+			2,   2,   4,   2,   4,   2,   3,   2,   2,   2,   4,   2,   4,   2,   3,   2	// F0-FF
+		}
+	},
+	{
+		//
+		// CB, 3 byte words
+		//
+		{
+			2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,	// 00-0F
+			2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,	// 10-1F
+			2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,	// 20-2F
+			2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,	// 30-3F
+			2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,	// 40-4F
+			2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,	// 50-5F
+			2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,	// 60-6F
+			2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,	// 70-7F
+			2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,	// 80-8F
+			2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,	// 90-9F
+			2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,	// A0-AF
+			2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,	// B0-BF
+			2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,	// C0-CF
+			2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,	// D0-DF
+			2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,	// E0-EF
+			2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2	// F0-FF
+		},
+		//
+		// ED, 3 byte words
+		//
+		{
+			3,   3,   3,   3,   2,   2,   2,   2,   3,   3,   2,   2,   2,   2,   2,   2,	// 00-0F
+			3,   3,   3,   3,   2,   2,   2,   2,   3,   3,   2,   2,   2,   2,   2,   2,	// 10-1F
+			3,   3,   3,   3,   2,   2,   2,   2,   3,   3,   2,   2,   2,   2,   2,   2,	// 20-2F
+			3,   2,   3,   3,   2,   2,   2,   2,   3,   3,   2,   2,   2,   2,   2,   2,	// 30-3F
+			2,   2,   2,   5,   2,   2,   2,   2,   2,   2,   2,   5,   2,   2,   2,   2,	// 40-4F
+			2,   2,   2,   5,   3,   3,   2,   2,   2,   2,   2,   5,   2,   2,   2,   2,	// 50-5F
+			2,   2,   2,   5,   3,   3,   3,   2,   2,   2,   2,   5,   2,   2,   2,   2,	// 60-6F
+			2,   2,   2,   5,   3,   2,   2,   2,   2,   2,   2,   5,   2,   2,   2,   2,	// 70-7F
+			2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,	// 80-8F
+			2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,	// 90-9F
+			2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,	// A0-AF
+			2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,	// B0-BF
+			2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,	// C0-CF
+			2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,	// D0-DF
+			2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,	// E0-EF
+			2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2	// F0-FF
+		},
+		//
+		// DD, 3 byte words
+		//
+		{
+			2,   5,   2,   2,   2,   2,   3,   3,   2,   2,   2,   2,   2,   2,   3,   3,	// 00-0F
+			3,   5,   2,   2,   2,   2,   3,   3,   3,   2,   2,   2,   2,   2,   3,   3,	// 10-1F
+			3,   5,   5,   2,   2,   2,   3,   3,   3,   2,   5,   2,   2,   2,   3,   3,	// 20-2F
+			3,   3,   5,   2,   3,   3,   4,   3,   3,   2,   5,   2,   2,   2,   3,   3,	// 30-3F
+			2,   2,   2,   2,   2,   2,   3,   2,   2,   2,   2,   2,   2,   2,   3,   2,	// 40-4F
+			2,   2,   2,   2,   2,   2,   3,   2,   2,   2,   2,   2,   2,   2,   3,   2,	// 50-5F
+			2,   2,   2,   2,   2,   2,   3,   2,   2,   2,   2,   2,   2,   2,   3,   2,	// 60-6F
+			3,   3,   3,   3,   3,   3,   2,   3,   2,   2,   2,   2,   2,   2,   3,   2,	// 70-7F
+			2,   2,   2,   2,   2,   2,   3,   2,   2,   2,   2,   2,   2,   2,   3,   2,	// 80-8F
+			2,   2,   2,   2,   2,   2,   3,   2,   2,   2,   2,   2,   2,   2,   3,   2,	// 90-9F
+			2,   2,   2,   2,   2,   2,   3,   2,   2,   2,   2,   2,   2,   2,   3,   2,	// A0-AF
+			2,   2,   2,   2,   2,   2,   3,   2,   2,   2,   2,   2,   2,   2,   3,   2,	// B0-BF
+			2,   2,   5,   5,   5,   2,   3,   2,   2,   2,   5,   4,   5,   5,   3,   2,	// C0-CF
+			2,   2,   5,   3,   5,   2,   3,   2,   2,   2,   5,   3,   5,   2,   3,   2,	// D0-DF
+			2,   2,   5,   2,   5,   2,   3,   2,   2,   2,   5,   2,   5,   2,   3,   2,	// E0-EF
+			2,   2,   5,   2,   5,   2,   3,   2,   2,   2,   5,   2,   5,   2,   3,   2	// F0-FF
+		},
+		//
+		// FD, 3 byte words
+		//
+		{
+			2,   5,   2,   2,   2,   2,   3,   3,   2,   2,   2,   2,   2,   2,   3,   3,	// 00-0F
+			3,   5,   2,   2,   2,   2,   3,   3,   3,   2,   2,   2,   2,   2,   3,   3,	// 10-1F
+			3,   5,   5,   2,   2,   2,   3,   3,   3,   2,   5,   2,   2,   2,   3,   3,	// 20-2F
+			3,   3,   5,   2,   3,   3,   4,   3,   3,   2,   5,   2,   2,   2,   3,   3,	// 30-3F
+			2,   2,   2,   2,   2,   2,   3,   2,   2,   2,   2,   2,   2,   2,   3,   2,	// 40-4F
+			2,   2,   2,   2,   2,   2,   3,   2,   2,   2,   2,   2,   2,   2,   3,   2,	// 50-5F
+			2,   2,   2,   2,   2,   2,   3,   2,   2,   2,   2,   2,   2,   2,   3,   2,	// 60-6F
+			3,   3,   3,   3,   3,   3,   2,   3,   2,   2,   2,   2,   2,   2,   3,   2,	// 70-7F
+			2,   2,   2,   2,   2,   2,   3,   2,   2,   2,   2,   2,   2,   2,   3,   2,	// 80-8F
+			2,   2,   2,   2,   2,   2,   3,   2,   2,   2,   2,   2,   2,   2,   3,   2,	// 90-9F
+			2,   2,   2,   2,   2,   2,   3,   2,   2,   2,   2,   2,   2,   2,   3,   2,	// A0-AF
+			2,   2,   2,   2,   2,   2,   3,   2,   2,   2,   2,   2,   2,   2,   3,   2,	// B0-BF
+			2,   2,   5,   5,   5,   2,   3,   2,   2,   2,   5,   4,   5,   5,   3,   2,	// C0-CF
+			2,   2,   5,   3,   5,   2,   3,   2,   2,   2,   5,   3,   5,   2,   3,   2,	// D0-DF
+			2,   2,   5,   2,   5,   2,   3,   2,   2,   2,   5,   2,   5,   2,   3,   2,	// E0-EF
+			2,   2,   5,   2,   5,   2,   3,   2,   2,   2,   5,   2,   5,   2,   3,   2	// F0-FF
+		}
+	}
+};
@@ -0,0 +1,380 @@
+/*
+ * Title:			Disassembler - Cross-references (host build)
+ * Author:			Dean Belfield
+ * Created:			17/10/2026
+ * Last Updated:	17/10/2026
+ *
+ * Collects the addresses referred to by jumps, calls and memory accesses, so that they can be
+ * listed with labels
+ *
+ * Modinfo:
+ * 17/10/2026:		Targets with a symbol are listed by name
+ * 17/10/2026:		Added xrefTarget
+ * 17/10/2026:		Added xrefInsert, xrefRemove and xrefRelabel, to update the sorted index
+ * 17/10/2026:		A RST target is in the mode its suffix sets, as flow mode traces it
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "decode.h"
+#include "format.h"
+#include "symbol.h"
+#include "xref.h"
+
+#define XREF_PER_LINE	6			// Number of references listed on each line of the index
+
+struct s_xref	xref;
+
+static const char	t_xref[] = "CJRW";	// Tag for each XREF_* type in the index
+
+static void	xrefPut(long target, long source, int type);
+static int	xrefGrow(void);
+static long	xrefSearch(long target, long source);
+static int	xrefCompare(const void * a, const void * b);
+
+// Start collecting references
+//
+void xrefOpen(void) {
+	memset(&xref, 0, sizeof(xref));
+	xref.enabled = 1;
+}
+
+// Free the index
+//
+void xrefClose(void) {
+	free(xref.ref);
+	free(xref.label);
+	memset(&xref, 0, sizeof(xref));
+}
+
+// Add the reference made by a decoded instruction to the index
+// Parameters:
+// - opcode: The decoded instruction
+//
+void xrefAdd(struct s_opcode * opcode) {
+	long	target;
+	int		type;
+
+	if(!xref.enabled || xref.sorted) {
+		return;
+	}
+	type = xrefTarget(opcode, &target);
+	if(type >= 0) {
+		xrefPut(target, opcode->address, type);
+	}
+}
+
+// Get the address a decoded instruction refers to
+// Parameters:
+// - opcode: The decoded instruction
+// - target: Pointer to the storage for the address
+// Returns:
+// - int: XREF_*, or -1 if the instruction doesn't refer to an address
+//
+int xrefTarget(struct s_opcode * opcode, long * target) {
+	const struct s_decode *	d = opcode->decode;
+
+	switch(d->mnemonic) {
+		case M_CALL:
+		case M_JP:
+		case M_JR:
+		case M_DJNZ: {
+			if(d->operand1 == OP_NN || d->operand1 == OP_REL) {
+				*target = opcode->value[0];
+			}
+			else if(d->operand2 == OP_NN || d->operand2 == OP_REL) {
+				*target = opcode->value[1];
+			}
+			else {
+				return -1;
+			}
+			return d->mnemonic == M_CALL ? XREF_CALL : XREF_JUMP;
+		} break;
+		case M_RST: {
+			*target = decodeRestart(opcode, adl);
+			return XREF_CALL;
+		} break;
+		case M_DB: {
+			return -1;
+		} break;
+	}
+	if(d->operand1 == OP_INN) {
+		*target = opcode->value[0];
+		return XREF_WRITE;
+	}
+	if(d->operand2 == OP_INN) {
+		*target = opcode->value[1];
+		return XREF_READ;
+	}
+	return -1;
+}
+
+// Sort the index and pick the addresses to list with labels. Once sorted, no more references
+// are collected
+// Parameters:
+// - defined: Function that returns non-zero if a line of the listing starts at an address
+// Returns:
+// - 1: OK
+// - 0: Out of memory
+//
+int xrefSort(int (* defined)(long address)) {
+	long	i;
+
+	qsort(xref.ref, xref.count, sizeof(struct s_ref), xrefCompare);
+	xref.sorted = 1;
+	xref.labelMax = xref.count > 0 ? xref.count : 1;
+	xref.label = malloc(xref.labelMax * sizeof(long));
+	if(xref.label == NULL) {
+		return 0;
+	}
+	for(i = 0; i < xref.count; i++) {
+		if(i > 0 && xref.ref[i].target == xref.ref[i - 1].target) {
+			continue;
+		}
+		if(defined(xref.ref[i].target)) {
+			xref.label[xref.labels++] = xref.ref[i].target;
+		}
+	}
+	return 1;
+}
+
+// Add the reference made by a decoded instruction to the sorted index, in its place
+// Parameters:
+// - opcode: The decoded instruction
+//
+void xrefInsert(struct s_opcode * opcode) {
+	long	target, i;
+	int		type;
+
+	if(!xref.enabled || !xref.sorted) {
+		return;
+	}
+	type = xrefTarget(opcode, &target);
+	if(type < 0 || !xrefGrow()) {
+		return;
+	}
+	i = xrefSearch(target, opcode->address);
+	memmove(&xref.ref[i + 1], &xref.ref[i], (xref.count - i) * sizeof(struct s_ref));
+	xref.ref[i].target = target;
+	xref.ref[i].source = opcode->address;
+	xref.ref[i].type = type;
+	xref.count++;
+}
+
+// Remove the reference made by a decoded instruction from the sorted index
+// Parameters:
+// - opcode: The decoded instruction, as it was when the reference was added
+//
+void xrefRemove(struct s_opcode * opcode) {
+	long	target, i;
+
+	if(!xref.sorted || xrefTarget(opcode, &target) < 0) {
+		return;
+	}
+	i = xrefSearch(target, opcode->address);
+	if(i < xref.count && xref.ref[i].target == target && xref.ref[i].source == opcode->address) {
+		memmove(&xref.ref[i], &xref.ref[i + 1], (xref.count - i - 1) * sizeof(struct s_ref));
+		xref.count--;
+	}
+}
+
+// Work out again whether an address is listed with a label, after references to it have been
+// added or removed, or the lines of the listing around it have changed
+// Parameters:
+// - target: The address
+// - defined: Function that returns non-zero if a line of the listing starts at an address
+// Returns:
+// - 1: OK
+// - 0: Out of memory
+//
+int xrefRelabel(long target, int (* defined)(long address)) {
+	long *	label;
+	long	lo = 0;
+	long	hi = xref.labels;
+	long	mid, max;
+	int		listed;
+
+	if(!xref.sorted) {
+		return 1;
+	}
+	while(lo < hi) {
+		mid = (lo + hi) / 2;
+		if(xref.label[mid] < target) lo = mid + 1;
+		else hi = mid;
+	}
+	listed = xrefFind(target) >= 0 && defined(target);
+	if(lo < xref.labels && xref.label[lo] == target) {
+		if(!listed) {
+			memmove(&xref.label[lo], &xref.label[lo + 1], (xref.labels - lo - 1) * sizeof(long));
+			xref.labels--;
+		}
+	}
+	else if(listed) {
+		if(xref.labels == xref.labelMax) {
+			max = xref.labelMax * 2;
+			label = realloc(xref.label, max * sizeof(long));
+			if(label == NULL) {
+				return 0;
+			}
+			xref.label = label;
+			xref.labelMax = max;
+		}
+		memmove(&xref.label[lo + 1], &xref.label[lo], (xref.labels - lo) * sizeof(long));
+		xref.label[lo] = target;
+		xref.labels++;
+	}
+	return 1;
+}
+
+// Find the first reference to an address
+// Parameters:
+// - target: The address
+// Returns:
+// - long: Index of the reference in xref.ref, or -1 if there are none
+//
+long xrefFind(long target) {
+	long	lo = 0;
+	long	hi = xref.count;
+	long	mid;
+
+	if(!xref.sorted) {
+		return -1;
+	}
+	while(lo < hi) {
+		mid = (lo + hi) / 2;
+		if(xref.ref[mid].target < target) lo = mid + 1;
+		else hi = mid;
+	}
+	return lo < xref.count && xref.ref[lo].target == target ? lo : -1;
+}
+
+// Check whether an address is listed with a label
+// Parameters:
+// - address: The address
+// Returns:
+// - 1: It is
+// - 0: It isn't, or the index hasn't been sorted yet
+//
+int xrefLabel(long address) {
+	long	lo = 0;
+	long	hi = xref.labels - 1;
+	long	mid;
+
+	while(lo <= hi) {
+		mid = (lo + hi) / 2;
+		if(xref.label[mid] < address) lo = mid + 1;
+		else if(xref.label[mid] > address) hi = mid - 1;
+		else return 1;
+	}
+	return 0;
+}
+
+// Build a line of the index: the target (as a label or symbol if it has one), then the tag and address
+// of up to XREF_PER_LINE of the instructions that refer to it
+// Parameters:
+// - t: Pointer to the line buffer (at least FORMAT_LINE_MAX bytes)
+// - index: Index of the first reference to list
+// - next: Pointer to the index of the first reference for the next line
+// Returns:
+// - int: Length of the line in bytes, excluding the terminator
+//
+int xrefFormat(char * t, long index, long * next) {
+	char *	s = t;
+	long	target = xref.ref[index].target;
+	int		i;
+
+	if(xrefLabel(target) || symbolFind(target)) {
+		t = formatLabel(t, target);
+	}
+	else {
+		*t++ = '&';
+		t = formatHex(t, target, 6);
+	}
+	for(i = 0; i < XREF_PER_LINE && index < xref.count && xref.ref[index].target == target; i++, index++) {
+		*t++ = ' ';
+		*t++ = t_xref[xref.ref[index].type];
+		*t++ = ':';
+		t = formatHex(t, xref.ref[index].source, 6);
+	}
+	*t++ = '\n';
+	*t = '\0';
+	*next = index;
+	return t - s;
+}
+
+// Add a reference to the index
+// Parameters:
+// - target: The address referred to
+// - source: Address of the instruction
+// - type: XREF_*
+//
+static void xrefPut(long target, long source, int type) {
+	if(!xrefGrow()) {
+		return;
+	}
+	xref.ref[xref.count].target = target;
+	xref.ref[xref.count].source = source;
+	xref.ref[xref.count].type = type;
+	xref.count++;
+}
+
+// Make room for another reference
+// Returns:
+// - 1: OK
+// - 0: Out of memory; no more references are collected, and the listing is made without them
+//
+static int xrefGrow(void) {
+	struct s_ref *	ref;
+	long			max;
+
+	if(xref.count == xref.max) {
+		max = xref.max ? xref.max * 2 : 4096;
+		ref = realloc(xref.ref, max * sizeof(struct s_ref));
+		if(ref == NULL) {
+			xref.enabled = 0;
+			return 0;
+		}
+		xref.ref = ref;
+		xref.max = max;
+	}
+	return 1;
+}
+
+// Find where a reference is, or would be, in the sorted index
+// Parameters:
+// - target: The address referred to
+// - source: Address of the instruction
+// Returns:
+// - long: Index of the first reference that isn't ordered before it
+//
+static long xrefSearch(long target, long source) {
+	struct s_ref	key;
+	long			lo = 0;
+	long			hi = xref.count;
+	long			mid;
+
+	key.target = target;
+	key.source = source;
+	while(lo < hi) {
+		mid = (lo + hi) / 2;
+		if(xrefCompare(&xref.ref[mid], &key) < 0) lo = mid + 1;
+		else hi = mid;
+	}
+	return lo;
+}
+
+// Order references by target, then by source
+//
+static int xrefCompare(const void * a, const void * b) {
+	const struct s_ref *	x = a;
+	const struct s_ref *	y = b;
+
+	if(x->target != y->target) {
+		return x->target < y->target ? -1 : 1;
+	}
+	if(x->source != y->source) {
+		return x->source < y->source ? -1 : 1;
+	}
+	return 0;
+}
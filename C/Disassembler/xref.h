@@ -0,0 +1,58 @@
+/*
+ * Title:			Disassembler - Cross-references (host build)
+ * Author:			Dean Belfield
+ * Created:			17/10/2026
+ * Last Updated:	17/10/2026
+ *
+ * Modinfo:
+ * 17/10/2026:		Added xrefTarget
+ * 17/10/2026:		Added xrefInsert, xrefRemove and xrefRelabel, to update the sorted index
+ */
+
+#ifndef XREF_H
+#define XREF_H
+
+#include "decode.h"
+
+#define XREF_CALL		0			// CALL or RST
+#define XREF_JUMP		1			// JP, JR or DJNZ
+#define XREF_READ		2			// Read from (nn)
+#define XREF_WRITE		3			// Write to (nn)
+
+// A reference from an instruction to an address
+//
+struct s_ref {
+	long			target;			// The address referred to
+	long			source;			// Address of the instruction
+	int				type;			// XREF_*
+};
+
+// The cross-reference index; references are collected in any order, then sorted by target
+// so that they can be looked up with a binary search
+//
+struct s_xref {
+	int				enabled;		// Set if references are being collected
+	int				sorted;			// Set once the index has been sorted
+	struct s_ref *	ref;			// The references
+	long			count;			// Number of references
+	long			max;			// Space allocated for references
+	long *			label;			// Sorted addresses that are listed with a label
+	long			labels;			// Number of labels
+	long			labelMax;		// Space allocated for labels
+};
+
+extern struct s_xref	xref;
+
+void	xrefOpen(void);
+void	xrefClose(void);
+void	xrefAdd(struct s_opcode * opcode);
+int		xrefTarget(struct s_opcode * opcode, long * target);
+int		xrefSort(int (* defined)(long address));
+void	xrefInsert(struct s_opcode * opcode);
+void	xrefRemove(struct s_opcode * opcode);
+int		xrefRelabel(long target, int (* defined)(long address));
+long	xrefFind(long target);
+int		xrefLabel(long address);
+int		xrefFormat(char * t, long index, long * next);
+
+#endif